@@ -0,0 +1,371 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "ClassBreaks.h"
+#include "QuantileSketch.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+
+namespace
+{
+	// order preserving map of floats to unsigned integers
+	std::uint32_t toKey(float value)
+	{
+		std::uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+	}
+
+	float fromKey(std::uint32_t key)
+	{
+		std::uint32_t bits = key & 0x80000000u ? key & 0x7fffffffu : ~key;
+		float value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	// LSD radix sort with three passes of 11 bits, NaN is dropped
+	std::vector<float> sortValues(const float *values, std::size_t count)
+	{
+		const int digitBits = 11;
+		const std::size_t radix = 1 << digitBits;
+
+		std::vector<std::uint32_t> keys;
+		keys.reserve(count);
+
+		std::vector<std::size_t> counts(3 * radix, 0);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (values[i] != values[i])
+				continue;
+
+			std::uint32_t key = toKey(values[i]);
+			keys.push_back(key);
+
+			++counts[key & (radix - 1)];
+			++counts[radix + ((key >> digitBits) & (radix - 1))];
+			++counts[2 * radix + (key >> (2 * digitBits))];
+		}
+
+		std::size_t n = keys.size();
+		std::vector<std::uint32_t> buffer(n);
+
+		for (int pass = 0; pass < 3; ++pass)
+		{
+			std::size_t *offsets = &counts[pass * radix];
+			int shift = pass * digitBits;
+
+			// all keys share this digit
+			if (n > 0 && offsets[(keys[0] >> shift) & (radix - 1)] == n)
+				continue;
+
+			std::size_t sum = 0;
+			for (std::size_t d = 0; d < radix; ++d)
+			{
+				std::size_t c = offsets[d];
+				offsets[d] = sum;
+				sum += c;
+			}
+
+			for (std::size_t i = 0; i < n; ++i)
+				buffer[offsets[(keys[i] >> shift) & (radix - 1)]++] = keys[i];
+
+			keys.swap(buffer);
+		}
+
+		std::vector<float> sorted(n);
+		for (std::size_t i = 0; i < n; ++i)
+			sorted[i] = fromKey(keys[i]);
+
+		return sorted;
+	}
+
+	// One layer of the dynamic program: current[j] is the smallest sum of squared deviations of the first j groups
+	// in c classes, previous[] the same for c - 1 classes. The best split point does not decrease with j, so the
+	// middle j of a range is solved first and bounds the search of both halves.
+	struct Layer
+	{
+		const double *weights;
+		const double *sums;
+		const double *squares;
+		const double *previous;
+		double *current;
+		std::uint32_t *splits;
+
+		// sum of squared deviations of the groups [i, j)
+		double cost(std::size_t i, std::size_t j) const
+		{
+			double s = sums[j] - sums[i];
+			return (squares[j] - squares[i]) - s * s / (weights[j] - weights[i]);
+		}
+
+		// current[j] for j in [lo, hi] with the split point of each in [first, last]
+		void solve(std::size_t lo, std::size_t hi, std::size_t first, std::size_t last)
+		{
+			std::size_t mid = lo + (hi - lo) / 2;
+			std::size_t end = last < mid - 1 ? last : mid - 1;
+
+			double best = std::numeric_limits<double>::infinity();
+			std::size_t split = first;
+
+			for (std::size_t i = first; i <= end; ++i)
+			{
+				double d = previous[i] + cost(i, mid);
+				if (d < best)
+				{
+					best = d;
+					split = i;
+				}
+			}
+
+			current[mid] = best;
+			splits[mid] = static_cast<std::uint32_t>(split);
+
+			if (mid > lo)
+				solve(lo, mid - 1, first, split);
+			if (mid < hi)
+				solve(mid + 1, hi, split, last);
+		}
+	};
+}
+
+
+const std::size_t ClassBreaks::maxSplitEntries;
+
+
+ClassBreaks::ClassBreaks(unsigned int resolution)
+: m_resolution(resolution),
+  m_goodnessOfFit(0.0)
+{
+}
+
+bool ClassBreaks::compute(const float *values, std::size_t count, unsigned int k, Method method)
+{
+	m_breaks.clear();
+	m_goodnessOfFit = 0.0;
+
+	if (k < 1 || k > 256)
+	{
+		std::cout << "ClassBreaks::compute(): Number of classes must be in [1, 256].";
+		return false;
+	}
+
+	if (method == equalInterval)
+	{
+		float lo = std::numeric_limits<float>::infinity();
+		float hi = -lo;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			lo = values[i] < lo ? values[i] : lo;
+			hi = values[i] > hi ? values[i] : hi;
+		}
+
+		if (lo > hi)
+		{
+			std::cout << "ClassBreaks::compute(): No values to classify.";
+			return false;
+		}
+
+		m_breaks.resize(k + 1);
+		for (unsigned int c = 0; c < k; ++c)
+			m_breaks[c] = lo + (hi - lo) * static_cast<float>(c) / static_cast<float>(k);
+		m_breaks[k] = hi;
+	}
+	else
+	{
+		std::vector<float> sorted = sortValues(values, count);
+		if (sorted.empty())
+		{
+			std::cout << "ClassBreaks::compute(): No values to classify.";
+			return false;
+		}
+
+		if (method == quantile)
+		{
+			std::size_t n = sorted.size();
+
+			// nearest rank, the upper bound of class c - 1 is the value of rank ceil(c * n / k)
+			m_breaks.resize(k + 1);
+			m_breaks[0] = sorted[0];
+			for (unsigned int c = 1; c <= k; ++c)
+				m_breaks[c] = sorted[(c * n + k - 1) / k - 1];
+		}
+		else
+		{
+			computeJenks(sorted, k);
+		}
+	}
+
+	computeFit(values, count);
+	return true;
+}
+
+bool ClassBreaks::compute(const QuantileSketch &sketch, unsigned int k)
+{
+	m_breaks.clear();
+	m_goodnessOfFit = 0.0;
+
+	if (k < 1 || k > 256)
+	{
+		std::cout << "ClassBreaks::compute(): Number of classes must be in [1, 256].";
+		return false;
+	}
+
+	if (sketch.empty())
+	{
+		std::cout << "ClassBreaks::compute(): No values to classify.";
+		return false;
+	}
+
+	std::vector<double> ranks(k + 1);
+	for (unsigned int c = 0; c <= k; ++c)
+		ranks[c] = static_cast<double>(c) / static_cast<double>(k);
+
+	m_breaks.resize(k + 1);
+	sketch.quantiles(ranks.data(), ranks.size(), m_breaks.data());
+	return true;
+}
+
+void ClassBreaks::classify(const float *values, std::size_t count, unsigned char *classes) const
+{
+	if (m_breaks.size() < 2)
+	{
+		std::cout << "ClassBreaks::classify(): No breaks computed.";
+		return;
+	}
+
+	// lower_bound counts the inner breaks below a value, NaN compares false and stays in class 0
+	const float *inner = m_breaks.data() + 1;
+	const float *innerEnd = m_breaks.data() + m_breaks.size() - 1;
+
+	for (std::size_t i = 0; i < count; ++i)
+		classes[i] = static_cast<unsigned char>(std::lower_bound(inner, innerEnd, values[i]) - inner);
+}
+
+void ClassBreaks::computeJenks(const std::vector<float> &sorted, unsigned int k)
+{
+	std::size_t count = sorted.size();
+
+	// the split table holds k - 1 rows of m + 1 entries, the resolution shrinks with k to keep it bounded
+	std::size_t resolution = k > 1 ? maxSplitEntries / (k - 1) : maxSplitEntries;
+	if (m_resolution > 0 && m_resolution < resolution)
+		resolution = m_resolution;
+
+	std::size_t target = (count + resolution - 1) / resolution;
+
+	// values relative to the median keep the sums of squares well conditioned
+	double shift = sorted[count / 2];
+
+	// prefix sums over the groups, equal values always share a group
+	std::vector<double> weights(1, 0.0);
+	std::vector<double> sums(1, 0.0);
+	std::vector<double> squares(1, 0.0);
+	std::vector<float> upper;
+
+	std::size_t size = 0;
+	double s = 0.0;
+	double q = 0.0;
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		double x = sorted[i] - shift;
+		++size;
+		s += x;
+		q += x * x;
+
+		if (i + 1 == count || (size >= target && sorted[i + 1] != sorted[i]))
+		{
+			weights.push_back(weights.back() + static_cast<double>(size));
+			sums.push_back(sums.back() + s);
+			squares.push_back(squares.back() + q);
+			upper.push_back(sorted[i]);
+
+			size = 0;
+			s = 0.0;
+			q = 0.0;
+		}
+	}
+
+	std::size_t m = upper.size();
+	k = static_cast<std::size_t>(k) < m ? k : static_cast<unsigned int>(m);
+
+	std::vector<double> previous(m + 1);
+	std::vector<double> current(m + 1);
+	std::vector<std::uint32_t> splits(static_cast<std::size_t>(k > 1 ? k - 1 : 0) * (m + 1));
+
+	Layer layer;
+	layer.weights = weights.data();
+	layer.sums = sums.data();
+	layer.squares = squares.data();
+
+	for (std::size_t j = 1; j <= m; ++j)
+		previous[j] = layer.cost(0, j);
+
+	for (unsigned int c = 2; c <= k; ++c)
+	{
+		layer.previous = previous.data();
+		layer.current = current.data();
+		layer.splits = &splits[(c - 2) * (m + 1)];
+		layer.solve(c, m, c - 1, m - 1);
+
+		previous.swap(current);
+	}
+
+	m_breaks.resize(k + 1);
+	m_breaks[0] = sorted[0];
+	m_breaks[k] = upper[m - 1];
+
+	std::size_t j = m;
+	for (unsigned int c = k; c >= 2; --c)
+	{
+		j = splits[(c - 2) * (m + 1) + j];
+		m_breaks[c - 1] = upper[j - 1];
+	}
+}
+
+void ClassBreaks::computeFit(const float *values, std::size_t count)
+{
+	std::size_t k = size();
+	std::vector<double> weights(k, 0.0);
+	std::vector<double> sums(k, 0.0);
+	std::vector<double> squares(k, 0.0);
+
+	double shift = 0.5 * (static_cast<double>(m_breaks.front()) + static_cast<double>(m_breaks.back()));
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		if (values[i] != values[i])
+			continue;
+
+		unsigned int c = classify(values[i]);
+		double x = values[i] - shift;
+
+		weights[c] += 1.0;
+		sums[c] += x;
+		squares[c] += x * x;
+	}
+
+	double w = 0.0;
+	double s = 0.0;
+	double q = 0.0;
+	double within = 0.0;
+
+	for (std::size_t c = 0; c < k; ++c)
+	{
+		w += weights[c];
+		s += sums[c];
+		q += squares[c];
+
+		if (weights[c] > 0.0)
+			within += squares[c] - sums[c] * sums[c] / weights[c];
+	}
+
+	double total = q - s * s / w;
+	m_goodnessOfFit = total > 0.0 ? 1.0 - within / total : 1.0;
+}
@@ -0,0 +1,87 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef CLASSBREAKS
+#define CLASSBREAKS
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+class QuantileSketch;
+
+/**
+**  Class breaks for choropleth maps, one class per color of a scheme with n colors.
+**  Jenks natural breaks minimize the sum of squared deviations from the class means exactly by dynamic programming
+**  over the sorted values, with a divide and conquer search of the monotone split points, O(k m log m) for m
+**  distinct values. Beyond resolution distinct values, runs of neighboring values are merged into weighted groups
+**  of equal size first, so breaks fall between groups; their sums keep the class variances exact.
+**
+**	Breaks: k + 1 values, the minimum followed by the inclusive upper bound of every class
+**	Classes: class c holds the values in (breaks[c], breaks[c + 1]], class 0 also the minimum; values outside the
+**	         range are clamped to the first and last class, NaN falls into class 0 and is ignored by compute()
+**
+**	Usage:
+**  ClassBreaks breaks;
+**	breaks.compute(values, count, 7, ClassBreaks::jenks);
+**	breaks.classify(values, count, classes);
+**	breaks.compute(sketch, 7); // quantile breaks of unbounded data, see QuantileSketch
+**	ColorBrewer::ColorView view = PaletteRegistry::builtin().getView(ColorBrewer::sequential, ColorBrewer::Blues, 7);
+**	const float *rgb = view.rgb + 3 * classes[i];
+**
+**/
+
+
+class ClassBreaks
+{
+
+public:
+	enum Method
+	{
+		equalInterval, quantile, jenks
+	};
+
+
+public:
+	// entries of 4 bytes in the jenks split table, (k - 1) * (groups + 1), so at most 64 MB
+	static const std::size_t maxSplitEntries = std::size_t(1) << 24;
+
+	// resolution: maximum number of distinct values or groups the jenks optimization runs on, 0 for no limit; either
+	// way it is capped at maxSplitEntries / (k - 1), e.g. 65793 groups for k = 256 and 2796202 for k = 7
+	explicit ClassBreaks(unsigned int resolution = 1 << 18);
+
+	// k in [1, 256]; jenks yields fewer classes if there are less than k distinct values
+	bool compute(const float *values, std::size_t count, unsigned int k, Method method = jenks);
+
+	// quantile breaks of a streaming sketch, the goodness of fit is not known and set to 0
+	bool compute(const QuantileSketch &sketch, unsigned int k);
+
+	unsigned int size() const { return m_breaks.empty() ? 0 : static_cast<unsigned int>(m_breaks.size() - 1); }
+	const std::vector<float> &breaks() const { return m_breaks; }
+
+	// 1 - within class / total sum of squared deviations of the last compute(), 1 for a perfect fit
+	double goodnessOfFit() const { return m_goodnessOfFit; }
+
+	// number of inner breaks below value, a binary search over the sorted breaks
+	unsigned int classify(float value) const
+	{
+		if (m_breaks.size() < 3)
+			return 0;
+
+		return static_cast<unsigned int>(std::lower_bound(m_breaks.begin() + 1, m_breaks.end() - 1, value) - (m_breaks.begin() + 1));
+	}
+
+	void classify(const float *values, std::size_t count, unsigned char *classes) const;
+
+
+private:
+	void computeJenks(const std::vector<float> &sorted, unsigned int k);
+	void computeFit(const float *values, std::size_t count);
+
+	unsigned int m_resolution;
+	std::vector<float> m_breaks;
+	double m_goodnessOfFit;
+};
+
+
+#endif
@@ -4,7 +4,9 @@
 #ifndef COLORBREWER
 #define COLORBREWER
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <vector>
 
 /**
@@ -19,6 +21,10 @@
 **  ColorBrewer brewer;
 **	std::vector<float> rgb = brewer.getDiverging(9, ColorBrewer::Diverging::BrBG, {});
 **  std::vector< std::vector<float> > rgbs = brewer.getDivering(7, {ColorBrewer::Properties::print});
+**  ColorBrewer::ColorView view = brewer.getSequentialView(5, ColorBrewer::Sequential::Blues, {});
+**
+**  All instances read the same immutable PaletteRegistry::builtin(). Threads sharing one instance must not call
+**  setNormalization() concurrently; use the registry directly to pass the normalization per call.
 **
 **/
 
@@ -47,13 +53,38 @@ public:
 		blind, print, copy, screen
 	};
 
+	enum Family
+	{
+		diverging, qualitative, sequential
+	};
+
 
+	// registry entry of one scheme and number of classes, n is 0 if not available
 	struct ColorScheme
 	{
-		std::map< unsigned int, std::vector<float> > rgbs;
-		std::map< unsigned int, std::map<Properties, unsigned short> > properties;
+		unsigned int offset;
+		unsigned short n;
+		unsigned short properties[4];
+		unsigned short propertyMask; // bit p is set if properties[p] == 1
 	};
 
+	// non-owning view on the rgb values of a color scheme, empty if not available
+	template <typename T>
+	struct BasicColorView
+	{
+		const T *rgb;
+		unsigned int n;
+
+		bool empty() const { return n == 0; }
+		std::size_t size() const { return 3 * n; }
+		const T *begin() const { return rgb; }
+		const T *end() const { return rgb + 3 * n; }
+		T operator[](std::size_t i) const { return rgb[i]; }
+	};
+
+	typedef BasicColorView<float> ColorView;
+	typedef BasicColorView<unsigned char> ColorView8;
+
 
 public:
 	ColorBrewer();
@@ -62,24 +93,47 @@ public:
 	void setNormalization(bool norm);
 
 	// get single color scheme
-	std::vector<float> getDiverging(int n, Diverging name = Spectral, const std::vector<Properties> &properties = {});
-	std::vector<float> getQualitative(int n, Qualitative name = Set2, const std::vector<Properties> &properties = {});
-	std::vector<float> getSequential(int n, Sequential name = OrRd, const std::vector<Properties> &properties = {});
+	std::vector<float> getDiverging(int n, Diverging name = Spectral, const std::vector<Properties> &properties = {}) const;
+	std::vector<float> getQualitative(int n, Qualitative name = Set2, const std::vector<Properties> &properties = {}) const;
+	std::vector<float> getSequential(int n, Sequential name = OrRd, const std::vector<Properties> &properties = {}) const;
+
+	// get single color scheme without allocating, normalized according to setNormalization()
+	ColorView getDivergingView(int n, Diverging name = Spectral, std::initializer_list<Properties> properties = {}) const;
+	ColorView getQualitativeView(int n, Qualitative name = Set2, std::initializer_list<Properties> properties = {}) const;
+	ColorView getSequentialView(int n, Sequential name = OrRd, std::initializer_list<Properties> properties = {}) const;
+
+	// get single color scheme as 8 bit rgb values, independent of setNormalization()
+	ColorView8 getDivergingView8(int n, Diverging name = Spectral, std::initializer_list<Properties> properties = {}) const;
+	ColorView8 getQualitativeView8(int n, Qualitative name = Set2, std::initializer_list<Properties> properties = {}) const;
+	ColorView8 getSequentialView8(int n, Sequential name = OrRd, std::initializer_list<Properties> properties = {}) const;
+
+	// get single color scheme of any family, name is the value of the family's enum
+	ColorView getView(Family family, int name, int n, std::initializer_list<Properties> properties = {}) const;
+	static ColorView8 getView8(Family family, int name, int n, std::initializer_list<Properties> properties = {});
+
+	// 32 bit pixel holding the bytes b0, b1, b2, b3 in this order in memory
+	static std::uint32_t pack(unsigned char b0, unsigned char b1, unsigned char b2, unsigned char b3);
+
+	// palette as packed 32 bit rgba or bgra pixels with opaque alpha, out holds view.n pixels
+	static void packRgba(const ColorView8 &view, std::uint32_t *out);
+	static void packBgra(const ColorView8 &view, std::uint32_t *out);
+
+	// largest number of classes available for a scheme, 0 if the scheme does not exist
+	static int getMaxClasses(Family family, int name);
 
 	// get multiple color schemes
-	std::vector< std::vector<float> > getDivergings(int n, const std::vector<Properties> &properties = { });
-	std::vector< std::vector<float> > getQualitatives(int n, const std::vector<Properties> &properties = { });
-	std::vector< std::vector<float> > getSequentials(int n, const std::vector<Properties> &properties = { });
+	std::vector< std::vector<float> > getDivergings(int n, const std::vector<Properties> &properties = { }) const;
+	std::vector< std::vector<float> > getQualitatives(int n, const std::vector<Properties> &properties = { }) const;
+	std::vector< std::vector<float> > getSequentials(int n, const std::vector<Properties> &properties = { }) const;
 
+	// bitset over the scheme names of a family which have n classes and satisfy all properties,
+	// e.g. bit ColorBrewer::Blues of getSchemeMask(ColorBrewer::sequential, 5, {ColorBrewer::print})
+	static unsigned int getSchemeMask(Family family, int n, std::initializer_list<Properties> properties = {});
 
-private:
-	void initDiverging();
-	void initQualitative();
-	void initSequential();
 
-	std::map<Diverging, ColorScheme>   m_diverging;
-	std::map<Qualitative, ColorScheme> m_qualitative;
-	std::map<Sequential, ColorScheme>  m_sequential;
+private:
+	std::vector<float> getColors(const ColorScheme &scheme) const;
+	std::vector< std::vector<float> > getSchemes(Family family, int n, const std::vector<Properties> &properties) const;
 
 	bool m_normalize;
 };
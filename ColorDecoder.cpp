@@ -0,0 +1,382 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "ColorDecoder.h"
+#include "ColorSpace.h"
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define COLORDECODER_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#define COLORDECODER_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(COLORDECODER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define COLORDECODER_TARGET(isa) __attribute__((target(isa)))
+#else
+#define COLORDECODER_TARGET(isa)
+#endif
+
+
+namespace
+{
+	typedef std::vector<std::uint32_t> Cube;
+
+	struct Kernel
+	{
+		const std::uint32_t *cube;
+		unsigned int bits;
+		float scale;
+		float bias;
+	};
+
+	struct CacheEntry
+	{
+		std::weak_ptr<const ColorLut> lut;
+		std::shared_ptr<const Cube> cube;
+	};
+
+	struct Segment
+	{
+		float start[3];
+		float direction[3];
+		float invLength; // 0 for a single point
+		float center[3];
+		float radius; // of the bounding sphere around center
+	};
+
+	// squared distance of p to the segment, u is the position of the nearest point in [0, 1]
+	float getDistance(const Segment &segment, const float *p, float &u)
+	{
+		float x = p[0] - segment.start[0];
+		float y = p[1] - segment.start[1];
+		float z = p[2] - segment.start[2];
+
+		u = (x * segment.direction[0] + y * segment.direction[1] + z * segment.direction[2]) * segment.invLength;
+		u = u > 0.0f ? (u < 1.0f ? u : 1.0f) : 0.0f;
+
+		x -= u * segment.direction[0];
+		y -= u * segment.direction[1];
+		z -= u * segment.direction[2];
+
+		return x * x + y * y + z * z;
+	}
+
+	// color curve of the table in CIELAB, segment i runs from entry i to i + 1, class tables have one point per class
+	std::shared_ptr<const Cube> buildCube(const ColorLut &lut, unsigned int bits)
+	{
+		unsigned int size = lut.size();
+		unsigned int numSegments = lut.interpolation() == ColorLut::classes || size < 2 ? size : size - 1;
+
+		std::vector<float> lab(3 * size);
+		for (unsigned int i = 0; i < size; ++i)
+			ColorSpace::rgbToLab(lut.data() + 4 * i, &lab[3 * i]);
+
+		std::vector<Segment> segments(numSegments);
+		for (unsigned int s = 0; s < numSegments; ++s)
+		{
+			Segment &segment = segments[s];
+			float length = 0.0f;
+
+			for (int c = 0; c < 3; ++c)
+			{
+				segment.start[c] = lab[3 * s + c];
+				segment.direction[c] = numSegments < size ? lab[3 * (s + 1) + c] - lab[3 * s + c] : 0.0f;
+				segment.center[c] = segment.start[c] + 0.5f * segment.direction[c];
+				length += segment.direction[c] * segment.direction[c];
+			}
+
+			segment.invLength = length > 0.0f ? 1.0f / length : 0.0f;
+			segment.radius = 0.5f * std::sqrt(length);
+		}
+
+		unsigned int cells = 1u << bits;
+		std::shared_ptr<Cube> cube = std::make_shared<Cube>(cells * cells * cells);
+		unsigned int seed = 0;
+
+		std::vector<float> row(3 * cells);
+		float *channels[3] = { row.data(), row.data() + cells, row.data() + 2 * cells };
+
+		for (unsigned int cell = 0; cell < cells * cells * cells; ++cell)
+		{
+			unsigned int blue = cell & (cells - 1);
+
+			// cell centers along blue converted to CIELAB in one batch
+			if (blue == 0)
+			{
+				for (unsigned int k = 0; k < cells; ++k)
+				{
+					channels[0][k] = ((cell >> (2 * bits)) + 0.5f) / cells;
+					channels[1][k] = (((cell >> bits) & (cells - 1)) + 0.5f) / cells;
+					channels[2][k] = (k + 0.5f) / cells;
+				}
+
+				ColorSpace::rgbToLab(channels, channels, cells);
+			}
+
+			float p[3] = { channels[0][blue], channels[1][blue], channels[2][blue] };
+
+			// nearest point on the curve, ties go to the lower t; the nearest segment of the previous cell gives a
+			// first bound, segments whose bounding sphere lies beyond it are skipped
+			float bestPosition;
+			float bestDistance = getDistance(segments[seed], p, bestPosition);
+			float bestRadius = std::sqrt(bestDistance);
+			bestPosition += seed;
+
+			for (unsigned int s = 0; s < numSegments; ++s)
+			{
+				const Segment &segment = segments[s];
+				float mx = p[0] - segment.center[0];
+				float my = p[1] - segment.center[1];
+				float mz = p[2] - segment.center[2];
+				float reach = bestRadius + segment.radius;
+
+				if (mx * mx + my * my + mz * mz > reach * reach)
+					continue;
+
+				float u;
+				float distance = getDistance(segment, p, u);
+
+				if (distance < bestDistance || (distance == bestDistance && s + u < bestPosition))
+				{
+					bestDistance = distance;
+					bestRadius = std::sqrt(distance);
+					bestPosition = s + u;
+					seed = s;
+				}
+			}
+
+			// entry position to t, the inverse of ColorLut::index()
+			float t = (bestPosition + 0.5f - lut.bias()) / lut.scale();
+			t = t > 0.0f ? (t < 1.0f ? t : 1.0f) : 0.0f;
+
+			float distance = std::sqrt(bestDistance) * 256.0f + 0.5f;
+			std::uint32_t distance16 = distance < 65535.0f ? static_cast<std::uint32_t>(distance) : 65535u;
+
+			(*cube)[cell] = (static_cast<std::uint32_t>(t * 65535.0f + 0.5f) << 16) | distance16;
+		}
+
+		return cube;
+	}
+
+	// Cubes live as long as their table: entries of expired tables are dropped on every lookup. The cube is built
+	// outside the lock, two decoders asking for the same missing cube may both build it and the first one is kept.
+	std::shared_ptr<const Cube> getCube(const std::shared_ptr<const ColorLut> &lut, unsigned int bits)
+	{
+		typedef std::map<std::pair<const ColorLut *, unsigned int>, CacheEntry> Cache;
+
+		static std::mutex cacheMutex;
+		static Cache cache;
+
+		std::pair<const ColorLut *, unsigned int> key(lut.get(), bits);
+
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			for (Cache::iterator it = cache.begin(); it != cache.end();)
+			{
+				if (it->second.lut.expired())
+					it = cache.erase(it);
+				else
+					++it;
+			}
+
+			// a live entry under this address belongs to this table
+			Cache::iterator it = cache.find(key);
+			if (it != cache.end())
+				return it->second.cube;
+		}
+
+		std::shared_ptr<const Cube> cube = buildCube(*lut, bits);
+
+		std::lock_guard<std::mutex> lock(cacheMutex);
+
+		CacheEntry &entry = cache[key];
+		if (!entry.cube || entry.lut.expired())
+		{
+			entry.lut = lut;
+			entry.cube = cube;
+		}
+
+		return entry.cube;
+	}
+
+	void decodeScalar(const Kernel &kernel, const unsigned char *rgb, std::size_t count, float *values, float *distances)
+	{
+		unsigned int shift = 8 - kernel.bits;
+
+		for (std::size_t i = 0; i < count; ++i, rgb += 3)
+		{
+			std::uint32_t cell = kernel.cube[((rgb[0] >> shift) << (2 * kernel.bits)) | ((rgb[1] >> shift) << kernel.bits) | (rgb[2] >> shift)];
+
+			values[i] = static_cast<float>(cell >> 16) * kernel.scale + kernel.bias;
+			if (distances)
+				distances[i] = static_cast<float>(cell & 0xffff) * (1.0f / 256.0f);
+		}
+	}
+
+#ifdef COLORDECODER_X86
+	// 8 pixels per step: spread the channels to 32 bit lanes, compute the cell and gather from the cube
+	COLORDECODER_TARGET("avx2")
+	void decodeAvx2(const Kernel &kernel, const unsigned char *rgb, std::size_t count, float *values, float *distances)
+	{
+		const __m256i words = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+		const __m256i red = _mm256_setr_epi8(0, -1, -1, -1, 3, -1, -1, -1, 6, -1, -1, -1, 9, -1, -1, -1,
+			0, -1, -1, -1, 3, -1, -1, -1, 6, -1, -1, -1, 9, -1, -1, -1);
+		const __m256i green = _mm256_setr_epi8(1, -1, -1, -1, 4, -1, -1, -1, 7, -1, -1, -1, 10, -1, -1, -1,
+			1, -1, -1, -1, 4, -1, -1, -1, 7, -1, -1, -1, 10, -1, -1, -1);
+		const __m256i blue = _mm256_setr_epi8(2, -1, -1, -1, 5, -1, -1, -1, 8, -1, -1, -1, 11, -1, -1, -1,
+			2, -1, -1, -1, 5, -1, -1, -1, 8, -1, -1, -1, 11, -1, -1, -1);
+		const __m256i low = _mm256_set1_epi32(0xffff);
+		const __m128i shift = _mm_cvtsi32_si128(8 - kernel.bits);
+		const __m128i shiftRed = _mm_cvtsi32_si128(2 * kernel.bits);
+		const __m128i shiftGreen = _mm_cvtsi32_si128(kernel.bits);
+		const __m256 scale = _mm256_set1_ps(kernel.scale);
+		const __m256 bias = _mm256_set1_ps(kernel.bias);
+		const __m256 distanceScale = _mm256_set1_ps(1.0f / 256.0f);
+
+		std::size_t i = 0;
+
+		// each step loads 32 bytes for 24 bytes of pixels
+		for (; i + 11 <= count; i += 8)
+		{
+			__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rgb + 3 * i));
+			bytes = _mm256_permutevar8x32_epi32(bytes, words);
+
+			__m256i r = _mm256_srl_epi32(_mm256_shuffle_epi8(bytes, red), shift);
+			__m256i g = _mm256_srl_epi32(_mm256_shuffle_epi8(bytes, green), shift);
+			__m256i b = _mm256_srl_epi32(_mm256_shuffle_epi8(bytes, blue), shift);
+
+			__m256i cell = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(r, shiftRed), _mm256_sll_epi32(g, shiftGreen)), b);
+			__m256i entry = _mm256_i32gather_epi32(reinterpret_cast<const int *>(kernel.cube), cell, 4);
+
+			__m256 t = _mm256_cvtepi32_ps(_mm256_srli_epi32(entry, 16));
+			_mm256_storeu_ps(values + i, _mm256_add_ps(_mm256_mul_ps(t, scale), bias));
+
+			if (distances)
+			{
+				__m256 distance = _mm256_cvtepi32_ps(_mm256_and_si256(entry, low));
+				_mm256_storeu_ps(distances + i, _mm256_mul_ps(distance, distanceScale));
+			}
+		}
+
+		decodeScalar(kernel, rgb + 3 * i, count - i, values + i, distances ? distances + i : nullptr);
+	}
+#endif
+
+#ifdef COLORDECODER_NEON
+	// 16 pixels per step: deinterleave with vld3, compute the cells in 16 bit lanes and convert 4 entries at a time
+	void decodeNeon(const Kernel &kernel, const unsigned char *rgb, std::size_t count, float *values, float *distances)
+	{
+		const int8x16_t shift = vdupq_n_s8(static_cast<signed char>(kernel.bits) - 8);
+		const int16x8_t shiftRed = vdupq_n_s16(static_cast<short>(2 * kernel.bits));
+		const int16x8_t shiftGreen = vdupq_n_s16(static_cast<short>(kernel.bits));
+		const uint32x4_t low = vdupq_n_u32(0xffff);
+		const float32x4_t scale = vdupq_n_f32(kernel.scale);
+		const float32x4_t bias = vdupq_n_f32(kernel.bias);
+
+		std::uint16_t cells[16];
+		std::uint32_t entries[16];
+		std::size_t i = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			uint8x16x3_t pixels = vld3q_u8(rgb + 3 * i);
+			uint8x16_t r = vshlq_u8(pixels.val[0], shift);
+			uint8x16_t g = vshlq_u8(pixels.val[1], shift);
+			uint8x16_t b = vshlq_u8(pixels.val[2], shift);
+
+			uint16x8_t lo = vorrq_u16(vorrq_u16(vshlq_u16(vmovl_u8(vget_low_u8(r)), shiftRed), vshlq_u16(vmovl_u8(vget_low_u8(g)), shiftGreen)), vmovl_u8(vget_low_u8(b)));
+			uint16x8_t hi = vorrq_u16(vorrq_u16(vshlq_u16(vmovl_u8(vget_high_u8(r)), shiftRed), vshlq_u16(vmovl_u8(vget_high_u8(g)), shiftGreen)), vmovl_u8(vget_high_u8(b)));
+
+			vst1q_u16(cells, lo);
+			vst1q_u16(cells + 8, hi);
+
+			for (int k = 0; k < 16; ++k)
+				entries[k] = kernel.cube[cells[k]];
+
+			for (int k = 0; k < 16; k += 4)
+			{
+				uint32x4_t entry = vld1q_u32(entries + k);
+				float32x4_t t = vcvtq_f32_u32(vshrq_n_u32(entry, 16));
+				vst1q_f32(values + i + k, vmlaq_f32(bias, t, scale));
+
+				if (distances)
+					vst1q_f32(distances + i + k, vmulq_n_f32(vcvtq_f32_u32(vandq_u32(entry, low)), 1.0f / 256.0f));
+			}
+		}
+
+		decodeScalar(kernel, rgb + 3 * i, count - i, values + i, distances ? distances + i : nullptr);
+	}
+#endif
+}
+
+
+ColorDecoder::ColorDecoder(std::shared_ptr<const ColorLut> lut, float minValue, float maxValue, unsigned int bits)
+: m_lut(lut),
+  m_bits(bits < 4 ? 4 : (bits > 7 ? 7 : bits)),
+  m_isa(ColorMapper::scalar)
+{
+	if (!m_lut)
+	{
+		std::cout << "ColorDecoder::ColorDecoder(): No color table available, using black to white.";
+		m_lut = ColorLut::getFallback();
+	}
+
+	m_cube = getCube(m_lut, m_bits);
+
+	setRange(minValue, maxValue);
+	setIsa(ColorMapper::detectIsa());
+}
+
+void ColorDecoder::setRange(float minValue, float maxValue)
+{
+	m_scale = (maxValue - minValue) / 65535.0f;
+	m_bias = minValue;
+}
+
+void ColorDecoder::setIsa(ColorMapper::Isa isa)
+{
+	// kernels exist for avx2, neon and scalar, sse41 falls back to scalar
+	ColorMapper::Isa best = ColorMapper::detectIsa();
+
+	if (isa == ColorMapper::avx2 && best == ColorMapper::avx2)
+		m_isa = ColorMapper::avx2;
+	else if (isa == ColorMapper::neon && best == ColorMapper::neon)
+		m_isa = ColorMapper::neon;
+	else
+		m_isa = ColorMapper::scalar;
+}
+
+void ColorDecoder::decode(const unsigned char *rgb, std::size_t count, float *values, float *distances) const
+{
+	Kernel kernel;
+	kernel.cube = m_cube->data();
+	kernel.bits = m_bits;
+	kernel.scale = m_scale;
+	kernel.bias = m_bias;
+
+	switch (m_isa)
+	{
+#ifdef COLORDECODER_X86
+	case ColorMapper::avx2:
+		decodeAvx2(kernel, rgb, count, values, distances);
+		break;
+#endif
+#ifdef COLORDECODER_NEON
+	case ColorMapper::neon:
+		decodeNeon(kernel, rgb, count, values, distances);
+		break;
+#endif
+	default:
+		decodeScalar(kernel, rgb, count, values, distances);
+		break;
+	}
+}
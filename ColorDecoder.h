@@ -0,0 +1,77 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef COLORDECODER
+#define COLORDECODER
+
+#include "ColorLut.h"
+#include "ColorMapper.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+**  Inverse of ColorMapper: recovers scalar values from 8 bit rgb pixels colorized with a ColorLut.
+**  Each pixel is projected onto the color curve of the table in CIELAB, continuous tables as a polyline through
+**  their entries and class tables as one point per class. The projections are precomputed for the centers of a
+**  cube of (2^bits)^3 cells, so a pixel costs one table lookup. Cubes are cached per table and bits as long as the table lives.
+**
+**	Output: values in [minValue, maxValue], optional CIELAB distance of the pixel's cell to the curve as confidence
+**	        (0 on the curve, compressed or blended pixels are further away)
+**
+**	Usage:
+**  ColorDecoder decoder(ColorLut::get(ColorBrewer::Sequential::YlOrRd, 256, ColorLut::rgb), 0.0f, 100.0f);
+**	decoder.decode(rgb, width * height, values, distances);
+**
+**/
+
+
+class ColorDecoder
+{
+
+public:
+	// bits per channel of the cube in [4, 7], the build cost grows with 8^bits times the table size
+	ColorDecoder(std::shared_ptr<const ColorLut> lut, float minValue = 0.0f, float maxValue = 1.0f, unsigned int bits = 6);
+
+	void setRange(float minValue, float maxValue);
+
+	// kernels exist for avx2, neon and scalar
+	void setIsa(ColorMapper::Isa isa);
+	ColorMapper::Isa getIsa() const { return m_isa; }
+
+	unsigned int bits() const { return m_bits; }
+	const ColorLut &lut() const { return *m_lut; }
+
+	// cube of cells, red is the slowest axis; t in [0, 1] in the high 16 bits, distance in 1 / 256 units in the low 16 bits
+	const std::uint32_t *cube() const { return m_cube->data(); }
+
+	float value(unsigned char r, unsigned char g, unsigned char b, float *distance = nullptr) const
+	{
+		unsigned int shift = 8 - m_bits;
+		std::uint32_t cell = (*m_cube)[((r >> shift) << (2 * m_bits)) | ((g >> shift) << m_bits) | (b >> shift)];
+
+		if (distance)
+			*distance = static_cast<float>(cell & 0xffff) * (1.0f / 256.0f);
+
+		return static_cast<float>(cell >> 16) * m_scale + m_bias;
+	}
+
+	// count pixels of 3 bytes each, distances may be null
+	void decode(const unsigned char *rgb, std::size_t count, float *values, float *distances = nullptr) const;
+
+
+private:
+	std::shared_ptr<const ColorLut> m_lut;
+	std::shared_ptr<const std::vector<std::uint32_t> > m_cube;
+	unsigned int m_bits;
+
+	// value = t16 * m_scale + m_bias
+	float m_scale;
+	float m_bias;
+
+	ColorMapper::Isa m_isa;
+};
+
+
+#endif
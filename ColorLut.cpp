@@ -0,0 +1,239 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "ColorLut.h"
+#include "ColorSpace.h"
+#include "PaletteRegistry.h"
+#include "PixelFormat.h"
+#include <map>
+#include <mutex>
+
+
+namespace
+{
+	// tables kept by get(), tables nobody else holds are dropped when the cache is full
+	const std::size_t maxCachedTables = 256;
+
+	void toSpace(const float *rgb, float *out, ColorLut::Interpolation interpolation)
+	{
+		switch (interpolation)
+		{
+		case ColorLut::linearRgb:
+			ColorSpace::rgbToLinear(rgb, out);
+			break;
+		case ColorLut::lab:
+			ColorSpace::rgbToLab(rgb, out);
+			break;
+		case ColorLut::oklab:
+			ColorSpace::rgbToOklab(rgb, out);
+			break;
+		default:
+			out[0] = rgb[0];
+			out[1] = rgb[1];
+			out[2] = rgb[2];
+		}
+	}
+
+	// structure of arrays batch back to sRGB, the table based conversions clamp on their own
+	void fromSpace(float *const channels[3], std::size_t count, ColorLut::Interpolation interpolation)
+	{
+		switch (interpolation)
+		{
+		case ColorLut::linearRgb:
+			for (int c = 0; c < 3; ++c)
+				ColorSpace::linearToSrgb(channels[c], channels[c], count);
+			break;
+		case ColorLut::lab:
+			ColorSpace::labToRgb(channels, channels, count);
+			break;
+		case ColorLut::oklab:
+			ColorSpace::oklabToRgb(channels, channels, count);
+			break;
+		default:
+			for (int c = 0; c < 3; ++c)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					channels[c][i] = channels[c][i] < 0.0f ? 0.0f : (channels[c][i] > 1.0f ? 1.0f : channels[c][i]);
+			}
+		}
+	}
+
+	unsigned char toByte(float c)
+	{
+		return static_cast<unsigned char>(c * 255.0f + 0.5f);
+	}
+}
+
+
+ColorLut::ColorLut(const float *colors, unsigned int n, unsigned int size, Interpolation interpolation, const float *stops)
+: m_size(interpolation == classes ? (n < 1 ? 1 : n) : (size < 2 ? 2 : size)),
+  m_scale(static_cast<float>(interpolation == classes ? m_size : m_size - 1)),
+  m_bias(interpolation == classes ? 0.0f : 0.5f),
+  m_maxIndex(static_cast<float>(m_size - 1)),
+  m_interpolation(interpolation),
+  m_rgba(4 * m_size, 1.0f),
+  m_rgba8(m_size, ColorBrewer::pack(255, 255, 255, 255)),
+  m_bgra8(m_size, ColorBrewer::pack(255, 255, 255, 255)),
+  m_rgba16f(m_size, 0),
+  m_rgb565(m_size + 1, 0),
+  m_rgba4444(m_size + 1, 0)
+{
+	if (n == 0)
+		return;
+
+	if (interpolation == classes)
+	{
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			m_rgba[4 * i + 0] = colors[3 * i + 0];
+			m_rgba[4 * i + 1] = colors[3 * i + 1];
+			m_rgba[4 * i + 2] = colors[3 * i + 2];
+		}
+
+		packEntries();
+		return;
+	}
+
+	std::vector<float> converted;
+	if (!stops)
+	{
+		converted.resize(3 * n);
+		for (unsigned int k = 0; k < n; ++k)
+			toSpace(colors + 3 * k, &converted[3 * k], interpolation);
+
+		stops = converted.data();
+	}
+
+	// entries are interpolated as structure of arrays and converted back in one batch
+	std::vector<float> planes(3 * m_size);
+	float *channels[3] = { planes.data(), planes.data() + m_size, planes.data() + 2 * m_size };
+
+	for (unsigned int i = 0; i < m_size; ++i)
+	{
+		if (n == 1)
+		{
+			for (int c = 0; c < 3; ++c)
+				channels[c][i] = stops[c];
+			continue;
+		}
+
+		// position between the stops, the last entry hits the last stop exactly
+		float pos = static_cast<float>(i) * static_cast<float>(n - 1) / static_cast<float>(m_size - 1);
+		unsigned int k = static_cast<unsigned int>(pos);
+		if (k > n - 2)
+			k = n - 2;
+		float w = pos - static_cast<float>(k);
+
+		const float *a = &stops[3 * k];
+		const float *b = &stops[3 * (k + 1)];
+
+		for (int c = 0; c < 3; ++c)
+			channels[c][i] = a[c] + w * (b[c] - a[c]);
+	}
+
+	fromSpace(channels, m_size, interpolation);
+
+	for (unsigned int i = 0; i < m_size; ++i)
+	{
+		for (int c = 0; c < 3; ++c)
+			m_rgba[4 * i + c] = channels[c][i];
+	}
+
+	packEntries();
+}
+
+void ColorLut::packEntries()
+{
+	for (unsigned int i = 0; i < m_size; ++i)
+	{
+		const float *entry = &m_rgba[4 * i];
+		unsigned char r = toByte(entry[0]);
+		unsigned char g = toByte(entry[1]);
+		unsigned char b = toByte(entry[2]);
+		unsigned char a = toByte(entry[3]);
+
+		m_rgba8[i] = ColorBrewer::pack(r, g, b, a);
+		m_bgra8[i] = ColorBrewer::pack(b, g, r, a);
+	}
+
+	PixelFormat::encode(m_rgba.data(), m_size, m_rgba16f.data(), ColorMapper::rgba16f);
+	PixelFormat::encode(m_rgba.data(), m_size, m_rgb565.data(), ColorMapper::rgb565);
+	PixelFormat::encode(m_rgba.data(), m_size, m_rgba4444.data(), ColorMapper::rgba4444);
+}
+
+std::shared_ptr<const ColorLut> ColorLut::get(ColorBrewer::Diverging name, unsigned int size, Interpolation interpolation, int n)
+{
+	return get(ColorBrewer::diverging, name, size, interpolation, n);
+}
+
+std::shared_ptr<const ColorLut> ColorLut::get(ColorBrewer::Sequential name, unsigned int size, Interpolation interpolation, int n)
+{
+	return get(ColorBrewer::sequential, name, size, interpolation, n);
+}
+
+std::shared_ptr<const ColorLut> ColorLut::getClasses(ColorBrewer::Family family, int name, int n)
+{
+	return get(family, name, n, classes, n);
+}
+
+std::shared_ptr<const ColorLut> ColorLut::getFallback()
+{
+	static const float colors[6] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+	static const std::shared_ptr<const ColorLut> lut = std::make_shared<ColorLut>(colors, 2, 2);
+
+	return lut;
+}
+
+std::shared_ptr<const ColorLut> ColorLut::get(ColorBrewer::Family family, int name, unsigned int size, Interpolation interpolation, int n)
+{
+	static std::mutex cacheMutex;
+	static std::map<unsigned long long, std::shared_ptr<const ColorLut> > cache;
+
+	if (n == 0)
+		n = ColorBrewer::getMaxClasses(family, name);
+
+	if (interpolation == classes)
+		size = n;
+
+	const PaletteRegistry &registry = PaletteRegistry::builtin();
+	ColorBrewer::ColorView view = registry.getView(family, name, n);
+	if (view.empty())
+		return std::shared_ptr<const ColorLut>();
+
+	// the registry holds the perceptual copies of the stops
+	const float *stops = nullptr;
+	if (interpolation == lab)
+		stops = registry.getLabView(family, name, n).rgb;
+	else if (interpolation == oklab)
+		stops = registry.getOklabView(family, name, n).rgb;
+
+	// family, name, n and interpolation fit into 16 bits next to the size
+	unsigned long long key = (static_cast<unsigned long long>(family) << 46) | (static_cast<unsigned long long>(name) << 40) |
+		(static_cast<unsigned long long>(n) << 36) | (static_cast<unsigned long long>(interpolation) << 32) | size;
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	std::map<unsigned long long, std::shared_ptr<const ColorLut> >::iterator it = cache.find(key);
+	if (it != cache.end())
+		return it->second;
+
+	if (cache.size() >= maxCachedTables)
+	{
+		for (it = cache.begin(); it != cache.end();)
+		{
+			if (it->second.use_count() == 1)
+				it = cache.erase(it);
+			else
+				++it;
+		}
+	}
+
+	std::shared_ptr<const ColorLut> lut = std::make_shared<ColorLut>(view.rgb, view.n, size, interpolation, stops);
+
+	// all slots in use elsewhere, the table is not cached
+	if (cache.size() < maxCachedTables)
+		cache[key] = lut;
+
+	return lut;
+}
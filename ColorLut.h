@@ -0,0 +1,103 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef COLORLUT
+#define COLORLUT
+
+#include "ColorBrewer.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+**  Dense lookup table interpolated between the colors of a diverging or sequential scheme.
+**  Entries are normalized rgba, packed 8 bit rgba/bgra, half float rgba and rgb565/rgba4444, entry i corresponds to
+**  t = i / (size - 1).
+**
+**	Interpolation: rgb (sRGB), linearRgb, lab (CIELAB), oklab (OKLab)
+**	               classes: one entry per color of the scheme, t in [0, 1] is split into n bins of equal width
+**
+**	Usage:
+**  std::shared_ptr<const ColorLut> lut = ColorLut::get(ColorBrewer::Sequential::YlOrRd, 1024, ColorLut::lab);
+**	const float *rgba = lut->color(t);
+**
+**/
+
+
+class ColorLut
+{
+
+public:
+	enum Interpolation
+	{
+		rgb, linearRgb, lab, classes, oklab
+	};
+
+
+public:
+	// build from n normalized rgb stops, size >= 2; size is n for classes. stops optionally holds the colors already
+	// converted to the interpolation space, e.g. from PaletteRegistry::getLabView()
+	ColorLut(const float *colors, unsigned int n, unsigned int size, Interpolation interpolation = rgb, const float *stops = nullptr);
+
+	// cached tables, shared by all callers; n = 0 uses the largest number of classes of the scheme. The cache keeps at
+	// most 256 tables and drops the ones no caller holds once it is full
+	static std::shared_ptr<const ColorLut> get(ColorBrewer::Diverging name, unsigned int size = 256, Interpolation interpolation = rgb, int n = 0);
+	static std::shared_ptr<const ColorLut> get(ColorBrewer::Sequential name, unsigned int size = 256, Interpolation interpolation = rgb, int n = 0);
+	static std::shared_ptr<const ColorLut> get(ColorBrewer::Family family, int name, unsigned int size, Interpolation interpolation, int n);
+
+	// cached table with the n colors of any scheme as equal width classes
+	static std::shared_ptr<const ColorLut> getClasses(ColorBrewer::Family family, int name, int n);
+
+	// black to white, stands in for a missing table
+	static std::shared_ptr<const ColorLut> getFallback();
+
+	unsigned int size() const { return m_size; }
+	Interpolation interpolation() const { return m_interpolation; }
+
+	// index(t) = clamp(t * scale() + bias(), 0, size() - 1), truncated
+	float scale() const { return m_scale; }
+	float bias() const { return m_bias; }
+
+	// rgba entries, 4 * size() floats
+	const float *data() const { return m_rgba.data(); }
+
+	// packed 8 bit entries, see ColorBrewer::pack()
+	const std::uint32_t *rgba8() const { return m_rgba8.data(); }
+	const std::uint32_t *bgra8() const { return m_bgra8.data(); }
+
+	// half float and 16 bit entries, see PixelFormat; the 16 bit tables hold one padding entry for 32 bit gathers
+	const std::uint64_t *rgba16f() const { return m_rgba16f.data(); }
+	const std::uint16_t *rgb565() const { return m_rgb565.data(); }
+	const std::uint16_t *rgba4444() const { return m_rgba4444.data(); }
+
+	// nearest entry for t in [0, 1], values outside are clamped and NaN maps to the first entry
+	unsigned int index(float t) const
+	{
+		float x = t * m_scale + m_bias;
+		x = x > 0.0f ? x : 0.0f;
+		x = x < m_maxIndex ? x : m_maxIndex;
+		return static_cast<unsigned int>(x);
+	}
+
+	const float *color(float t) const { return &m_rgba[4 * index(t)]; }
+
+
+private:
+	void packEntries();
+
+	unsigned int m_size;
+	float m_scale;
+	float m_bias;
+	float m_maxIndex;
+	Interpolation m_interpolation;
+
+	std::vector<float> m_rgba;
+	std::vector<std::uint32_t> m_rgba8;
+	std::vector<std::uint32_t> m_bgra8;
+	std::vector<std::uint64_t> m_rgba16f;
+	std::vector<std::uint16_t> m_rgb565;
+	std::vector<std::uint16_t> m_rgba4444;
+};
+
+
+#endif
@@ -0,0 +1,382 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "ColorMapper.h"
+#include <cstring>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define COLORMAPPER_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#define COLORMAPPER_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(COLORMAPPER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define COLORMAPPER_TARGET(isa) __attribute__((target(isa)))
+#else
+#define COLORMAPPER_TARGET(isa)
+#endif
+
+#ifdef _MSC_VER
+#define COLORMAPPER_ALIGN(n) __declspec(align(n))
+#else
+#define COLORMAPPER_ALIGN(n) __attribute__((aligned(n)))
+#endif
+
+
+namespace
+{
+	struct Kernel
+	{
+		const float *lut;
+		const std::uint32_t *rgba8;
+		const std::uint32_t *bgra8;
+		const std::uint64_t *rgba16f;
+		const std::uint16_t *rgb565;
+		const std::uint16_t *rgba4444;
+		float scale;
+		float bias;
+		float maxIndex;
+	};
+
+	typedef void (*KernelFunction)(const Kernel &k, const float *values, std::size_t count, unsigned char *out);
+
+	template <ColorMapper::Format F>
+	struct PixelSize
+	{
+		static const std::size_t value = ColorMapper::rgb == F ? 12 : (ColorMapper::rgba == F ? 16 : (ColorMapper::rgb8 == F ? 3 :
+			(ColorMapper::rgba16f == F ? 8 : (ColorMapper::rgb565 == F || ColorMapper::rgba4444 == F ? 2 : 4))));
+	};
+
+	// exact copy of one pixel
+	template <ColorMapper::Format F>
+	inline void storePixel(const Kernel &k, unsigned int idx, unsigned char *out)
+	{
+		switch (F)
+		{
+		case ColorMapper::rgb:
+			std::memcpy(out, k.lut + 4 * idx, 12);
+			break;
+		case ColorMapper::rgba:
+			std::memcpy(out, k.lut + 4 * idx, 16);
+			break;
+		case ColorMapper::rgb8:
+			std::memcpy(out, k.rgba8 + idx, 3);
+			break;
+		case ColorMapper::rgba8:
+			std::memcpy(out, k.rgba8 + idx, 4);
+			break;
+		case ColorMapper::bgra8:
+			std::memcpy(out, k.bgra8 + idx, 4);
+			break;
+		case ColorMapper::rgba16f:
+			std::memcpy(out, k.rgba16f + idx, 8);
+			break;
+		case ColorMapper::rgb565:
+			std::memcpy(out, k.rgb565 + idx, 2);
+			break;
+		case ColorMapper::rgba4444:
+			std::memcpy(out, k.rgba4444 + idx, 2);
+			break;
+		}
+	}
+
+	// full width copy of the rgba entry, rgb formats overwrite the start of the next pixel,
+	// so the vector loops leave the last pixel of a batch to the scalar tail
+	template <ColorMapper::Format F>
+	inline void storePixelWide(const Kernel &k, unsigned int idx, unsigned char *out)
+	{
+		if (F == ColorMapper::rgb || F == ColorMapper::rgba)
+			std::memcpy(out, k.lut + 4 * idx, 16);
+		else if (F == ColorMapper::bgra8)
+			std::memcpy(out, k.bgra8 + idx, 4);
+		else if (F == ColorMapper::rgba16f || F == ColorMapper::rgb565 || F == ColorMapper::rgba4444)
+			storePixel<F>(k, idx, out);
+		else
+			std::memcpy(out, k.rgba8 + idx, 4);
+	}
+
+	inline unsigned int scalarIndex(const Kernel &k, float value)
+	{
+		float x = value * k.scale + k.bias;
+		x = x > 0.0f ? x : 0.0f;
+		x = x < k.maxIndex ? x : k.maxIndex;
+		return static_cast<unsigned int>(x);
+	}
+
+	template <ColorMapper::Format F>
+	void mapScalar(const Kernel &k, const float *values, std::size_t count, unsigned char *out)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			storePixel<F>(k, scalarIndex(k, values[i]), out + PixelSize<F>::value * i);
+	}
+
+	inline std::size_t vectorEnd(std::size_t count)
+	{
+		return count > 0 ? count - 1 : 0;
+	}
+
+#ifdef COLORMAPPER_X86
+	template <ColorMapper::Format F>
+	COLORMAPPER_TARGET("sse4.1")
+	void mapSse41(const Kernel &k, const float *values, std::size_t count, unsigned char *out)
+	{
+		const __m128 scale = _mm_set1_ps(k.scale);
+		const __m128 bias = _mm_set1_ps(k.bias);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 maxIndex = _mm_set1_ps(k.maxIndex);
+		const std::size_t p = PixelSize<F>::value;
+
+		std::size_t i = 0;
+		for (std::size_t end = vectorEnd(count); i + 4 <= end; i += 4)
+		{
+			__m128 x = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(values + i), scale), bias);
+			x = _mm_min_ps(_mm_max_ps(x, zero), maxIndex);
+			__m128i idx = _mm_cvttps_epi32(x);
+
+			unsigned char *o = out + p * i;
+			storePixelWide<F>(k, _mm_extract_epi32(idx, 0), o);
+			storePixelWide<F>(k, _mm_extract_epi32(idx, 1), o + p);
+			storePixelWide<F>(k, _mm_extract_epi32(idx, 2), o + 2 * p);
+			storePixelWide<F>(k, _mm_extract_epi32(idx, 3), o + 3 * p);
+		}
+
+		mapScalar<F>(k, values + i, count - i, out + p * i);
+	}
+
+	template <ColorMapper::Format F>
+	COLORMAPPER_TARGET("avx2")
+	void mapAvx2(const Kernel &k, const float *values, std::size_t count, unsigned char *out)
+	{
+		const __m256 scale = _mm256_set1_ps(k.scale);
+		const __m256 bias = _mm256_set1_ps(k.bias);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 maxIndex = _mm256_set1_ps(k.maxIndex);
+		const std::size_t p = PixelSize<F>::value;
+		const int *packed = reinterpret_cast<const int *>(F == ColorMapper::bgra8 ? k.bgra8 : k.rgba8);
+
+		std::size_t i = 0;
+		for (std::size_t end = vectorEnd(count); i + 8 <= end; i += 8)
+		{
+			__m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(values + i), scale), bias);
+			x = _mm256_min_ps(_mm256_max_ps(x, zero), maxIndex);
+			__m256i idx = _mm256_cvttps_epi32(x);
+
+			unsigned char *o = out + p * i;
+
+			// packed 32 bit pixels are gathered and written as one block
+			if (F == ColorMapper::rgba8 || F == ColorMapper::bgra8)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(o), _mm256_i32gather_epi32(packed, idx, 4));
+				continue;
+			}
+
+			// 16 bit pixels are gathered as 32 bits, the padding entry covers the last one, and narrowed
+			if (F == ColorMapper::rgb565 || F == ColorMapper::rgba4444)
+			{
+				const int *table = reinterpret_cast<const int *>(F == ColorMapper::rgb565 ? k.rgb565 : k.rgba4444);
+				__m256i v = _mm256_and_si256(_mm256_i32gather_epi32(table, idx, 2), _mm256_set1_epi32(0xffff));
+				__m128i narrow = _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(o), narrow);
+				continue;
+			}
+
+			if (F == ColorMapper::rgba16f)
+			{
+				const long long *table = reinterpret_cast<const long long *>(k.rgba16f);
+				__m256i lo = _mm256_i32gather_epi64(table, _mm256_castsi256_si128(idx), 8);
+				__m256i hi = _mm256_i32gather_epi64(table, _mm256_extracti128_si256(idx, 1), 8);
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(o), lo);
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(o + 32), hi);
+				continue;
+			}
+
+			COLORMAPPER_ALIGN(32) unsigned int lanes[8];
+			_mm256_store_si256(reinterpret_cast<__m256i *>(lanes), idx);
+
+			for (int j = 0; j < 8; ++j)
+				storePixelWide<F>(k, lanes[j], o + j * p);
+		}
+
+		mapScalar<F>(k, values + i, count - i, out + p * i);
+	}
+#endif
+
+#ifdef COLORMAPPER_NEON
+	template <ColorMapper::Format F>
+	void mapNeon(const Kernel &k, const float *values, std::size_t count, unsigned char *out)
+	{
+		const float32x4_t scale = vdupq_n_f32(k.scale);
+		const float32x4_t bias = vdupq_n_f32(k.bias);
+		const float32x4_t zero = vdupq_n_f32(0.0f);
+		const float32x4_t maxIndex = vdupq_n_f32(k.maxIndex);
+		const std::size_t p = PixelSize<F>::value;
+
+		std::size_t i = 0;
+		for (std::size_t end = vectorEnd(count); i + 4 <= end; i += 4)
+		{
+			float32x4_t x = vaddq_f32(vmulq_f32(vld1q_f32(values + i), scale), bias);
+
+			// select instead of vmaxq so NaN maps to zero like the scalar path
+			x = vbslq_f32(vcgtq_f32(x, zero), x, zero);
+			x = vminq_f32(x, maxIndex);
+			uint32x4_t idx = vcvtq_u32_f32(x);
+
+			unsigned char *o = out + p * i;
+			storePixelWide<F>(k, vgetq_lane_u32(idx, 0), o);
+			storePixelWide<F>(k, vgetq_lane_u32(idx, 1), o + p);
+			storePixelWide<F>(k, vgetq_lane_u32(idx, 2), o + 2 * p);
+			storePixelWide<F>(k, vgetq_lane_u32(idx, 3), o + 3 * p);
+		}
+
+		mapScalar<F>(k, values + i, count - i, out + p * i);
+	}
+#endif
+
+	template <ColorMapper::Format F>
+	KernelFunction selectKernel(ColorMapper::Isa isa)
+	{
+		switch (isa)
+		{
+#ifdef COLORMAPPER_X86
+		case ColorMapper::avx2:
+			return &mapAvx2<F>;
+		case ColorMapper::sse41:
+			return &mapSse41<F>;
+#endif
+#ifdef COLORMAPPER_NEON
+		case ColorMapper::neon:
+			return &mapNeon<F>;
+#endif
+		default:
+			return &mapScalar<F>;
+		}
+	}
+
+	KernelFunction selectKernel(ColorMapper::Isa isa, ColorMapper::Format format)
+	{
+		switch (format)
+		{
+		case ColorMapper::rgba:
+			return selectKernel<ColorMapper::rgba>(isa);
+		case ColorMapper::rgb8:
+			return selectKernel<ColorMapper::rgb8>(isa);
+		case ColorMapper::rgba8:
+			return selectKernel<ColorMapper::rgba8>(isa);
+		case ColorMapper::bgra8:
+			return selectKernel<ColorMapper::bgra8>(isa);
+		case ColorMapper::rgba16f:
+			return selectKernel<ColorMapper::rgba16f>(isa);
+		case ColorMapper::rgb565:
+			return selectKernel<ColorMapper::rgb565>(isa);
+		case ColorMapper::rgba4444:
+			return selectKernel<ColorMapper::rgba4444>(isa);
+		default:
+			return selectKernel<ColorMapper::rgb>(isa);
+		}
+	}
+}
+
+
+ColorMapper::ColorMapper(std::shared_ptr<const ColorLut> lut, float minValue, float maxValue)
+: m_lut(lut),
+  m_scale(0.0f),
+  m_bias(0.0f),
+  m_isa(detectIsa())
+{
+	if (!m_lut)
+	{
+		std::cout << "ColorMapper::ColorMapper(): No color table available, using black to white.";
+		m_lut = ColorLut::getFallback();
+	}
+
+	setRange(minValue, maxValue);
+}
+
+void ColorMapper::setRange(float minValue, float maxValue)
+{
+	// an empty range maps everything to t = 0
+	float range = maxValue - minValue;
+	float invRange = range != 0.0f ? 1.0f / range : 0.0f;
+
+	m_scale = invRange * m_lut->scale();
+	m_bias = m_lut->bias() - minValue * m_scale;
+}
+
+void ColorMapper::setIsa(Isa isa)
+{
+	Isa best = detectIsa();
+
+	if (isa == neon)
+		m_isa = best == neon ? neon : scalar;
+	else if (best == neon)
+		m_isa = scalar;
+	else
+		m_isa = isa < best ? isa : best;
+}
+
+ColorMapper::Isa ColorMapper::detectIsa()
+{
+#if defined(COLORMAPPER_NEON)
+	return neon;
+#elif defined(COLORMAPPER_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool hasSse41 = (info[2] & (1 << 19)) != 0;
+	bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+	bool hasAvx2 = false;
+
+	if (maxLeaf >= 7 && hasOsxsave && (_xgetbv(0) & 6) == 6)
+	{
+		__cpuidex(info, 7, 0);
+		hasAvx2 = (info[1] & (1 << 5)) != 0;
+	}
+
+	return hasAvx2 ? avx2 : (hasSse41 ? sse41 : scalar);
+#elif defined(COLORMAPPER_X86)
+	if (__builtin_cpu_supports("avx2"))
+		return avx2;
+	if (__builtin_cpu_supports("sse4.1"))
+		return sse41;
+	return scalar;
+#else
+	return scalar;
+#endif
+}
+
+std::size_t ColorMapper::pixelSize(Format format)
+{
+	switch (format)
+	{
+	case rgba:
+		return 16;
+	case rgb8:
+		return 3;
+	case rgba8:
+	case bgra8:
+		return 4;
+	case rgba16f:
+		return 8;
+	case rgb565:
+	case rgba4444:
+		return 2;
+	default:
+		return 12;
+	}
+}
+
+void ColorMapper::map(const float *values, std::size_t count, void *out, Format format) const
+{
+	Kernel k = { m_lut->data(), m_lut->rgba8(), m_lut->bgra8(), m_lut->rgba16f(), m_lut->rgb565(), m_lut->rgba4444(), m_scale, m_bias, static_cast<float>(m_lut->size() - 1) };
+
+	selectKernel(m_isa, format)(k, values, count, static_cast<unsigned char *>(out));
+}
@@ -0,0 +1,77 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef COLORMAPPER
+#define COLORMAPPER
+
+#include "ColorLut.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+**  Batch mapping of scalar values to colors through a ColorLut.
+**  Values are mapped linearly from [minValue, maxValue] to [0, 1], values outside are clamped and NaN maps to the first entry.
+**  The kernel is selected at runtime: AVX2, SSE4.1 or NEON where available, scalar otherwise.
+**
+**	Formats: rgb, rgba (normalized floats)
+**	         rgb8 (3 bytes), rgba8, bgra8 (one std::uint32_t with the bytes in that order in memory)
+**	         rgba16f (4 half floats), rgb565, rgba4444 (one std::uint16_t), see PixelFormat
+**
+**	Usage:
+**  ColorMapper mapper(ColorLut::get(ColorBrewer::Sequential::Blues, 1024), 0.0f, 100.0f);
+**	mapper.map(values, count, rgb, ColorMapper::rgb);
+**
+**/
+
+
+class ColorMapper
+{
+
+public:
+	enum Format
+	{
+		rgb, rgba, rgb8, rgba8, bgra8, rgba16f, rgb565, rgba4444
+	};
+
+	enum Isa
+	{
+		scalar, sse41, avx2, neon
+	};
+
+
+public:
+	ColorMapper(std::shared_ptr<const ColorLut> lut, float minValue = 0.0f, float maxValue = 1.0f);
+
+	void setRange(float minValue, float maxValue);
+
+	// restrict the kernel, falls back to the best supported one below the requested level
+	void setIsa(Isa isa);
+	Isa getIsa() const { return m_isa; }
+
+	// best kernel supported by the cpu
+	static Isa detectIsa();
+
+	static std::size_t channels(Format format) { return format == rgb || format == rgb8 || format == rgb565 ? 3 : 4; }
+
+	// bytes written per value
+	static std::size_t pixelSize(Format format);
+
+	// writes pixelSize(format) bytes per value to out
+	void map(const float *values, std::size_t count, void *out, Format format = rgb) const;
+
+	const ColorLut &lut() const { return *m_lut; }
+
+
+private:
+	std::shared_ptr<const ColorLut> m_lut;
+
+	// index = clamp(value * m_scale + m_bias, 0, size - 1)
+	float m_scale;
+	float m_bias;
+
+	Isa m_isa;
+};
+
+
+#endif
@@ -0,0 +1,699 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "ColorSpace.h"
+#include "ColorMapper.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define COLORSPACE_X86
+#include <immintrin.h>
+#endif
+
+#if defined(COLORSPACE_X86) && (defined(__GNUC__) || defined(__clang__))
+#define COLORSPACE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define COLORSPACE_TARGET(isa)
+#endif
+
+
+namespace
+{
+	// D65 reference white
+	const float whiteX = 0.95047f;
+	const float whiteY = 1.0f;
+	const float whiteZ = 1.08883f;
+
+	const float labEpsilon = 216.0f / 24389.0f; // (6/29)^3
+	const float labKappa = 24389.0f / 27.0f;    // (29/3)^3
+
+	float labF(float t)
+	{
+		return t > labEpsilon ? std::cbrt(t) : (labKappa * t + 16.0f) / 116.0f;
+	}
+
+	float labInvF(float f)
+	{
+		float t = f * f * f;
+		return t > labEpsilon ? t : (116.0f * f - 16.0f) / labKappa;
+	}
+
+	const float white[3] = { whiteX, whiteY, whiteZ };
+	const float invWhite[3] = { 1.0f / whiteX, 1.0f / whiteY, 1.0f / whiteZ };
+	const float noOffset[3] = { 0.0f, 0.0f, 0.0f };
+
+	// row major 3x3 matrices, linear RGB to CIEXYZ and back
+	const float rgbToXyz[9] =
+	{
+		0.4124564f, 0.3575761f, 0.1804375f,
+		0.2126729f, 0.7151522f, 0.0721750f,
+		0.0193339f, 0.1191920f, 0.9503041f
+	};
+
+	const float xyzToRgb[9] =
+	{
+		 3.2404542f, -1.5371385f, -0.4985314f,
+		-0.9692660f,  1.8760108f,  0.0415560f,
+		 0.0556434f, -0.2040259f,  1.0572252f
+	};
+
+	// (f(X / Xn), f(Y / Yn), f(Z / Zn)) to CIELAB and back
+	const float fToLab[9] =
+	{
+		  0.0f, 116.0f,    0.0f,
+		500.0f, -500.0f,   0.0f,
+		  0.0f, 200.0f, -200.0f
+	};
+
+	const float fToLabOffset[3] = { -16.0f, 0.0f, 0.0f };
+
+	const float labToF[9] =
+	{
+		1.0f / 116.0f, 1.0f / 500.0f, 0.0f,
+		1.0f / 116.0f, 0.0f,          0.0f,
+		1.0f / 116.0f, 0.0f,          -1.0f / 200.0f
+	};
+
+	const float labToFOffset[3] = { 16.0f / 116.0f, 16.0f / 116.0f, 16.0f / 116.0f };
+
+	// OKLab (Ottosson 2020): linear RGB to cone responses, cube root, then to Lab
+	const float rgbToLms[9] =
+	{
+		0.4122214708f, 0.5363325363f, 0.0514459929f,
+		0.2119034982f, 0.6806995451f, 0.1073969566f,
+		0.0883024619f, 0.2817188376f, 0.6299787005f
+	};
+
+	const float lmsToOklab[9] =
+	{
+		0.2104542553f,  0.7936177850f, -0.0040720468f,
+		1.9779984951f, -2.4285922050f,  0.4505937099f,
+		0.0259040371f,  0.7827717662f, -0.8086757660f
+	};
+
+	const float oklabToLms[9] =
+	{
+		1.0f,  0.3963377774f,  0.2158037573f,
+		1.0f, -0.1055613458f, -0.0638541728f,
+		1.0f, -0.0894841775f, -1.2914855480f
+	};
+
+	const float lmsToRgb[9] =
+	{
+		 4.0767416621f, -3.3077115913f,  0.2309699292f,
+		-1.2684380046f,  2.6097574011f, -0.3413193965f,
+		-0.0042119922f, -0.7034186147f,  1.7076109318f
+	};
+
+	void multiply(const float *m, const float *v, float *out)
+	{
+		float x = v[0];
+		float y = v[1];
+		float z = v[2];
+
+		out[0] = m[0] * x + m[1] * y + m[2] * z;
+		out[1] = m[3] * x + m[4] * y + m[5] * z;
+		out[2] = m[6] * x + m[7] * y + m[8] * z;
+	}
+
+
+	// colors per block of the chained batch conversions
+	const std::size_t blockSize = 256;
+
+	// intervals of the transfer tables over [0, 1]
+	const int transferSize = 4096;
+
+	struct TransferTables
+	{
+		float toLinear[transferSize + 1];
+		float toSrgb[transferSize + 1];
+		float byteToLinear[256];
+
+		TransferTables()
+		{
+			for (int i = 0; i <= transferSize; ++i)
+			{
+				double x = static_cast<double>(i) / transferSize;
+				toLinear[i] = static_cast<float>(x <= 0.04045 ? x / 12.92 : std::pow((x + 0.055) / 1.055, 2.4));
+				toSrgb[i] = static_cast<float>(x <= 0.0031308 ? 12.92 * x : 1.055 * std::pow(x, 1.0 / 2.4) - 0.055);
+			}
+
+			for (int i = 0; i < 256; ++i)
+			{
+				double x = i / 255.0;
+				byteToLinear[i] = static_cast<float>(x <= 0.04045 ? x / 12.92 : std::pow((x + 0.055) / 1.055, 2.4));
+			}
+		}
+	};
+
+	const TransferTables &getTables()
+	{
+		static const TransferTables tables;
+		return tables;
+	}
+
+	bool hasAvx2()
+	{
+		static const bool avx2 = ColorMapper::detectIsa() == ColorMapper::avx2;
+		return avx2;
+	}
+
+
+	// The scalar kernels run from index begin, the AVX2 kernels hand their tail to them. Both evaluate the same
+	// operations in the same order, so the results do not depend on the kernel.
+
+	// cube root of x > 0: exponent divided by 3 as first guess, then two Halley steps
+	float cubeRoot(float x)
+	{
+		std::int32_t bits;
+		std::memcpy(&bits, &x, sizeof(bits));
+		bits = static_cast<std::int32_t>(static_cast<float>(bits) * (1.0f / 3.0f)) + 709921077;
+
+		float y;
+		std::memcpy(&y, &bits, sizeof(y));
+
+		for (int i = 0; i < 2; ++i)
+		{
+			float y3 = y * y * y;
+			y = y * (y3 + x + x) / (y3 + y3 + x);
+		}
+
+		return y;
+	}
+
+	void transferScalar(const float *table, const float *in, float *out, std::size_t begin, std::size_t count)
+	{
+		for (std::size_t i = begin; i < count; ++i)
+		{
+			float x = in[i] > 0.0f ? (in[i] < 1.0f ? in[i] : 1.0f) : 0.0f;
+			float position = x * static_cast<float>(transferSize);
+
+			int k = static_cast<int>(position);
+			k = k < transferSize - 1 ? k : transferSize - 1;
+
+			float w = position - static_cast<float>(k);
+			out[i] = table[k] + w * (table[k + 1] - table[k]);
+		}
+	}
+
+	void affineScalar(const float *m, const float *offset, const float *const in[3], float *const out[3], std::size_t begin, std::size_t count)
+	{
+		for (std::size_t i = begin; i < count; ++i)
+		{
+			float x = in[0][i];
+			float y = in[1][i];
+			float z = in[2][i];
+
+			out[0][i] = m[0] * x + m[1] * y + m[2] * z + offset[0];
+			out[1][i] = m[3] * x + m[4] * y + m[5] * z + offset[1];
+			out[2][i] = m[6] * x + m[7] * y + m[8] * z + offset[2];
+		}
+	}
+
+	void labFScalar(const float *in, float *out, float scale, std::size_t begin, std::size_t count)
+	{
+		for (std::size_t i = begin; i < count; ++i)
+		{
+			float t = in[i] * scale;
+			out[i] = t > labEpsilon ? cubeRoot(t) : (labKappa * t + 16.0f) * (1.0f / 116.0f);
+		}
+	}
+
+	void labInvFScalar(const float *in, float *out, float scale, std::size_t begin, std::size_t count)
+	{
+		for (std::size_t i = begin; i < count; ++i)
+		{
+			float f = in[i];
+			float t = f * f * f;
+			out[i] = (t > labEpsilon ? t : (116.0f * f - 16.0f) * (1.0f / labKappa)) * scale;
+		}
+	}
+
+	// signed cube root, cone responses of colors outside the gamut can be negative
+	void cubeRootsScalar(const float *in, float *out, std::size_t begin, std::size_t count)
+	{
+		for (std::size_t i = begin; i < count; ++i)
+		{
+			float x = std::fabs(in[i]);
+			float y = x > 0.0f ? cubeRoot(x) : 0.0f;
+			out[i] = in[i] < 0.0f ? -y : y;
+		}
+	}
+
+	void cubesScalar(const float *in, float *out, std::size_t begin, std::size_t count)
+	{
+		for (std::size_t i = begin; i < count; ++i)
+			out[i] = in[i] * in[i] * in[i];
+	}
+
+#ifdef COLORSPACE_X86
+	COLORSPACE_TARGET("avx2")
+	__m256 cubeRootAvx2(__m256 x)
+	{
+		const __m256 third = _mm256_set1_ps(1.0f / 3.0f);
+		const __m256i magic = _mm256_set1_epi32(709921077);
+
+		__m256i bits = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(x)), third));
+		__m256 y = _mm256_castsi256_ps(_mm256_add_epi32(bits, magic));
+
+		for (int i = 0; i < 2; ++i)
+		{
+			__m256 y3 = _mm256_mul_ps(_mm256_mul_ps(y, y), y);
+			y = _mm256_div_ps(_mm256_mul_ps(y, _mm256_add_ps(_mm256_add_ps(y3, x), x)), _mm256_add_ps(_mm256_add_ps(y3, y3), x));
+		}
+
+		return y;
+	}
+
+	// clamp to [0, 1], NaN becomes 0, then interpolate between two gathered entries
+	COLORSPACE_TARGET("avx2")
+	void transferAvx2(const float *table, const float *in, float *out, std::size_t count)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 size = _mm256_set1_ps(static_cast<float>(transferSize));
+		const __m256i last = _mm256_set1_epi32(transferSize - 1);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(in + i), zero), one);
+			__m256 position = _mm256_mul_ps(x, size);
+
+			__m256i k = _mm256_min_epi32(_mm256_cvttps_epi32(position), last);
+			__m256 w = _mm256_sub_ps(position, _mm256_cvtepi32_ps(k));
+
+			__m256 a = _mm256_i32gather_ps(table, k, 4);
+			__m256 b = _mm256_i32gather_ps(table + 1, k, 4);
+			_mm256_storeu_ps(out + i, _mm256_add_ps(a, _mm256_mul_ps(w, _mm256_sub_ps(b, a))));
+		}
+
+		transferScalar(table, in, out, i, count);
+	}
+
+	COLORSPACE_TARGET("avx2")
+	void affineAvx2(const float *m, const float *offset, const float *const in[3], float *const out[3], std::size_t count)
+	{
+		__m256 rows[9];
+		for (int k = 0; k < 9; ++k)
+			rows[k] = _mm256_set1_ps(m[k]);
+
+		const __m256 o0 = _mm256_set1_ps(offset[0]);
+		const __m256 o1 = _mm256_set1_ps(offset[1]);
+		const __m256 o2 = _mm256_set1_ps(offset[2]);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x = _mm256_loadu_ps(in[0] + i);
+			__m256 y = _mm256_loadu_ps(in[1] + i);
+			__m256 z = _mm256_loadu_ps(in[2] + i);
+
+			__m256 r0 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rows[0], x), _mm256_mul_ps(rows[1], y)), _mm256_mul_ps(rows[2], z)), o0);
+			__m256 r1 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rows[3], x), _mm256_mul_ps(rows[4], y)), _mm256_mul_ps(rows[5], z)), o1);
+			__m256 r2 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rows[6], x), _mm256_mul_ps(rows[7], y)), _mm256_mul_ps(rows[8], z)), o2);
+
+			_mm256_storeu_ps(out[0] + i, r0);
+			_mm256_storeu_ps(out[1] + i, r1);
+			_mm256_storeu_ps(out[2] + i, r2);
+		}
+
+		affineScalar(m, offset, in, out, i, count);
+	}
+
+	COLORSPACE_TARGET("avx2")
+	void labFAvx2(const float *in, float *out, float scale, std::size_t count)
+	{
+		const __m256 s = _mm256_set1_ps(scale);
+		const __m256 epsilon = _mm256_set1_ps(labEpsilon);
+		const __m256 kappa = _mm256_set1_ps(labKappa);
+		const __m256 sixteen = _mm256_set1_ps(16.0f);
+		const __m256 inv116 = _mm256_set1_ps(1.0f / 116.0f);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 t = _mm256_mul_ps(_mm256_loadu_ps(in + i), s);
+			__m256 above = _mm256_cmp_ps(t, epsilon, _CMP_GT_OQ);
+
+			// the root of the lanes below epsilon is discarded, keep its argument positive
+			__m256 root = cubeRootAvx2(_mm256_blendv_ps(epsilon, t, above));
+			__m256 linear = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(kappa, t), sixteen), inv116);
+
+			_mm256_storeu_ps(out + i, _mm256_blendv_ps(linear, root, above));
+		}
+
+		labFScalar(in, out, scale, i, count);
+	}
+
+	COLORSPACE_TARGET("avx2")
+	void labInvFAvx2(const float *in, float *out, float scale, std::size_t count)
+	{
+		const __m256 s = _mm256_set1_ps(scale);
+		const __m256 epsilon = _mm256_set1_ps(labEpsilon);
+		const __m256 invKappa = _mm256_set1_ps(1.0f / labKappa);
+		const __m256 sixteen = _mm256_set1_ps(16.0f);
+		const __m256 c116 = _mm256_set1_ps(116.0f);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 f = _mm256_loadu_ps(in + i);
+			__m256 t = _mm256_mul_ps(_mm256_mul_ps(f, f), f);
+			__m256 linear = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(c116, f), sixteen), invKappa);
+
+			__m256 above = _mm256_cmp_ps(t, epsilon, _CMP_GT_OQ);
+			_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_blendv_ps(linear, t, above), s));
+		}
+
+		labInvFScalar(in, out, scale, i, count);
+	}
+
+	COLORSPACE_TARGET("avx2")
+	void cubeRootsAvx2(const float *in, float *out, std::size_t count)
+	{
+		const __m256 sign = _mm256_set1_ps(-0.0f);
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 v = _mm256_loadu_ps(in + i);
+			__m256 x = _mm256_andnot_ps(sign, v);
+			__m256 positive = _mm256_cmp_ps(x, zero, _CMP_GT_OQ);
+
+			__m256 y = _mm256_and_ps(cubeRootAvx2(_mm256_blendv_ps(one, x, positive)), positive);
+			__m256 negative = _mm256_cmp_ps(v, zero, _CMP_LT_OQ);
+
+			_mm256_storeu_ps(out + i, _mm256_blendv_ps(y, _mm256_sub_ps(zero, y), negative));
+		}
+
+		cubeRootsScalar(in, out, i, count);
+	}
+
+	COLORSPACE_TARGET("avx2")
+	void cubesAvx2(const float *in, float *out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x = _mm256_loadu_ps(in + i);
+			_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_mul_ps(x, x), x));
+		}
+
+		cubesScalar(in, out, i, count);
+	}
+#endif
+
+	void transfer(const float *table, const float *in, float *out, std::size_t count)
+	{
+#ifdef COLORSPACE_X86
+		if (hasAvx2())
+		{
+			transferAvx2(table, in, out, count);
+			return;
+		}
+#endif
+		transferScalar(table, in, out, 0, count);
+	}
+
+	void affine(const float *m, const float *offset, const float *const in[3], float *const out[3], std::size_t count)
+	{
+#ifdef COLORSPACE_X86
+		if (hasAvx2())
+		{
+			affineAvx2(m, offset, in, out, count);
+			return;
+		}
+#endif
+		affineScalar(m, offset, in, out, 0, count);
+	}
+
+	void labF(const float *in, float *out, float scale, std::size_t count)
+	{
+#ifdef COLORSPACE_X86
+		if (hasAvx2())
+		{
+			labFAvx2(in, out, scale, count);
+			return;
+		}
+#endif
+		labFScalar(in, out, scale, 0, count);
+	}
+
+	void labInvF(const float *in, float *out, float scale, std::size_t count)
+	{
+#ifdef COLORSPACE_X86
+		if (hasAvx2())
+		{
+			labInvFAvx2(in, out, scale, count);
+			return;
+		}
+#endif
+		labInvFScalar(in, out, scale, 0, count);
+	}
+
+	void cubeRoots(const float *in, float *out, std::size_t count)
+	{
+#ifdef COLORSPACE_X86
+		if (hasAvx2())
+		{
+			cubeRootsAvx2(in, out, count);
+			return;
+		}
+#endif
+		cubeRootsScalar(in, out, 0, count);
+	}
+
+	void cubes(const float *in, float *out, std::size_t count)
+	{
+#ifdef COLORSPACE_X86
+		if (hasAvx2())
+		{
+			cubesAvx2(in, out, count);
+			return;
+		}
+#endif
+		cubesScalar(in, out, 0, count);
+	}
+}
+
+
+float ColorSpace::srgbToLinear(float c)
+{
+	return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+float ColorSpace::linearToSrgb(float c)
+{
+	return c <= 0.0031308f ? 12.92f * c : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+}
+
+void ColorSpace::rgbToLinear(const float *rgb, float *linear)
+{
+	for (int i = 0; i < 3; ++i)
+		linear[i] = srgbToLinear(rgb[i]);
+}
+
+void ColorSpace::linearToRgb(const float *linear, float *rgb)
+{
+	for (int i = 0; i < 3; ++i)
+		rgb[i] = linearToSrgb(linear[i]);
+}
+
+void ColorSpace::rgbToLab(const float *rgb, float *lab)
+{
+	float lin[3];
+	rgbToLinear(rgb, lin);
+
+	float x = 0.4124564f * lin[0] + 0.3575761f * lin[1] + 0.1804375f * lin[2];
+	float y = 0.2126729f * lin[0] + 0.7151522f * lin[1] + 0.0721750f * lin[2];
+	float z = 0.0193339f * lin[0] + 0.1191920f * lin[1] + 0.9503041f * lin[2];
+
+	float fx = labF(x / whiteX);
+	float fy = labF(y / whiteY);
+	float fz = labF(z / whiteZ);
+
+	lab[0] = 116.0f * fy - 16.0f;
+	lab[1] = 500.0f * (fx - fy);
+	lab[2] = 200.0f * (fy - fz);
+}
+
+void ColorSpace::labToRgb(const float *lab, float *rgb)
+{
+	float fy = (lab[0] + 16.0f) / 116.0f;
+	float fx = fy + lab[1] / 500.0f;
+	float fz = fy - lab[2] / 200.0f;
+
+	float x = whiteX * labInvF(fx);
+	float y = whiteY * labInvF(fy);
+	float z = whiteZ * labInvF(fz);
+
+	float lin[3];
+	lin[0] =  3.2404542f * x - 1.5371385f * y - 0.4985314f * z;
+	lin[1] = -0.9692660f * x + 1.8760108f * y + 0.0415560f * z;
+	lin[2] =  0.0556434f * x - 0.2040259f * y + 1.0572252f * z;
+
+	linearToRgb(lin, rgb);
+}
+
+void ColorSpace::rgbToOklab(const float *rgb, float *oklab)
+{
+	float lin[3];
+	rgbToLinear(rgb, lin);
+
+	float lms[3];
+	multiply(rgbToLms, lin, lms);
+
+	for (int i = 0; i < 3; ++i)
+		lms[i] = std::cbrt(lms[i]);
+
+	multiply(lmsToOklab, lms, oklab);
+}
+
+void ColorSpace::oklabToRgb(const float *oklab, float *rgb)
+{
+	float lms[3];
+	multiply(oklabToLms, oklab, lms);
+
+	for (int i = 0; i < 3; ++i)
+		lms[i] = lms[i] * lms[i] * lms[i];
+
+	float lin[3];
+	multiply(lmsToRgb, lms, lin);
+
+	linearToRgb(lin, rgb);
+}
+
+void ColorSpace::srgbToLinear(const float *in, float *out, std::size_t count)
+{
+	transfer(getTables().toLinear, in, out, count);
+}
+
+void ColorSpace::linearToSrgb(const float *in, float *out, std::size_t count)
+{
+	transfer(getTables().toSrgb, in, out, count);
+}
+
+void ColorSpace::srgb8ToLinear(const unsigned char *in, float *out, std::size_t count)
+{
+	const float *table = getTables().byteToLinear;
+
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = table[in[i]];
+}
+
+void ColorSpace::transform(const float *matrix, const float *const in[3], float *const out[3], std::size_t count)
+{
+	affine(matrix, noOffset, in, out, count);
+}
+
+void ColorSpace::linearToXyz(const float *const linear[3], float *const xyz[3], std::size_t count)
+{
+	affine(rgbToXyz, noOffset, linear, xyz, count);
+}
+
+void ColorSpace::xyzToLinear(const float *const xyz[3], float *const linear[3], std::size_t count)
+{
+	affine(xyzToRgb, noOffset, xyz, linear, count);
+}
+
+void ColorSpace::xyzToLab(const float *const xyz[3], float *const lab[3], std::size_t count)
+{
+	for (int c = 0; c < 3; ++c)
+		labF(xyz[c], lab[c], invWhite[c], count);
+
+	affine(fToLab, fToLabOffset, lab, lab, count);
+}
+
+void ColorSpace::labToXyz(const float *const lab[3], float *const xyz[3], std::size_t count)
+{
+	affine(labToF, labToFOffset, lab, xyz, count);
+
+	for (int c = 0; c < 3; ++c)
+		labInvF(xyz[c], xyz[c], white[c], count);
+}
+
+void ColorSpace::linearToOklab(const float *const linear[3], float *const oklab[3], std::size_t count)
+{
+	affine(rgbToLms, noOffset, linear, oklab, count);
+
+	for (int c = 0; c < 3; ++c)
+		cubeRoots(oklab[c], oklab[c], count);
+
+	affine(lmsToOklab, noOffset, oklab, oklab, count);
+}
+
+void ColorSpace::oklabToLinear(const float *const oklab[3], float *const linear[3], std::size_t count)
+{
+	affine(oklabToLms, noOffset, oklab, linear, count);
+
+	for (int c = 0; c < 3; ++c)
+		cubes(linear[c], linear[c], count);
+
+	affine(lmsToRgb, noOffset, linear, linear, count);
+}
+
+void ColorSpace::rgbToLab(const float *const rgb[3], float *const lab[3], std::size_t count)
+{
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		float *block[3] = { lab[0] + i, lab[1] + i, lab[2] + i };
+
+		for (int c = 0; c < 3; ++c)
+			srgbToLinear(rgb[c] + i, block[c], n);
+
+		linearToXyz(block, block, n);
+		xyzToLab(block, block, n);
+	}
+}
+
+void ColorSpace::labToRgb(const float *const lab[3], float *const rgb[3], std::size_t count)
+{
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		const float *in[3] = { lab[0] + i, lab[1] + i, lab[2] + i };
+		float *block[3] = { rgb[0] + i, rgb[1] + i, rgb[2] + i };
+
+		labToXyz(in, block, n);
+		xyzToLinear(block, block, n);
+
+		for (int c = 0; c < 3; ++c)
+			linearToSrgb(block[c], block[c], n);
+	}
+}
+
+void ColorSpace::rgbToOklab(const float *const rgb[3], float *const oklab[3], std::size_t count)
+{
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		float *block[3] = { oklab[0] + i, oklab[1] + i, oklab[2] + i };
+
+		for (int c = 0; c < 3; ++c)
+			srgbToLinear(rgb[c] + i, block[c], n);
+
+		linearToOklab(block, block, n);
+	}
+}
+
+void ColorSpace::oklabToRgb(const float *const oklab[3], float *const rgb[3], std::size_t count)
+{
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		const float *in[3] = { oklab[0] + i, oklab[1] + i, oklab[2] + i };
+		float *block[3] = { rgb[0] + i, rgb[1] + i, rgb[2] + i };
+
+		oklabToLinear(in, block, n);
+
+		for (int c = 0; c < 3; ++c)
+			linearToSrgb(block[c], block[c], n);
+	}
+}
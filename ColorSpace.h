@@ -0,0 +1,72 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef COLORSPACE
+#define COLORSPACE
+
+#include <cstddef>
+
+/**
+**  Color space conversions on normalized sRGB triplets in [0, 1].
+**  The batch conversions work on structure of arrays blocks, component c of color i at channels[c][i], with AVX2
+**  kernels selected at runtime and scalar loops otherwise. Chained conversions run block by block so the
+**  intermediate values stay in the L1 cache.
+**
+**	Spaces: sRGB, linear RGB, CIEXYZ, CIELAB (D65 white point), OKLab
+**	Batch accuracy: the sRGB transfer goes through 4096 entry tables with linear interpolation over [0, 1] (inputs
+**	                are clamped, error below 2e-5), cube roots are exact to float precision
+**
+**	Usage:
+**  float lab[3];
+**  ColorSpace::rgbToLab(rgb, lab);
+**
+**	const float *rgbChannels[3] = { r, g, b };
+**	float *labChannels[3] = { l, a, b };
+**	ColorSpace::rgbToLab(rgbChannels, labChannels, count);
+**
+**/
+
+
+class ColorSpace
+{
+
+public:
+	// sRGB transfer function on a single component
+	static float srgbToLinear(float c);
+	static float linearToSrgb(float c);
+
+	static void rgbToLinear(const float *rgb, float *linear);
+	static void linearToRgb(const float *linear, float *rgb);
+
+	static void rgbToLab(const float *rgb, float *lab);
+	static void labToRgb(const float *lab, float *rgb);
+
+	static void rgbToOklab(const float *rgb, float *oklab);
+	static void oklabToRgb(const float *oklab, float *rgb);
+
+	// batches of count colors, the output may alias the input
+	static void srgbToLinear(const float *in, float *out, std::size_t count);
+	static void linearToSrgb(const float *in, float *out, std::size_t count);
+	static void srgb8ToLinear(const unsigned char *in, float *out, std::size_t count);
+
+	// row major 3 x 3 matrix applied to every color, e.g. in linear RGB
+	static void transform(const float *matrix, const float *const in[3], float *const out[3], std::size_t count);
+
+	static void linearToXyz(const float *const linear[3], float *const xyz[3], std::size_t count);
+	static void xyzToLinear(const float *const xyz[3], float *const linear[3], std::size_t count);
+
+	static void xyzToLab(const float *const xyz[3], float *const lab[3], std::size_t count);
+	static void labToXyz(const float *const lab[3], float *const xyz[3], std::size_t count);
+
+	static void linearToOklab(const float *const linear[3], float *const oklab[3], std::size_t count);
+	static void oklabToLinear(const float *const oklab[3], float *const linear[3], std::size_t count);
+
+	// sRGB to and from the perceptual spaces, the results of the way back are clamped to [0, 1]
+	static void rgbToLab(const float *const rgb[3], float *const lab[3], std::size_t count);
+	static void labToRgb(const float *const lab[3], float *const rgb[3], std::size_t count);
+	static void rgbToOklab(const float *const rgb[3], float *const oklab[3], std::size_t count);
+	static void oklabToRgb(const float *const oklab[3], float *const rgb[3], std::size_t count);
+};
+
+
+#endif
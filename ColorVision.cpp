@@ -0,0 +1,286 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "ColorVision.h"
+#include "ColorSpace.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+
+namespace
+{
+	// Machado, Oliveira and Fernandes (2009), severity 1, linear RGB
+	const float machado[3][9] =
+	{
+		{  0.152286f,  1.052583f, -0.204868f,   0.114503f,  0.786281f,  0.099216f,  -0.003882f, -0.048116f,  1.051998f },
+		{  0.367322f,  0.860646f, -0.227968f,   0.280085f,  0.672501f,  0.047413f,  -0.011820f,  0.042940f,  0.968881f },
+		{  1.255528f, -0.076749f, -0.178779f,  -0.078411f,  0.930809f,  0.147602f,   0.004733f,  0.691367f,  0.303900f }
+	};
+
+	const std::size_t blockSize = 256;
+
+	// indexes machado, values cast from outside the enum are rejected
+	bool isValid(ColorVision::Deficiency deficiency)
+	{
+		int index = static_cast<int>(deficiency);
+		if (index >= ColorVision::protanopia && index <= ColorVision::tritanopia)
+			return true;
+
+		std::cout << "ColorVision::simulate(): Unknown color vision deficiency.";
+		return false;
+	}
+
+	void getMatrix(ColorVision::Deficiency deficiency, float severity, float *matrix)
+	{
+		severity = severity > 0.0f ? (severity < 1.0f ? severity : 1.0f) : 0.0f;
+
+		for (int k = 0; k < 9; ++k)
+			matrix[k] = (k % 4 == 0 ? 1.0f - severity : 0.0f) + severity * machado[deficiency][k];
+	}
+
+	// simulated colors leave the gamut slightly, the display clamps them
+	void clamp(float *values, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = values[i] > 0.0f ? (values[i] < 1.0f ? values[i] : 1.0f) : 0.0f;
+	}
+
+	void toPerceptual(const float *const linear[3], float *const out[3], std::size_t count, ColorVision::Space space)
+	{
+		if (space == ColorVision::oklab)
+		{
+			ColorSpace::linearToOklab(linear, out, count);
+			return;
+		}
+
+		ColorSpace::linearToXyz(linear, out, count);
+		ColorSpace::xyzToLab(out, out, count);
+	}
+
+	float minDistance(const float *const colors[3], std::size_t begin, unsigned int n)
+	{
+		float best = std::numeric_limits<float>::infinity();
+
+		for (std::size_t i = begin; i + 1 < begin + n; ++i)
+		{
+			for (std::size_t j = i + 1; j < begin + n; ++j)
+			{
+				float d0 = colors[0][i] - colors[0][j];
+				float d1 = colors[1][i] - colors[1][j];
+				float d2 = colors[2][i] - colors[2][j];
+				float d = d0 * d0 + d1 * d1 + d2 * d2;
+				best = d < best ? d : best;
+			}
+		}
+
+		return std::sqrt(best);
+	}
+}
+
+
+void ColorVision::simulate(const float *const rgb[3], float *const out[3], std::size_t count, Deficiency deficiency, float severity)
+{
+	if (!isValid(deficiency))
+		return;
+
+	float matrix[9];
+	getMatrix(deficiency, severity, matrix);
+
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		float *block[3] = { out[0] + i, out[1] + i, out[2] + i };
+
+		for (int c = 0; c < 3; ++c)
+			ColorSpace::srgbToLinear(rgb[c] + i, block[c], n);
+
+		ColorSpace::transform(matrix, block, block, n);
+
+		for (int c = 0; c < 3; ++c)
+			ColorSpace::linearToSrgb(block[c], block[c], n);
+	}
+}
+
+void ColorVision::simulate(const float *colors, float *out, std::size_t count, Deficiency deficiency, float severity, unsigned int stride)
+{
+	if (stride < 3)
+	{
+		std::cout << "ColorVision::simulate(): Stride must be at least 3.";
+		return;
+	}
+
+	if (!isValid(deficiency))
+		return;
+
+	float planes[3][blockSize];
+	float *block[3] = { planes[0], planes[1], planes[2] };
+
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		const float *in = colors + i * stride;
+		float *dst = out + i * stride;
+
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			for (int c = 0; c < 3; ++c)
+				planes[c][k] = in[k * stride + c];
+		}
+
+		simulate(block, block, n, deficiency, severity);
+
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			for (int c = 0; c < 3; ++c)
+				dst[k * stride + c] = planes[c][k];
+
+			for (unsigned int c = 3; c < stride; ++c)
+				dst[k * stride + c] = in[k * stride + c];
+		}
+	}
+}
+
+void ColorVision::simulate(const unsigned char *rgb, unsigned char *out, std::size_t count, Deficiency deficiency, float severity)
+{
+	if (!isValid(deficiency))
+		return;
+
+	float matrix[9];
+	getMatrix(deficiency, severity, matrix);
+
+	unsigned char bytes[3][blockSize];
+	float planes[3][blockSize];
+	float *block[3] = { planes[0], planes[1], planes[2] };
+
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		const unsigned char *in = rgb + 3 * i;
+		unsigned char *dst = out + 3 * i;
+
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			bytes[0][k] = in[3 * k];
+			bytes[1][k] = in[3 * k + 1];
+			bytes[2][k] = in[3 * k + 2];
+		}
+
+		for (int c = 0; c < 3; ++c)
+			ColorSpace::srgb8ToLinear(bytes[c], planes[c], n);
+
+		ColorSpace::transform(matrix, block, block, n);
+
+		for (int c = 0; c < 3; ++c)
+			ColorSpace::linearToSrgb(planes[c], planes[c], n);
+
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			dst[3 * k] = static_cast<unsigned char>(planes[0][k] * 255.0f + 0.5f);
+			dst[3 * k + 1] = static_cast<unsigned char>(planes[1][k] * 255.0f + 0.5f);
+			dst[3 * k + 2] = static_cast<unsigned char>(planes[2][k] * 255.0f + 0.5f);
+		}
+	}
+}
+
+ColorVision::Score ColorVision::score(const float *colors, unsigned int n, Space space, float severity, unsigned int stride)
+{
+	Score result;
+
+	if (stride < 3)
+	{
+		std::cout << "ColorVision::score(): Stride must be at least 3.";
+		result.normal = result.protanopia = result.deuteranopia = result.tritanopia = 0.0f;
+		return result;
+	}
+
+	if (stride == 3)
+	{
+		score(colors, n, 1, &result, space, severity);
+		return result;
+	}
+
+	std::vector<float> packed(3 * static_cast<std::size_t>(n));
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		for (int c = 0; c < 3; ++c)
+			packed[3 * i + c] = colors[i * stride + c];
+	}
+
+	score(packed.data(), n, 1, &result, space, severity);
+	return result;
+}
+
+void ColorVision::score(const float *colors, unsigned int n, std::size_t numPalettes, Score *scores, Space space, float severity)
+{
+	if (n < 2)
+	{
+		float none = std::numeric_limits<float>::infinity();
+		for (std::size_t p = 0; p < numPalettes; ++p)
+			scores[p].normal = scores[p].protanopia = scores[p].deuteranopia = scores[p].tritanopia = none;
+		return;
+	}
+
+	float matrices[3][9];
+	for (int d = 0; d < 3; ++d)
+		getMatrix(static_cast<Deficiency>(d), severity, matrices[d]);
+
+	// whole palettes per block so the pairwise distances stay within it
+	std::size_t group = n < blockSize ? blockSize / n : 1;
+	std::size_t capacity = group * n;
+
+	std::vector<float> buffer(6 * capacity);
+	float *linear[3] = { buffer.data(), buffer.data() + capacity, buffer.data() + 2 * capacity };
+	float *perceptual[3] = { buffer.data() + 3 * capacity, buffer.data() + 4 * capacity, buffer.data() + 5 * capacity };
+
+	for (std::size_t p = 0; p < numPalettes; p += group)
+	{
+		std::size_t palettes = numPalettes - p < group ? numPalettes - p : group;
+		std::size_t count = palettes * n;
+		const float *in = colors + 3 * n * p;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			for (int c = 0; c < 3; ++c)
+				linear[c][i] = in[3 * i + c];
+		}
+
+		for (int c = 0; c < 3; ++c)
+			ColorSpace::srgbToLinear(linear[c], linear[c], count);
+
+		// normal vision, then one pass per deficiency
+		for (int v = 0; v < 4; ++v)
+		{
+			if (v == 0)
+			{
+				toPerceptual(linear, perceptual, count, space);
+			}
+			else
+			{
+				ColorSpace::transform(matrices[v - 1], linear, perceptual, count);
+
+				for (int c = 0; c < 3; ++c)
+					clamp(perceptual[c], count);
+
+				toPerceptual(perceptual, perceptual, count, space);
+			}
+
+			for (std::size_t q = 0; q < palettes; ++q)
+			{
+				float distance = minDistance(perceptual, q * n, n);
+				Score &s = scores[p + q];
+
+				if (v == 0)
+					s.normal = distance;
+				else if (v == 1)
+					s.protanopia = distance;
+				else if (v == 2)
+					s.deuteranopia = distance;
+				else
+					s.tritanopia = distance;
+			}
+		}
+	}
+}
@@ -0,0 +1,76 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef COLORVISION
+#define COLORVISION
+
+#include <cstddef>
+
+/**
+**  Color vision deficiency simulation and blind safety scores for arbitrary palettes, tables and images.
+**  Dichromats are simulated with the matrices of Machado et al. (2009) in linear RGB; a severity below 1 blends
+**  the matrix with the identity. All conversions run on the batch kernels of ColorSpace.
+**
+**	Score: minimum pairwise distance of the palette colors with normal vision and under each simulation,
+**	       CIE76 delta E in CIELAB or the euclidean distance in OKLab (about 1 / 100 of delta E)
+**
+**	Usage:
+**  ColorBrewer::ColorView view = PaletteRegistry::builtin().getView(ColorBrewer::qualitative, ColorBrewer::Set1, 9);
+**	ColorVision::Score score = ColorVision::score(view.rgb, view.n);
+**	bool safe = score.worst() >= 10.0f;
+**
+**	ColorVision::simulate(image, out, width * height, ColorVision::deuteranopia);
+**
+**/
+
+
+class ColorVision
+{
+
+public:
+	enum Deficiency
+	{
+		protanopia, deuteranopia, tritanopia
+	};
+
+	enum Space
+	{
+		lab, oklab
+	};
+
+	// infinite for palettes with less than two colors
+	struct Score
+	{
+		float normal;
+		float protanopia;
+		float deuteranopia;
+		float tritanopia;
+
+		float worst() const
+		{
+			float a = normal < protanopia ? normal : protanopia;
+			float b = deuteranopia < tritanopia ? deuteranopia : tritanopia;
+			return a < b ? a : b;
+		}
+	};
+
+
+public:
+	// normalized sRGB in structure of arrays form, the output may alias the input; severity in [0, 1]
+	static void simulate(const float *const rgb[3], float *const out[3], std::size_t count, Deficiency deficiency, float severity = 1.0f);
+
+	// interleaved normalized colors, stride in floats >= 3, e.g. 4 for ColorLut::data(); further components are copied
+	static void simulate(const float *colors, float *out, std::size_t count, Deficiency deficiency, float severity = 1.0f, unsigned int stride = 3);
+
+	// count pixels of 3 bytes each
+	static void simulate(const unsigned char *rgb, unsigned char *out, std::size_t count, Deficiency deficiency, float severity = 1.0f);
+
+	// n interleaved normalized colors, stride in floats >= 3
+	static Score score(const float *colors, unsigned int n, Space space = lab, float severity = 1.0f, unsigned int stride = 3);
+
+	// numPalettes palettes of n normalized rgb colors each, stored back to back
+	static void score(const float *colors, unsigned int n, std::size_t numPalettes, Score *scores, Space space = lab, float severity = 1.0f);
+};
+
+
+#endif
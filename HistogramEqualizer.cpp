@@ -0,0 +1,202 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "HistogramEqualizer.h"
+#include <algorithm>
+#include <iostream>
+
+
+namespace
+{
+	const std::size_t blockSize = 256;
+}
+
+
+const std::size_t HistogramEqualizer::maxScratchCount;
+
+
+HistogramEqualizer::HistogramEqualizer(std::shared_ptr<const ColorLut> lut, float minValue, float maxValue, unsigned int bins)
+: m_lut(lut),
+  m_bins(bins > 0 ? bins : 1),
+  m_histogram(m_bins, 0),
+  m_total(0)
+{
+	if (!m_lut)
+	{
+		std::cout << "HistogramEqualizer::HistogramEqualizer(): No color table available, using black to white.";
+		m_lut = ColorLut::getFallback();
+	}
+
+	setRange(minValue, maxValue);
+}
+
+void HistogramEqualizer::setRange(float minValue, float maxValue)
+{
+	m_minValue = minValue;
+	m_maxValue = maxValue;
+
+	// same operations as ColorMapper::setRange() on a class table of m_bins entries
+	float range = maxValue - minValue;
+	float invRange = range != 0.0f ? 1.0f / range : 0.0f;
+
+	m_scale = invRange * static_cast<float>(m_bins);
+	m_bias = 0.0f - minValue * m_scale;
+	m_maxIndex = static_cast<float>(m_bins - 1);
+
+	clear();
+}
+
+void HistogramEqualizer::clear()
+{
+	std::fill(m_histogram.begin(), m_histogram.end(), 0);
+	m_total = 0;
+}
+
+// Indices are computed a block at a time, NaN goes to an extra bin that is dropped. Four interleaved
+// sub-histograms keep runs of equal bins, common in heavy-tailed data, from serializing on one counter.
+void HistogramEqualizer::count(const float *values, std::size_t count, std::uint32_t *scratch) const
+{
+	std::size_t stride = m_bins + 1;
+	std::int32_t indices[blockSize];
+
+	const float scale = m_scale;
+	const float bias = m_bias;
+	const float maxIndex = m_maxIndex;
+	const std::int32_t nanBin = static_cast<std::int32_t>(m_bins);
+
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = std::min(blockSize, count - i);
+		const float *block = values + i;
+
+		// bin() with a signed conversion, which vectorizes
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			float x = block[k] * scale + bias;
+			x = x > 0.0f ? x : 0.0f;
+			x = x < maxIndex ? x : maxIndex;
+			std::int32_t index = static_cast<std::int32_t>(x);
+			indices[k] = block[k] == block[k] ? index : nanBin;
+		}
+
+		std::size_t k = 0;
+		for (; k + 4 <= n; k += 4)
+		{
+			++scratch[indices[k]];
+			++scratch[stride + indices[k + 1]];
+			++scratch[2 * stride + indices[k + 2]];
+			++scratch[3 * stride + indices[k + 3]];
+		}
+		for (; k < n; ++k)
+			++scratch[indices[k]];
+	}
+}
+
+void HistogramEqualizer::fold(std::uint32_t *scratch, std::uint64_t *histogram) const
+{
+	std::size_t stride = m_bins + 1;
+
+	for (unsigned int b = 0; b < m_bins; ++b)
+		histogram[b] += static_cast<std::uint64_t>(scratch[b]) + scratch[stride + b] + scratch[2 * stride + b] + scratch[3 * stride + b];
+
+	std::fill(scratch, scratch + scratchSize(), 0);
+}
+
+void HistogramEqualizer::count(const float *values, std::size_t count, std::uint64_t *histogram) const
+{
+	std::vector<std::uint32_t> scratch(scratchSize(), 0);
+
+	for (std::size_t chunk = 0; chunk < count; chunk += maxScratchCount)
+	{
+		this->count(values + chunk, std::min(maxScratchCount, count - chunk), scratch.data());
+		fold(scratch.data(), histogram);
+	}
+}
+
+void HistogramEqualizer::add(const std::uint64_t *histogram)
+{
+	for (unsigned int b = 0; b < m_bins; ++b)
+	{
+		m_histogram[b] += histogram[b];
+		m_total += histogram[b];
+	}
+}
+
+void HistogramEqualizer::add(const float *values, std::size_t count)
+{
+	std::vector<std::uint64_t> counts(m_bins, 0);
+	this->count(values, count, counts.data());
+	add(counts.data());
+}
+
+void HistogramEqualizer::add(const float *values, std::size_t count, ThreadPool &pool)
+{
+	// a few tasks per thread for the work stealing, each with its own histogram
+	std::size_t numTasks = std::min<std::size_t>(4 * pool.size(), (count + 65535) / 65536);
+	if (numTasks <= 1)
+	{
+		add(values, count);
+		return;
+	}
+
+	std::size_t taskSize = (count + numTasks - 1) / numTasks;
+	std::vector< std::vector<std::uint64_t> > counts(numTasks, std::vector<std::uint64_t>(m_bins, 0));
+
+	pool.run(numTasks, [&](std::size_t task)
+	{
+		std::size_t begin = task * taskSize;
+		std::size_t end = std::min(count, begin + taskSize);
+
+		if (begin < end)
+			this->count(values + begin, end - begin, counts[task].data());
+	});
+
+	for (std::size_t task = 0; task < numTasks; ++task)
+		add(counts[task].data());
+}
+
+// Every bin takes the color at the midpoint of its values in the cumulative distribution, rescaled so the first
+// and the last occupied bin get the ends of the table.
+std::shared_ptr<const ColorLut> HistogramEqualizer::lut() const
+{
+	std::vector<double> positions(m_bins, 0.0);
+
+	double below = 0.0;
+	for (unsigned int b = 0; b < m_bins; ++b)
+	{
+		positions[b] = below + 0.5 * static_cast<double>(m_histogram[b]);
+		below += static_cast<double>(m_histogram[b]);
+	}
+
+	unsigned int first = 0;
+	while (first < m_bins && m_histogram[first] == 0)
+		++first;
+
+	unsigned int last = m_bins;
+	while (last > first && m_histogram[last - 1] == 0)
+		--last;
+
+	double lo = first < m_bins ? positions[first] : 0.0;
+	double hi = last > first ? positions[last - 1] : 0.0;
+	double invRange = hi > lo ? 1.0 / (hi - lo) : 0.0;
+
+	std::vector<float> colors(3 * m_bins);
+	for (unsigned int b = 0; b < m_bins; ++b)
+	{
+		double t = hi > lo ? (positions[b] - lo) * invRange : 0.5;
+		t = t > 0.0 ? (t < 1.0 ? t : 1.0) : 0.0;
+
+		const float *rgba = m_lut->color(static_cast<float>(t));
+		colors[3 * b + 0] = rgba[0];
+		colors[3 * b + 1] = rgba[1];
+		colors[3 * b + 2] = rgba[2];
+	}
+
+	return std::make_shared<ColorLut>(colors.data(), m_bins, m_bins, ColorLut::classes);
+}
+
+ColorMapper HistogramEqualizer::mapper() const
+{
+	return ColorMapper(lut(), m_minValue, m_maxValue);
+}
@@ -0,0 +1,93 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef HISTOGRAMEQUALIZER
+#define HISTOGRAMEQUALIZER
+
+#include "ColorLut.h"
+#include "ColorMapper.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+**  Histogram equalized color mapping for heavy-tailed data.
+**  Values in [minValue, maxValue] are counted into equal width bins, then every bin gets the color of the scheme at
+**  its position in the cumulative distribution, so each color covers about the same number of values. The warped
+**  table has one class entry per bin and is applied with a plain ColorMapper, whose bins are the histogram bins
+**  bit for bit. Counting and mapping are one streaming pass each.
+**
+**	Bins: values outside the range fall into the first and last bin, NaN is not counted
+**
+**	Usage:
+**  HistogramEqualizer equalizer(ColorLut::get(ColorBrewer::Sequential::YlOrRd, 1024), 0.0f, 75.0f);
+**	equalizer.add(values, count, pool); // privatized histograms, one per task
+**	equalizer.mapper().map(values, count, rgb, ColorMapper::rgb);
+**
+**	colorizer.equalize(equalizer, values, width, height, rgb, ColorMapper::rgb); // both passes on the tiles
+**
+**/
+
+
+class HistogramEqualizer
+{
+
+public:
+	HistogramEqualizer(std::shared_ptr<const ColorLut> lut, float minValue, float maxValue, unsigned int bins = 4096);
+
+	// clears the histogram
+	void setRange(float minValue, float maxValue);
+	void clear();
+
+	unsigned int bins() const { return m_bins; }
+	std::uint64_t total() const { return m_total; }
+	const std::uint64_t *histogram() const { return m_histogram.data(); }
+
+	unsigned int bin(float value) const
+	{
+		float x = value * m_scale + m_bias;
+		x = x > 0.0f ? x : 0.0f;
+		x = x < m_maxIndex ? x : m_maxIndex;
+		return static_cast<unsigned int>(x);
+	}
+
+	// adds the bin counts of values to histogram, bins() entries; const, so threads can fill private histograms
+	void count(const float *values, std::size_t count, std::uint64_t *histogram) const;
+
+	// same counts into a zeroed scratch of scratchSize() 32 bit sub-histograms, for many short runs such as raster
+	// rows; fold() adds them to histogram and zeroes the scratch, at the latest after maxScratchCount values
+	static const std::size_t maxScratchCount = std::size_t(1) << 30;
+	std::size_t scratchSize() const { return 4 * (static_cast<std::size_t>(m_bins) + 1); }
+	void count(const float *values, std::size_t count, std::uint32_t *scratch) const;
+	void fold(std::uint32_t *scratch, std::uint64_t *histogram) const;
+
+	// adds a histogram of bins() entries
+	void add(const std::uint64_t *histogram);
+
+	void add(const float *values, std::size_t count);
+	void add(const float *values, std::size_t count, ThreadPool &pool);
+
+	// table warped by the cumulative distribution of the values added so far
+	std::shared_ptr<const ColorLut> lut() const;
+	ColorMapper mapper() const;
+
+
+private:
+	std::shared_ptr<const ColorLut> m_lut;
+	float m_minValue;
+	float m_maxValue;
+	unsigned int m_bins;
+
+	// bin = clamp(value * m_scale + m_bias, 0, bins - 1), the arithmetic of ColorMapper
+	float m_scale;
+	float m_bias;
+	float m_maxIndex;
+
+	std::vector<std::uint64_t> m_histogram;
+	std::uint64_t m_total;
+};
+
+
+#endif
@@ -0,0 +1,169 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+#ifdef _WIN32
+
+MappedFile::MappedFile()
+: m_data(nullptr),
+  m_size(0),
+  m_file(INVALID_HANDLE_VALUE),
+  m_mapping(nullptr)
+{
+}
+
+bool MappedFile::open(const std::string &path)
+{
+	close();
+
+	m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (m_file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+	{
+		close();
+		return false;
+	}
+
+	m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!m_mapping)
+	{
+		close();
+		return false;
+	}
+
+	m_data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!m_data)
+	{
+		close();
+		return false;
+	}
+
+	m_size = static_cast<std::size_t>(size.QuadPart);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (m_data)
+		UnmapViewOfFile(m_data);
+	if (m_mapping)
+		CloseHandle(m_mapping);
+	if (m_file != INVALID_HANDLE_VALUE)
+		CloseHandle(m_file);
+
+	m_data = nullptr;
+	m_size = 0;
+	m_mapping = nullptr;
+	m_file = INVALID_HANDLE_VALUE;
+}
+
+void MappedFile::advise(std::size_t, std::size_t, Advice) const
+{
+}
+
+#else
+
+MappedFile::MappedFile()
+: m_data(nullptr),
+  m_size(0),
+  m_fd(-1)
+{
+}
+
+bool MappedFile::open(const std::string &path)
+{
+	close();
+
+	m_fd = ::open(path.c_str(), O_RDONLY);
+	if (m_fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(m_fd, &st) != 0 || st.st_size == 0)
+	{
+		close();
+		return false;
+	}
+
+	void *data = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, m_fd, 0);
+	if (data == MAP_FAILED)
+	{
+		close();
+		return false;
+	}
+
+	m_data = data;
+	m_size = static_cast<std::size_t>(st.st_size);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (m_data)
+		munmap(m_data, m_size);
+	if (m_fd >= 0)
+		::close(m_fd);
+
+	m_data = nullptr;
+	m_size = 0;
+	m_fd = -1;
+}
+
+void MappedFile::advise(std::size_t offset, std::size_t length, Advice advice) const
+{
+	if (!m_data || offset >= m_size)
+		return;
+
+	if (length > m_size - offset)
+		length = m_size - offset;
+
+	std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	std::size_t begin = offset / pageSize * pageSize;
+	std::size_t end = offset + length;
+
+	int hint = MADV_NORMAL;
+	switch (advice)
+	{
+	case sequential:
+		hint = MADV_SEQUENTIAL;
+		break;
+	case willNeed:
+		hint = MADV_WILLNEED;
+		break;
+	case dontNeed:
+		// only release whole pages, the partial last page may still be needed by the next range
+		end = end == m_size ? end : end / pageSize * pageSize;
+		hint = MADV_DONTNEED;
+		break;
+	default:
+		break;
+	}
+
+	if (end > begin)
+		madvise(static_cast<char *>(m_data) + begin, end - begin, hint);
+}
+
+#endif
+
+
+MappedFile::~MappedFile()
+{
+	close();
+}
@@ -0,0 +1,63 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef MAPPEDFILE
+#define MAPPEDFILE
+
+#include <cstddef>
+#include <string>
+
+/**
+**  Read-only memory mapping of a whole file.
+**  Access hints are forwarded to madvise() where available and ignored otherwise.
+**
+**	Usage:
+**  MappedFile file;
+**	if (file.open("values.f32"))
+**		const float *values = static_cast<const float *>(file.data());
+**
+**/
+
+
+class MappedFile
+{
+
+public:
+	enum Advice
+	{
+		normal, sequential, willNeed, dontNeed
+	};
+
+
+public:
+	MappedFile();
+	~MappedFile();
+
+	bool open(const std::string &path);
+	void close();
+
+	bool isOpen() const { return m_data != nullptr; }
+	const void *data() const { return m_data; }
+	std::size_t size() const { return m_size; }
+
+	// hint for the byte range [offset, offset + length), widened to page boundaries
+	void advise(std::size_t offset, std::size_t length, Advice advice) const;
+
+
+private:
+	MappedFile(const MappedFile &);
+	MappedFile &operator=(const MappedFile &);
+
+	void *m_data;
+	std::size_t m_size;
+
+#ifdef _WIN32
+	void *m_file;
+	void *m_mapping;
+#else
+	int m_fd;
+#endif
+};
+
+
+#endif
@@ -0,0 +1,290 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "PaletteBundle.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+
+namespace
+{
+	const char magic[8] = { 'C', 'B', 'B', 'U', 'N', 'D', 'L', 'E' };
+	const std::uint32_t byteOrder = 0x01020304;
+	const std::size_t alignment = 16;
+
+	static_assert(sizeof(PaletteBundle::Header) == 88, "PaletteBundle::Header must match the file format.");
+	static_assert(sizeof(ColorBrewer::ColorScheme) == 16, "ColorBrewer::ColorScheme must match the file format.");
+
+
+	struct Sections
+	{
+		std::size_t entries;
+		std::size_t values;
+		std::size_t classIndex;
+		std::size_t propertyIndex;
+		std::size_t names;
+	};
+
+	// element counts of the sections
+	Sections getSections(int schemeStride, int minClasses, int maxClasses, int indexWords, std::size_t numValues)
+	{
+		std::size_t numClasses = maxClasses - minClasses + 1;
+
+		Sections sections;
+		sections.entries = PaletteRegistry::numFamilies * schemeStride * numClasses;
+		sections.values = numValues;
+		sections.classIndex = PaletteRegistry::numFamilies * numClasses * indexWords;
+		sections.propertyIndex = PaletteRegistry::numFamilies * PaletteRegistry::numProperties * numClasses * indexWords;
+		sections.names = PaletteRegistry::numFamilies * schemeStride * PaletteRegistry::nameLength;
+
+		return sections;
+	}
+
+	std::size_t align(std::size_t offset)
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	bool inBounds(std::uint32_t offset, std::size_t bytes, std::size_t size)
+	{
+		return offset % alignment == 0 && offset <= size && bytes <= size - offset;
+	}
+}
+
+
+PaletteBundle::PaletteBundle()
+{
+}
+
+bool PaletteBundle::open(const std::string &path)
+{
+	close();
+
+	if (!m_file.open(path))
+	{
+		std::cout << "PaletteBundle::open(): Cannot open bundle file.";
+		return false;
+	}
+
+	if (!load(m_file.data(), m_file.size()))
+	{
+		m_file.close();
+		return false;
+	}
+
+	m_file.advise(0, m_file.size(), MappedFile::willNeed);
+
+	return true;
+}
+
+bool PaletteBundle::load(const void *data, std::size_t size)
+{
+	m_registry = PaletteRegistry();
+
+	const unsigned char *bytes = static_cast<const unsigned char *>(data);
+	if (!bytes || reinterpret_cast<std::uintptr_t>(bytes) % alignment != 0 || size < sizeof(Header))
+	{
+		std::cout << "PaletteBundle::load(): No aligned bundle header available.";
+		return false;
+	}
+
+	const Header &header = *reinterpret_cast<const Header *>(bytes);
+	if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.byteOrder != byteOrder)
+	{
+		std::cout << "PaletteBundle::load(): Not a bundle of this byte order.";
+		return false;
+	}
+
+	if (header.version != version)
+	{
+		std::cout << "PaletteBundle::load(): Unsupported bundle version.";
+		return false;
+	}
+
+	bool valid = header.fileSize <= size && header.minClasses >= 1 && header.minClasses <= header.maxClasses && header.maxClasses <= 0xffff &&
+		header.indexWords >= 1 && header.indexWords <= std::numeric_limits<std::int32_t>::max() / 32 &&
+		header.schemeStride >= 0 && header.schemeStride <= 32 * header.indexWords;
+
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		valid = valid && header.numSchemes[f] >= 0 && header.numSchemes[f] <= header.schemeStride;
+
+	if (!valid)
+	{
+		std::cout << "PaletteBundle::load(): Invalid bundle header.";
+		return false;
+	}
+
+	Sections sections = getSections(header.schemeStride, header.minClasses, header.maxClasses, header.indexWords, header.numValues);
+
+	if (!inBounds(header.entries, sections.entries * sizeof(ColorBrewer::ColorScheme), header.fileSize) ||
+		!inBounds(header.rgb, sections.values * sizeof(float), header.fileSize) ||
+		!inBounds(header.normalized, sections.values * sizeof(float), header.fileSize) ||
+		!inBounds(header.rgb8, sections.values, header.fileSize) ||
+		!inBounds(header.lab, sections.values * sizeof(float), header.fileSize) ||
+		!inBounds(header.oklab, sections.values * sizeof(float), header.fileSize) ||
+		!inBounds(header.classIndex, sections.classIndex * sizeof(std::uint32_t), header.fileSize) ||
+		!inBounds(header.propertyIndex, sections.propertyIndex * sizeof(std::uint32_t), header.fileSize) ||
+		!inBounds(header.names, sections.names, header.fileSize))
+	{
+		std::cout << "PaletteBundle::load(): Bundle section out of bounds.";
+		return false;
+	}
+
+	// the lookups trust the tables, so every color run and name has to stay inside its section
+	const ColorBrewer::ColorScheme *entries = reinterpret_cast<const ColorBrewer::ColorScheme *>(bytes + header.entries);
+	for (std::size_t i = 0; i < sections.entries; ++i)
+	{
+		if (entries[i].n != 0 && (entries[i].n < header.minClasses || entries[i].n > header.maxClasses ||
+			entries[i].offset > header.numValues || 3u * entries[i].n > header.numValues - entries[i].offset))
+		{
+			std::cout << "PaletteBundle::load(): Color scheme out of bounds.";
+			return false;
+		}
+	}
+
+	const char (*names)[PaletteRegistry::nameLength] = reinterpret_cast<const char (*)[PaletteRegistry::nameLength]>(bytes + header.names);
+	for (std::size_t i = 0; i < sections.names / PaletteRegistry::nameLength; ++i)
+	{
+		if (names[i][PaletteRegistry::nameLength - 1] != '\0')
+		{
+			std::cout << "PaletteBundle::load(): Color scheme name not terminated.";
+			return false;
+		}
+	}
+
+	// every bit of the class and property index has to name a scheme with that number of classes
+	const std::uint32_t *classIndex = reinterpret_cast<const std::uint32_t *>(bytes + header.classIndex);
+	const std::uint32_t *propertyIndex = reinterpret_cast<const std::uint32_t *>(bytes + header.propertyIndex);
+	int numClasses = header.maxClasses - header.minClasses + 1;
+
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+	{
+		for (int c = 0; c < numClasses; ++c)
+		{
+			for (int w = 0; w < header.indexWords; ++w)
+			{
+				std::uint32_t mask = classIndex[(f * numClasses + c) * header.indexWords + w];
+				for (int p = 0; p < PaletteRegistry::numProperties; ++p)
+					mask |= propertyIndex[((f * PaletteRegistry::numProperties + p) * numClasses + c) * header.indexWords + w];
+
+				for (; mask; mask &= mask - 1)
+				{
+					int name = 32 * w + PaletteRegistry::lowestBit(mask);
+					if (name >= header.numSchemes[f] || entries[(f * header.schemeStride + name) * numClasses + c].n != header.minClasses + c)
+					{
+						std::cout << "PaletteBundle::load(): Scheme index refers to a missing color scheme.";
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	PaletteRegistry::Layout layout;
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		layout.numSchemes[f] = header.numSchemes[f];
+
+	layout.schemeStride = header.schemeStride;
+	layout.minClasses = header.minClasses;
+	layout.maxClasses = header.maxClasses;
+	layout.indexWords = header.indexWords;
+	layout.numValues = header.numValues;
+	layout.entries = entries;
+	layout.rgb = reinterpret_cast<const float *>(bytes + header.rgb);
+	layout.normalized = reinterpret_cast<const float *>(bytes + header.normalized);
+	layout.rgb8 = bytes + header.rgb8;
+	layout.lab = reinterpret_cast<const float *>(bytes + header.lab);
+	layout.oklab = reinterpret_cast<const float *>(bytes + header.oklab);
+	layout.classIndex = reinterpret_cast<const unsigned int *>(bytes + header.classIndex);
+	layout.propertyIndex = reinterpret_cast<const unsigned int *>(bytes + header.propertyIndex);
+	layout.names = names;
+
+	m_registry = PaletteRegistry(layout);
+
+	return true;
+}
+
+void PaletteBundle::close()
+{
+	m_registry = PaletteRegistry();
+	m_file.close();
+}
+
+std::vector<unsigned char> PaletteBundle::serialize(const PaletteRegistry &registry)
+{
+	const PaletteRegistry::Layout &layout = registry.layout();
+	Sections sections = getSections(layout.schemeStride, layout.minClasses, layout.maxClasses, layout.indexWords, layout.numValues);
+
+	Header header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, magic, sizeof(magic));
+	header.version = version;
+	header.byteOrder = byteOrder;
+
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		header.numSchemes[f] = layout.numSchemes[f];
+
+	header.schemeStride = layout.schemeStride;
+	header.minClasses = layout.minClasses;
+	header.maxClasses = layout.maxClasses;
+	header.indexWords = layout.indexWords;
+	header.numValues = layout.numValues;
+
+	std::size_t offset = align(sizeof(Header));
+	header.entries = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.entries * sizeof(ColorBrewer::ColorScheme));
+	header.rgb = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.values * sizeof(float));
+	header.normalized = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.values * sizeof(float));
+	header.rgb8 = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.values);
+	header.lab = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.values * sizeof(float));
+	header.oklab = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.values * sizeof(float));
+	header.classIndex = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.classIndex * sizeof(std::uint32_t));
+	header.propertyIndex = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.propertyIndex * sizeof(std::uint32_t));
+	header.names = static_cast<std::uint32_t>(offset);
+	offset = align(offset + sections.names);
+	header.fileSize = static_cast<std::uint32_t>(offset);
+
+	std::vector<unsigned char> bundle(offset, 0);
+	std::memcpy(bundle.data(), &header, sizeof(header));
+	std::memcpy(bundle.data() + header.entries, layout.entries, sections.entries * sizeof(ColorBrewer::ColorScheme));
+	std::memcpy(bundle.data() + header.rgb, layout.rgb, sections.values * sizeof(float));
+	std::memcpy(bundle.data() + header.normalized, layout.normalized, sections.values * sizeof(float));
+	std::memcpy(bundle.data() + header.rgb8, layout.rgb8, sections.values);
+	std::memcpy(bundle.data() + header.lab, layout.lab, sections.values * sizeof(float));
+	std::memcpy(bundle.data() + header.oklab, layout.oklab, sections.values * sizeof(float));
+	std::memcpy(bundle.data() + header.classIndex, layout.classIndex, sections.classIndex * sizeof(std::uint32_t));
+	std::memcpy(bundle.data() + header.propertyIndex, layout.propertyIndex, sections.propertyIndex * sizeof(std::uint32_t));
+	std::memcpy(bundle.data() + header.names, layout.names, sections.names);
+
+	return bundle;
+}
+
+bool PaletteBundle::write(const PaletteRegistry &registry, const std::string &path)
+{
+	std::vector<unsigned char> bundle = serialize(registry);
+
+	std::FILE *file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		std::cout << "PaletteBundle::write(): Cannot open output file.";
+		return false;
+	}
+
+	bool written = std::fwrite(bundle.data(), 1, bundle.size(), file) == bundle.size();
+	written = std::fclose(file) == 0 && written;
+
+	if (!written)
+		std::cout << "PaletteBundle::write(): Cannot write output file.";
+
+	return written;
+}
@@ -0,0 +1,99 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef PALETTEBUNDLE
+#define PALETTEBUNDLE
+
+#include "MappedFile.h"
+#include "PaletteRegistry.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+**  Binary palette bundle, the tables of a PaletteRegistry stored so that they can be used in place.
+**  Loading maps the file and checks the header and bounds, the registry then points into the mapping.
+**
+**	Format (version 2, native byte order, all sections 16 byte aligned):
+**	Header        88 bytes, see below
+**	entries       ColorScheme, 16 bytes each, 3 * schemeStride * (maxClasses - minClasses + 1)
+**	rgb           float, numValues
+**	normalized    float, numValues
+**	rgb8          uint8, numValues
+**	lab           float, numValues
+**	oklab         float, numValues
+**	classIndex    uint32, 3 * (maxClasses - minClasses + 1) * indexWords
+**	propertyIndex uint32, 3 * 4 * (maxClasses - minClasses + 1) * indexWords
+**	names         char, 3 * schemeStride * PaletteRegistry::nameLength
+**
+**	Usage:
+**  PaletteBundle::write(PaletteRegistry::builtin(), "brewer.cbp");
+**
+**  PaletteBundle bundle;
+**	if (bundle.open("brewer.cbp"))
+**		ColorBrewer::ColorView view = bundle.registry().getView(ColorBrewer::sequential, 0, 5);
+**
+**/
+
+
+class PaletteBundle
+{
+
+public:
+	static const std::uint32_t version = 2;
+
+	struct Header
+	{
+		char magic[8];              // "CBBUNDLE"
+		std::uint32_t version;
+		std::uint32_t byteOrder;    // 0x01020304 as written
+		std::uint32_t fileSize;
+		std::int32_t numSchemes[PaletteRegistry::numFamilies];
+		std::int32_t schemeStride;
+		std::int32_t minClasses;
+		std::int32_t maxClasses;
+		std::int32_t indexWords;
+		std::uint32_t numValues;
+
+		// byte offsets of the sections from the start of the file
+		std::uint32_t entries;
+		std::uint32_t rgb;
+		std::uint32_t normalized;
+		std::uint32_t rgb8;
+		std::uint32_t lab;
+		std::uint32_t oklab;
+		std::uint32_t classIndex;
+		std::uint32_t propertyIndex;
+		std::uint32_t names;
+	};
+
+
+public:
+	PaletteBundle();
+
+	// map a bundle file, the registry stays valid until close() or the next open()
+	bool open(const std::string &path);
+
+	// use a bundle in memory, data must be 16 byte aligned and outlive the registry
+	bool load(const void *data, std::size_t size);
+
+	void close();
+
+	bool isOpen() const { return m_registry.layout().entries != nullptr; }
+	const PaletteRegistry &registry() const { return m_registry; }
+
+	// bundle of all tables of a registry
+	static std::vector<unsigned char> serialize(const PaletteRegistry &registry);
+	static bool write(const PaletteRegistry &registry, const std::string &path);
+
+
+private:
+	PaletteBundle(const PaletteBundle &);
+	PaletteBundle &operator=(const PaletteBundle &);
+
+	MappedFile m_file;
+	PaletteRegistry m_registry;
+};
+
+
+#endif
@@ -0,0 +1,205 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "PaletteIndexer.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PALETTEINDEXER_X86
+#include <immintrin.h>
+#endif
+
+#if defined(PALETTEINDEXER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PALETTEINDEXER_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PALETTEINDEXER_TARGET(isa)
+#endif
+
+
+namespace
+{
+	bool hasAvx2()
+	{
+		static const bool avx2 = ColorMapper::detectIsa() == ColorMapper::avx2;
+		return avx2;
+	}
+
+	template <typename Index>
+	void classifyValues(const float *values, std::size_t count, Index *indices, float scale, float bias, float maxIndex)
+	{
+		// PaletteIndexer::index() with a signed conversion, which vectorizes
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			float x = values[i] * scale + bias;
+			x = x > 0.0f ? x : 0.0f;
+			x = x < maxIndex ? x : maxIndex;
+			indices[i] = static_cast<Index>(static_cast<std::int32_t>(x));
+		}
+	}
+
+	// fixed size copies compile to plain loads and stores
+	template <typename Index, std::size_t PixelSize>
+	void gather(const Index *indices, std::size_t count, const unsigned char *palette, unsigned char *out)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			std::memcpy(out + i * PixelSize, palette + static_cast<std::size_t>(indices[i]) * PixelSize, PixelSize);
+	}
+
+#ifdef PALETTEINDEXER_X86
+	PALETTEINDEXER_TARGET("avx2")
+	inline __m256i loadIndices(const std::uint8_t *indices)
+	{
+		return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(indices)));
+	}
+
+	PALETTEINDEXER_TARGET("avx2")
+	inline __m256i loadIndices(const std::uint16_t *indices)
+	{
+		return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices)));
+	}
+
+	// 8 pixels per step with hardware gathers, the tail goes to the scalar kernel; 16 bit pixels are gathered as
+	// 32 bits, which reads the padding entry after the last one
+	template <typename Index>
+	PALETTEINDEXER_TARGET("avx2")
+	void gather2Avx2(const Index *indices, std::size_t count, const unsigned char *palette, unsigned char *out)
+	{
+		const int *table = reinterpret_cast<const int *>(palette);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i v = _mm256_and_si256(_mm256_i32gather_epi32(table, loadIndices(indices + i), 2), _mm256_set1_epi32(0xffff));
+			__m128i narrow = _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i), narrow);
+		}
+
+		gather<Index, 2>(indices + i, count - i, palette, out + 2 * i);
+	}
+
+	template <typename Index>
+	PALETTEINDEXER_TARGET("avx2")
+	void gather4Avx2(const Index *indices, std::size_t count, const unsigned char *palette, unsigned char *out)
+	{
+		const int *table = reinterpret_cast<const int *>(palette);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i pixels = _mm256_i32gather_epi32(table, loadIndices(indices + i), 4);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 4 * i), pixels);
+		}
+
+		gather<Index, 4>(indices + i, count - i, palette, out + 4 * i);
+	}
+
+	template <typename Index>
+	PALETTEINDEXER_TARGET("avx2")
+	void gather8Avx2(const Index *indices, std::size_t count, const unsigned char *palette, unsigned char *out)
+	{
+		const long long *table = reinterpret_cast<const long long *>(palette);
+
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i idx = loadIndices(indices + i);
+			__m256i lo = _mm256_i32gather_epi64(table, _mm256_castsi256_si128(idx), 8);
+			__m256i hi = _mm256_i32gather_epi64(table, _mm256_extracti128_si256(idx, 1), 8);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 8 * i), lo);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 8 * i + 32), hi);
+		}
+
+		gather<Index, 8>(indices + i, count - i, palette, out + 8 * i);
+	}
+#endif
+
+	template <typename Index>
+	void gather(const Index *indices, std::size_t count, const unsigned char *palette, unsigned char *out, std::size_t pixelSize)
+	{
+#ifdef PALETTEINDEXER_X86
+		if (hasAvx2() && pixelSize == 2)
+		{
+			gather2Avx2(indices, count, palette, out);
+			return;
+		}
+		if (hasAvx2() && pixelSize == 4)
+		{
+			gather4Avx2(indices, count, palette, out);
+			return;
+		}
+		if (hasAvx2() && pixelSize == 8)
+		{
+			gather8Avx2(indices, count, palette, out);
+			return;
+		}
+#endif
+		switch (pixelSize)
+		{
+		case 2: gather<Index, 2>(indices, count, palette, out); break;
+		case 3: gather<Index, 3>(indices, count, palette, out); break;
+		case 4: gather<Index, 4>(indices, count, palette, out); break;
+		case 8: gather<Index, 8>(indices, count, palette, out); break;
+		case 12: gather<Index, 12>(indices, count, palette, out); break;
+		case 16: gather<Index, 16>(indices, count, palette, out); break;
+		default: break;
+		}
+	}
+}
+
+
+PaletteIndexer::PaletteIndexer(float minValue, float maxValue, Depth depth)
+: m_minValue(minValue),
+  m_maxValue(maxValue),
+  m_depth(depth)
+{
+	float range = maxValue - minValue;
+	float invRange = range != 0.0f ? 1.0f / range : 0.0f;
+
+	m_scale = invRange * static_cast<float>(levels());
+	m_bias = 0.0f - minValue * m_scale;
+	m_maxIndex = static_cast<float>(levels() - 1);
+}
+
+float PaletteIndexer::level(unsigned int index) const
+{
+	double step = (static_cast<double>(m_maxValue) - m_minValue) / levels();
+	return static_cast<float>(m_minValue + (index + 0.5) * step);
+}
+
+void PaletteIndexer::classify(const float *values, std::size_t count, void *indices) const
+{
+	if (m_depth == index8)
+		classifyValues(values, count, static_cast<std::uint8_t *>(indices), m_scale, m_bias, m_maxIndex);
+	else
+		classifyValues(values, count, static_cast<std::uint16_t *>(indices), m_scale, m_bias, m_maxIndex);
+}
+
+void PaletteIndexer::palette(const ColorMapper &mapper, void *out, ColorMapper::Format format) const
+{
+	std::vector<float> centers(levels());
+	for (unsigned int i = 0; i < levels(); ++i)
+		centers[i] = level(i);
+
+	mapper.map(centers.data(), centers.size(), out, format);
+}
+
+std::vector<unsigned char> PaletteIndexer::palette(const ColorMapper &mapper, ColorMapper::Format format) const
+{
+	// one padding entry for the 32 bit gathers of the 16 bit formats
+	std::vector<unsigned char> out((levels() + 1) * ColorMapper::pixelSize(format), 0);
+	palette(mapper, out.data(), format);
+	return out;
+}
+
+void PaletteIndexer::apply(const void *indices, Depth depth, std::size_t count, const void *palette, void *out, ColorMapper::Format format)
+{
+	const unsigned char *paletteBytes = static_cast<const unsigned char *>(palette);
+	unsigned char *outBytes = static_cast<unsigned char *>(out);
+	std::size_t pixelSize = ColorMapper::pixelSize(format);
+
+	if (depth == index8)
+		gather(static_cast<const std::uint8_t *>(indices), count, paletteBytes, outBytes, pixelSize);
+	else
+		gather(static_cast<const std::uint16_t *>(indices), count, paletteBytes, outBytes, pixelSize);
+}
@@ -0,0 +1,92 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef PALETTEINDEXER
+#define PALETTEINDEXER
+
+#include "ColorMapper.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+**  Palette indexed rendering: values are classified once into a compact index image of 8 or 16 bit levels over a
+**  fixed range, colors are applied later through a palette with one entry per level. Switching the scheme, the number
+**  of classes or the normalization only rebuilds the palette, levels() values through any ColorMapper, followed by
+**  one gather pass over the indices, instead of mapping the float source again.
+**
+**	Depth: index8 (256 levels, std::uint8_t), index16 (65536 levels, std::uint16_t)
+**	Levels: equal width steps of [minValue, maxValue], values outside are clamped and NaN goes to level 0; a level is
+**	        colored with the mapper color of its center, which is direct mapping up to half a step
+**
+**	Usage:
+**  PaletteIndexer indexer(0.0f, 75.0f); // 16 bit levels over the data range
+**	colorizer.classify(indexer, values, width, height, indices); // once
+**
+**	std::vector<unsigned char> palette = indexer.palette(ColorMapper(ColorLut::get(ColorBrewer::Sequential::YlOrRd), 10.0f, 50.0f), ColorMapper::rgba8);
+**	colorizer.apply(indices, indexer.depth(), palette.data(), width, height, pixels, ColorMapper::rgba8); // per switch
+**
+**	ClassBreaks::classify() class indices are an index8 image as well, with a palette of breaks.size() - 1 colors.
+**
+**/
+
+
+class PaletteIndexer
+{
+
+public:
+	enum Depth
+	{
+		index8, index16
+	};
+
+
+public:
+	PaletteIndexer(float minValue, float maxValue, Depth depth = index16);
+
+	float minValue() const { return m_minValue; }
+	float maxValue() const { return m_maxValue; }
+	Depth depth() const { return m_depth; }
+
+	unsigned int levels() const { return m_depth == index8 ? 256u : 65536u; }
+
+	// bytes per index
+	static std::size_t indexSize(Depth depth) { return depth == index8 ? 1 : 2; }
+
+	unsigned int index(float value) const
+	{
+		float x = value * m_scale + m_bias;
+		x = x > 0.0f ? x : 0.0f;
+		x = x < m_maxIndex ? x : m_maxIndex;
+		return static_cast<unsigned int>(x);
+	}
+
+	// center value of a level
+	float level(unsigned int index) const;
+
+	// writes indexSize(depth()) bytes per value
+	void classify(const float *values, std::size_t count, void *indices) const;
+
+	// levels() colors of the mapper at the level centers, ColorMapper::pixelSize(format) bytes each; the vector holds
+	// one padding entry for apply()
+	void palette(const ColorMapper &mapper, void *out, ColorMapper::Format format) const;
+	std::vector<unsigned char> palette(const ColorMapper &mapper, ColorMapper::Format format) const;
+
+	// gathers count palette entries of ColorMapper::pixelSize(format) bytes; the palette needs an entry for every
+	// index that occurs, and for the 16 bit formats one padding entry after the largest, as ColorLut::rgb565()
+	static void apply(const void *indices, Depth depth, std::size_t count, const void *palette, void *out, ColorMapper::Format format);
+
+
+private:
+	float m_minValue;
+	float m_maxValue;
+	Depth m_depth;
+
+	// index = clamp(value * m_scale + m_bias, 0, levels - 1), the arithmetic of ColorMapper
+	float m_scale;
+	float m_bias;
+	float m_maxIndex;
+};
+
+
+#endif
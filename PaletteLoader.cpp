@@ -0,0 +1,939 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "PaletteLoader.h"
+#include "ColorSpace.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PALETTELOADER_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__)
+#define PALETTELOADER_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+	struct Cursor
+	{
+		const char *p;
+		const char *begin;
+		const char *end;
+		const char *error;
+	};
+
+	// one scheme of a JSON definition, classes hold n and the offset of its colors
+	struct Definition
+	{
+		int family;
+		std::vector<unsigned short> properties[PaletteRegistry::numProperties];
+		std::vector< std::pair<int, unsigned int> > classes;
+	};
+
+	struct Field
+	{
+		const char *s;
+		std::size_t length;
+	};
+
+	const int maxDepth = 64;
+	const int maxFields = 32;
+	const char *propertyNames[PaletteRegistry::numProperties] = { "blind", "print", "copy", "screen" };
+
+
+	bool isSpace(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+	}
+
+#ifdef PALETTELOADER_SSE2
+	int firstBit(int mask)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, static_cast<unsigned long>(mask));
+		return static_cast<int>(index);
+#else
+		return __builtin_ctz(static_cast<unsigned int>(mask));
+#endif
+	}
+#endif
+
+	// first character at or after p which is not JSON whitespace, 16 characters per step
+	const char *skipSpace(const char *p, const char *end)
+	{
+#if defined(PALETTELOADER_SSE2)
+		const __m128i space = _mm_set1_epi8(' ');
+		const __m128i tab = _mm_set1_epi8('\t');
+		const __m128i newline = _mm_set1_epi8('\n');
+		const __m128i carriage = _mm_set1_epi8('\r');
+
+		for (; end - p >= 16; p += 16)
+		{
+			__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+			__m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(c, space), _mm_cmpeq_epi8(c, tab)),
+				_mm_or_si128(_mm_cmpeq_epi8(c, newline), _mm_cmpeq_epi8(c, carriage)));
+
+			int mask = ~_mm_movemask_epi8(ws) & 0xffff;
+			if (mask)
+				return p + firstBit(mask);
+		}
+#elif defined(PALETTELOADER_NEON)
+		for (; end - p >= 16; p += 16)
+		{
+			uint8x16_t c = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+			uint8x16_t ws = vorrq_u8(vorrq_u8(vceqq_u8(c, vdupq_n_u8(' ')), vceqq_u8(c, vdupq_n_u8('\t'))),
+				vorrq_u8(vceqq_u8(c, vdupq_n_u8('\n')), vceqq_u8(c, vdupq_n_u8('\r'))));
+
+			if (vminvq_u8(ws) == 0)
+				break;
+		}
+#endif
+
+		while (p < end && isSpace(*p))
+			++p;
+
+		return p;
+	}
+
+	// first quote or backslash at or after p, 16 characters per step
+	const char *findQuote(const char *p, const char *end)
+	{
+#if defined(PALETTELOADER_SSE2)
+		const __m128i quote = _mm_set1_epi8('"');
+		const __m128i backslash = _mm_set1_epi8('\\');
+
+		for (; end - p >= 16; p += 16)
+		{
+			__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+			int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(c, quote), _mm_cmpeq_epi8(c, backslash)));
+			if (mask)
+				return p + firstBit(mask);
+		}
+#elif defined(PALETTELOADER_NEON)
+		for (; end - p >= 16; p += 16)
+		{
+			uint8x16_t c = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+			if (vmaxvq_u8(vorrq_u8(vceqq_u8(c, vdupq_n_u8('"')), vceqq_u8(c, vdupq_n_u8('\\')))) != 0)
+				break;
+		}
+#endif
+
+		while (p < end && *p != '"' && *p != '\\')
+			++p;
+
+		return p;
+	}
+
+	bool fail(Cursor &cursor, const char *error)
+	{
+		if (!cursor.error)
+			cursor.error = error;
+
+		return false;
+	}
+
+	bool consume(Cursor &cursor, char c)
+	{
+		cursor.p = skipSpace(cursor.p, cursor.end);
+		if (cursor.p == cursor.end || *cursor.p != c)
+			return false;
+
+		++cursor.p;
+		return true;
+	}
+
+	bool expect(Cursor &cursor, char c, const char *error)
+	{
+		return consume(cursor, c) || fail(cursor, error);
+	}
+
+	bool equals(const char *s, std::size_t length, const char *literal)
+	{
+		return std::strlen(literal) == length && std::memcmp(s, literal, length) == 0;
+	}
+
+	// raw characters between the quotes, escape sequences are kept as they are
+	bool parseString(Cursor &cursor, const char *&s, std::size_t &length)
+	{
+		if (!consume(cursor, '"'))
+			return fail(cursor, "Expected a string");
+
+		s = cursor.p;
+		for (;;)
+		{
+			const char *q = findQuote(cursor.p, cursor.end);
+			if (q == cursor.end || (*q == '\\' && q + 1 == cursor.end))
+				return fail(cursor, "Unterminated string");
+
+			if (*q == '"')
+			{
+				length = q - s;
+				cursor.p = q + 1;
+				return true;
+			}
+
+			cursor.p = q + 2;
+		}
+	}
+
+	// comma separated items up to the closing character, the opening one is already consumed
+	template <typename Item>
+	bool parseItems(Cursor &cursor, char close, Item item)
+	{
+		if (consume(cursor, close))
+			return true;
+
+		do
+		{
+			if (!item())
+				return false;
+		}
+		while (consume(cursor, ','));
+
+		return expect(cursor, close, "Expected a comma or the end of a list");
+	}
+
+	bool skipValue(Cursor &cursor, int depth)
+	{
+		if (depth > maxDepth)
+			return fail(cursor, "Nesting too deep");
+
+		cursor.p = skipSpace(cursor.p, cursor.end);
+		if (cursor.p == cursor.end)
+			return fail(cursor, "Expected a value");
+
+		const char *s;
+		std::size_t length;
+
+		switch (*cursor.p)
+		{
+		case '"':
+			return parseString(cursor, s, length);
+
+		case '{':
+			++cursor.p;
+			return parseItems(cursor, '}', [&]()
+			{
+				return parseString(cursor, s, length) && expect(cursor, ':', "Expected a colon") && skipValue(cursor, depth + 1);
+			});
+
+		case '[':
+			++cursor.p;
+			return parseItems(cursor, ']', [&]() { return skipValue(cursor, depth + 1); });
+
+		default:
+			s = cursor.p;
+			while (cursor.p < cursor.end && !isSpace(*cursor.p) && *cursor.p != ',' && *cursor.p != '}' && *cursor.p != ']')
+				++cursor.p;
+
+			return cursor.p != s || fail(cursor, "Expected a value");
+		}
+	}
+
+	// unsigned decimal number of at most 9 digits
+	bool parseNumber(const char *&p, const char *end, int &value)
+	{
+		const char *begin = p;
+
+		value = 0;
+		while (p < end && *p >= '0' && *p <= '9' && p - begin < 9)
+			value = 10 * value + (*p++ - '0');
+
+		return p != begin && (p == end || *p < '0' || *p > '9');
+	}
+
+	int hexDigit(char c)
+	{
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		if (c >= 'a' && c <= 'f')
+			return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F')
+			return c - 'A' + 10;
+
+		return -1;
+	}
+
+	// "rgb(r,g,b)" with optional spaces or "#rrggbb"
+	bool parseColor(const char *s, std::size_t length, unsigned char *rgb)
+	{
+		const char *end = s + length;
+
+		if (length == 7 && s[0] == '#')
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				int hi = hexDigit(s[1 + 2 * i]);
+				int lo = hexDigit(s[2 + 2 * i]);
+				if (hi < 0 || lo < 0)
+					return false;
+
+				rgb[i] = static_cast<unsigned char>(16 * hi + lo);
+			}
+
+			return true;
+		}
+
+		if (length < 4 || std::memcmp(s, "rgb(", 4) != 0)
+			return false;
+
+		const char *p = s + 4;
+		for (int i = 0; i < 3; ++i)
+		{
+			int value;
+			p = skipSpace(p, end);
+			if (!parseNumber(p, end, value) || value > 255)
+				return false;
+
+			rgb[i] = static_cast<unsigned char>(value);
+
+			p = skipSpace(p, end);
+			if (p == end || *p != (i < 2 ? ',' : ')'))
+				return false;
+
+			++p;
+		}
+
+		return p == end;
+	}
+
+	int parseFamily(const char *s, std::size_t length)
+	{
+		if (equals(s, length, "div") || equals(s, length, "diverging"))
+			return ColorBrewer::diverging;
+		if (equals(s, length, "qual") || equals(s, length, "qualitative"))
+			return ColorBrewer::qualitative;
+		if (equals(s, length, "seq") || equals(s, length, "sequential"))
+			return ColorBrewer::sequential;
+
+		return -1;
+	}
+
+	int parseProperty(const char *s, std::size_t length)
+	{
+		for (int p = 0; p < PaletteRegistry::numProperties; ++p)
+		{
+			if (equals(s, length, propertyNames[p]))
+				return p;
+		}
+
+		return -1;
+	}
+
+	bool parseProperties(Cursor &cursor, std::vector<unsigned short> &properties)
+	{
+		properties.clear();
+
+		return expect(cursor, '[', "Expected a property array") && parseItems(cursor, ']', [&]()
+		{
+			int value;
+			cursor.p = skipSpace(cursor.p, cursor.end);
+			if (!parseNumber(cursor.p, cursor.end, value) || value > 0xffff)
+				return fail(cursor, "Invalid property value");
+
+			properties.push_back(static_cast<unsigned short>(value));
+			return true;
+		});
+	}
+
+	bool parseType(Cursor &cursor, Definition &definition)
+	{
+		const char *s;
+		std::size_t length;
+		if (!parseString(cursor, s, length))
+			return false;
+
+		definition.family = parseFamily(s, length);
+		return definition.family >= 0 || fail(cursor, "Unknown color scheme type");
+	}
+
+	// member of a scheme or of its "properties" object which is not a class count
+	bool parseAttribute(Cursor &cursor, const char *key, std::size_t length, Definition &definition, int depth)
+	{
+		if (equals(key, length, "type"))
+			return parseType(cursor, definition);
+
+		int property = parseProperty(key, length);
+		if (property >= 0)
+			return parseProperties(cursor, definition.properties[property]);
+
+		if (depth == 0 && equals(key, length, "properties"))
+		{
+			return expect(cursor, '{', "Expected a properties object") && parseItems(cursor, '}', [&]()
+			{
+				const char *s;
+				std::size_t n;
+				return parseString(cursor, s, n) && expect(cursor, ':', "Expected a colon") && parseAttribute(cursor, s, n, definition, depth + 1);
+			});
+		}
+
+		return skipValue(cursor, depth + 1);
+	}
+
+	bool parseDefinition(Cursor &cursor, Definition &definition, std::vector<unsigned char> &colors)
+	{
+		definition.family = -1;
+		definition.classes.clear();
+		for (int p = 0; p < PaletteRegistry::numProperties; ++p)
+			definition.properties[p].clear();
+
+		return expect(cursor, '{', "Expected a color scheme object") && parseItems(cursor, '}', [&]()
+		{
+			const char *key;
+			std::size_t length;
+			if (!parseString(cursor, key, length) || !expect(cursor, ':', "Expected a colon"))
+				return false;
+
+			int n;
+			const char *p = key;
+			if (!parseNumber(p, key + length, n) || p != key + length)
+				return parseAttribute(cursor, key, length, definition, 0);
+
+			if (n < 1 || n > PaletteLoader::maxColors)
+				return fail(cursor, "Unsupported number of classes");
+
+			unsigned int offset = static_cast<unsigned int>(colors.size());
+			int count = 0;
+
+			bool parsed = expect(cursor, '[', "Expected a color array") && parseItems(cursor, ']', [&]()
+			{
+				const char *s;
+				std::size_t size;
+				if (!parseString(cursor, s, size))
+					return false;
+
+				unsigned char rgb[3];
+				if (!parseColor(s, size, rgb))
+					return fail(cursor, "Invalid color");
+
+				colors.insert(colors.end(), rgb, rgb + 3);
+				++count;
+				return true;
+			});
+
+			if (!parsed)
+				return false;
+
+			if (count != n)
+				return fail(cursor, "Number of colors does not match the class count");
+
+			definition.classes.push_back(std::make_pair(n, offset));
+			return true;
+		});
+	}
+
+	// splits one line at commas, quotes around a field are removed
+	int splitFields(const char *p, const char *end, Field *fields)
+	{
+		int count = 0;
+
+		for (;;)
+		{
+			const char *comma = static_cast<const char *>(std::memchr(p, ',', end - p));
+			const char *stop = comma ? comma : end;
+
+			if (count < maxFields)
+			{
+				const char *s = skipSpace(p, stop);
+				const char *e = stop;
+				while (e > s && isSpace(e[-1]))
+					--e;
+
+				if (e - s >= 2 && *s == '"' && e[-1] == '"')
+				{
+					++s;
+					--e;
+				}
+
+				fields[count].s = s;
+				fields[count].length = e - s;
+			}
+
+			++count;
+
+			if (!comma)
+				return count < maxFields ? count : maxFields;
+
+			p = comma + 1;
+		}
+	}
+
+	bool parseField(const Field &field, int &value)
+	{
+		const char *p = field.s;
+		return parseNumber(p, field.s + field.length, value) && p == field.s + field.length;
+	}
+
+	// interleaved 8 bit colors to interleaved CIELAB and OKLab, from the exact linear values through the batch conversions
+	void toPerceptual(const unsigned char *rgb8, std::size_t numColors, float *lab, float *oklab)
+	{
+		std::vector<float> values(3 * numColors);
+		ColorSpace::srgb8ToLinear(rgb8, values.data(), values.size());
+
+		std::vector<float> planes(9 * numColors);
+		float *linear[3] = { planes.data(), planes.data() + numColors, planes.data() + 2 * numColors };
+		float *labPlanes[3] = { planes.data() + 3 * numColors, planes.data() + 4 * numColors, planes.data() + 5 * numColors };
+		float *oklabPlanes[3] = { planes.data() + 6 * numColors, planes.data() + 7 * numColors, planes.data() + 8 * numColors };
+
+		for (std::size_t i = 0; i < numColors; ++i)
+		{
+			for (int c = 0; c < 3; ++c)
+				linear[c][i] = values[3 * i + c];
+		}
+
+		ColorSpace::linearToXyz(linear, labPlanes, numColors);
+		ColorSpace::xyzToLab(labPlanes, labPlanes, numColors);
+		ColorSpace::linearToOklab(linear, oklabPlanes, numColors);
+
+		for (std::size_t i = 0; i < numColors; ++i)
+		{
+			for (int c = 0; c < 3; ++c)
+			{
+				lab[3 * i + c] = labPlanes[c][i];
+				oklab[3 * i + c] = oklabPlanes[c][i];
+			}
+		}
+	}
+}
+
+
+PaletteLoader::PaletteLoader()
+{
+}
+
+bool PaletteLoader::loadJson(const std::string &path)
+{
+	MappedFile file;
+	if (!file.open(path))
+	{
+		std::cout << "PaletteLoader::loadJson(): Cannot open file.";
+		return false;
+	}
+
+	file.advise(0, file.size(), MappedFile::sequential);
+
+	return parseJson(static_cast<const char *>(file.data()), file.size());
+}
+
+bool PaletteLoader::loadCsv(const std::string &path)
+{
+	MappedFile file;
+	if (!file.open(path))
+	{
+		std::cout << "PaletteLoader::loadCsv(): Cannot open file.";
+		return false;
+	}
+
+	file.advise(0, file.size(), MappedFile::sequential);
+
+	return parseCsv(static_cast<const char *>(file.data()), file.size());
+}
+
+bool PaletteLoader::parseJson(const char *data, std::size_t size)
+{
+	std::size_t numClasses = m_classes.size();
+	std::size_t numColors = m_colors.size();
+	int numSchemes[PaletteRegistry::numFamilies];
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		numSchemes[f] = static_cast<int>(m_names[f].size());
+
+	Cursor cursor = { data, data, data + size, nullptr };
+
+	// utf-8 byte order mark
+	if (size >= 3 && std::memcmp(data, "\xef\xbb\xbf", 3) == 0)
+		cursor.p += 3;
+
+	// a color takes at least 9 characters ("#rrggbb",), so this bounds the growth of the color buffer
+	m_colors.reserve(m_colors.size() + size / 3);
+
+	Definition definition;
+
+	bool parsed = expect(cursor, '{', "Expected an object of color schemes") && parseItems(cursor, '}', [&]()
+	{
+		const char *name;
+		std::size_t length;
+		if (!parseString(cursor, name, length) || !expect(cursor, ':', "Expected a colon") || !parseDefinition(cursor, definition, m_colors))
+			return false;
+
+		if (definition.family < 0)
+			return fail(cursor, "Color scheme without type");
+
+		std::sort(definition.classes.begin(), definition.classes.end());
+
+		std::size_t count = definition.classes.size();
+		for (std::size_t i = 1; i < count; ++i)
+		{
+			if (definition.classes[i].first == definition.classes[i - 1].first)
+				return fail(cursor, "Class count defined twice");
+		}
+
+		for (int p = 0; p < PaletteRegistry::numProperties; ++p)
+		{
+			std::size_t values = definition.properties[p].size();
+			if (values > 1 && values != count)
+				return fail(cursor, "Property array does not match the class counts");
+		}
+
+		int scheme = addScheme(definition.family, name, length);
+		if (scheme < 0)
+			return fail(cursor, "Invalid color scheme name");
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Classes classes;
+			classes.family = definition.family;
+			classes.scheme = scheme;
+			classes.n = static_cast<unsigned short>(definition.classes[i].first);
+			classes.offset = definition.classes[i].second;
+
+			for (int p = 0; p < PaletteRegistry::numProperties; ++p)
+			{
+				const std::vector<unsigned short> &values = definition.properties[p];
+				classes.properties[p] = values.empty() ? 0 : values[values.size() == 1 ? 0 : i];
+			}
+
+			m_classes.push_back(classes);
+		}
+
+		return true;
+	});
+
+	if (parsed && skipSpace(cursor.p, cursor.end) != cursor.end)
+		parsed = fail(cursor, "Unexpected characters after the color schemes");
+
+	if (!parsed)
+	{
+		std::cout << "PaletteLoader::parseJson(): " << cursor.error << " at byte " << (cursor.p - cursor.begin) << ".";
+		rollback(numClasses, numColors, numSchemes);
+		return false;
+	}
+
+	if (!build())
+	{
+		rollback(numClasses, numColors, numSchemes);
+		build();
+		return false;
+	}
+
+	return true;
+}
+
+bool PaletteLoader::parseCsv(const char *data, std::size_t size)
+{
+	std::size_t numClasses = m_classes.size();
+	std::size_t numColors = m_colors.size();
+	int numSchemes[PaletteRegistry::numFamilies];
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		numSchemes[f] = static_cast<int>(m_names[f].size());
+
+	const char *end = data + size;
+	const char *error = nullptr;
+	std::size_t line = 0;
+
+	enum Column { name, count, type, red, green, blue, numColumns };
+	const char *columnNames[numColumns] = { "ColorName", "NumOfColors", "Type", "R", "G", "B" };
+	int columns[numColumns] = { -1, -1, -1, -1, -1, -1 };
+	bool header = true;
+
+	// class count in progress
+	Classes classes;
+	int remaining = 0;
+
+	for (const char *p = data; p < end && !error;)
+	{
+		// 1-based number of the line being parsed
+		++line;
+
+		const char *newline = static_cast<const char *>(std::memchr(p, '\n', end - p));
+		const char *stop = newline ? newline : end;
+		const char *next = newline ? newline + 1 : end;
+
+		if (stop > p && stop[-1] == '\r')
+			--stop;
+
+		Field fields[maxFields];
+		int numFields = splitFields(p, stop, fields);
+		p = next;
+
+		bool blank = true;
+		for (int i = 0; i < numFields; ++i)
+			blank = blank && fields[i].length == 0;
+
+		if (blank)
+			continue;
+
+		if (header)
+		{
+			for (int i = 0; i < numFields; ++i)
+			{
+				for (int c = 0; c < numColumns; ++c)
+				{
+					if (equals(fields[i].s, fields[i].length, columnNames[c]))
+						columns[c] = i;
+				}
+			}
+
+			for (int c = 0; c < numColumns; ++c)
+			{
+				if (columns[c] < 0 || columns[c] >= numFields)
+					error = "Missing column";
+			}
+
+			header = false;
+			continue;
+		}
+
+		bool complete = true;
+		for (int c = 0; c < numColumns; ++c)
+			complete = complete && columns[c] < numFields;
+
+		if (!complete)
+		{
+			error = "Missing fields";
+			break;
+		}
+
+		const Field &first = fields[columns[name]];
+		if (first.length > 0)
+		{
+			if (remaining > 0)
+			{
+				error = "Fewer colors than the class count";
+				break;
+			}
+
+			int n;
+			int family = parseFamily(fields[columns[type]].s, fields[columns[type]].length);
+			if (!parseField(fields[columns[count]], n) || n < 1 || n > maxColors)
+				error = "Unsupported number of classes";
+			else if (family < 0)
+				error = "Unknown color scheme type";
+			else if ((classes.scheme = addScheme(family, first.s, first.length)) < 0)
+				error = "Invalid color scheme name";
+
+			if (error)
+				break;
+
+			classes.family = family;
+			classes.n = static_cast<unsigned short>(n);
+			classes.offset = static_cast<unsigned int>(m_colors.size());
+			for (int i = 0; i < PaletteRegistry::numProperties; ++i)
+				classes.properties[i] = 0;
+
+			m_classes.push_back(classes);
+			remaining = n;
+		}
+
+		if (remaining == 0)
+		{
+			error = "More colors than the class count";
+			break;
+		}
+
+		for (int c = red; c <= blue; ++c)
+		{
+			int value;
+			if (!parseField(fields[columns[c]], value) || value > 255)
+			{
+				error = "Invalid color";
+				break;
+			}
+
+			m_colors.push_back(static_cast<unsigned char>(value));
+		}
+
+		--remaining;
+	}
+
+	if (!error && header)
+		error = "Missing header";
+
+	// reported at the last line
+	if (!error && remaining > 0)
+		error = "Fewer colors than the class count";
+
+	if (error)
+	{
+		std::cout << "PaletteLoader::parseCsv(): " << error << " in line " << line << ".";
+		rollback(numClasses, numColors, numSchemes);
+		return false;
+	}
+
+	if (!build())
+	{
+		rollback(numClasses, numColors, numSchemes);
+		build();
+		return false;
+	}
+
+	return true;
+}
+
+void PaletteLoader::clear()
+{
+	m_classes.clear();
+	m_colors.clear();
+
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		m_names[f].clear();
+
+	build();
+}
+
+std::size_t PaletteLoader::size() const
+{
+	std::size_t size = 0;
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		size += m_names[f].size();
+
+	return size;
+}
+
+int PaletteLoader::addScheme(int family, const char *name, std::size_t length)
+{
+	if (length == 0 || length >= PaletteRegistry::nameLength)
+		return -1;
+
+	std::map<std::string, int> &names = m_names[family];
+	std::map<std::string, int>::iterator it = names.insert(std::make_pair(std::string(name, length), static_cast<int>(names.size()))).first;
+
+	return it->second;
+}
+
+void PaletteLoader::rollback(std::size_t numClasses, std::size_t numColors, const int *numSchemes)
+{
+	m_classes.resize(numClasses);
+	m_colors.resize(numColors);
+
+	for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+	{
+		std::map<std::string, int> &names = m_names[f];
+		for (std::map<std::string, int>::iterator it = names.begin(); it != names.end(); )
+		{
+			if (it->second >= numSchemes[f])
+				it = names.erase(it);
+			else
+				++it;
+		}
+	}
+}
+
+bool PaletteLoader::build()
+{
+	const int numFamilies = PaletteRegistry::numFamilies;
+	const int numProperties = PaletteRegistry::numProperties;
+
+	if (m_classes.empty())
+	{
+		m_registry = PaletteRegistry();
+		return true;
+	}
+
+	int stride = 0;
+	for (int f = 0; f < numFamilies; ++f)
+		stride = std::max(stride, static_cast<int>(m_names[f].size()));
+
+	int minClasses = maxColors;
+	int maxClasses = 1;
+	for (std::size_t i = 0; i < m_classes.size(); ++i)
+	{
+		minClasses = std::min(minClasses, static_cast<int>(m_classes[i].n));
+		maxClasses = std::max(maxClasses, static_cast<int>(m_classes[i].n));
+	}
+
+	int numClasses = maxClasses - minClasses + 1;
+	int words = (stride + 31) / 32;
+
+	ColorBrewer::ColorScheme none = {};
+	m_entries.assign(numFamilies * stride * numClasses, none);
+	m_classIndex.assign(numFamilies * numClasses * words, 0);
+	m_propertyIndex.assign(numFamilies * numProperties * numClasses * words, 0);
+	m_rgb.resize(m_colors.size());
+	m_normalized.resize(m_colors.size());
+	m_rgb8.resize(m_colors.size());
+	m_lab.resize(m_colors.size());
+	m_oklab.resize(m_colors.size());
+
+	unsigned int offset = 0;
+	for (std::size_t i = 0; i < m_classes.size(); ++i)
+	{
+		const Classes &classes = m_classes[i];
+		int c = classes.n - minClasses;
+
+		ColorBrewer::ColorScheme &entry = m_entries[(classes.family * stride + classes.scheme) * numClasses + c];
+		if (entry.n != 0)
+		{
+			std::cout << "PaletteLoader::build(): Color scheme with this number of classes defined twice.";
+			return false;
+		}
+
+		entry.offset = offset;
+		entry.n = classes.n;
+		entry.propertyMask = 0;
+
+		int word = (classes.family * numClasses + c) * words + classes.scheme / 32;
+		unsigned int bit = 1u << (classes.scheme % 32);
+		m_classIndex[word] |= bit;
+
+		for (int p = 0; p < PaletteRegistry::numProperties; ++p)
+		{
+			entry.properties[p] = classes.properties[p];
+			if (classes.properties[p] == 1)
+			{
+				entry.propertyMask |= 1u << p;
+				m_propertyIndex[((classes.family * numProperties + p) * numClasses + c) * words + classes.scheme / 32] |= bit;
+			}
+		}
+
+		// colors in registry order, definitions of one scheme may be spread over several loads
+		for (unsigned int v = 0; v < 3u * classes.n; ++v, ++offset)
+		{
+			unsigned char value = m_colors[classes.offset + v];
+			m_rgb8[offset] = value;
+			m_rgb[offset] = value;
+			m_normalized[offset] = value / 255.0f;
+		}
+	}
+
+	toPerceptual(m_rgb8.data(), offset / 3, m_lab.data(), m_oklab.data());
+
+	m_nameTable.assign(numFamilies * stride * PaletteRegistry::nameLength, '\0');
+	for (int f = 0; f < numFamilies; ++f)
+	{
+		for (std::map<std::string, int>::const_iterator it = m_names[f].begin(); it != m_names[f].end(); ++it)
+			std::memcpy(&m_nameTable[(f * stride + it->second) * PaletteRegistry::nameLength], it->first.data(), it->first.size());
+	}
+
+	PaletteRegistry::Layout layout;
+	for (int f = 0; f < numFamilies; ++f)
+		layout.numSchemes[f] = static_cast<int>(m_names[f].size());
+
+	layout.schemeStride = stride;
+	layout.minClasses = minClasses;
+	layout.maxClasses = maxClasses;
+	layout.indexWords = words;
+	layout.numValues = offset;
+	layout.entries = m_entries.data();
+	layout.rgb = m_rgb.data();
+	layout.normalized = m_normalized.data();
+	layout.rgb8 = m_rgb8.data();
+	layout.lab = m_lab.data();
+	layout.oklab = m_oklab.data();
+	layout.classIndex = m_classIndex.data();
+	layout.propertyIndex = m_propertyIndex.data();
+	layout.names = reinterpret_cast<const char (*)[PaletteRegistry::nameLength]>(m_nameTable.data());
+
+	m_registry = PaletteRegistry(layout);
+
+	return true;
+}
@@ -0,0 +1,98 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef PALETTELOADER
+#define PALETTELOADER
+
+#include "PaletteRegistry.h"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+**  Loads custom color schemes from colorbrewer JSON and CSV definitions into the dense PaletteRegistry tables.
+**  Files are parsed in place from a memory mapping, whitespace and string scans use SSE2 or NEON where available.
+**  Each load either adds all its schemes or, on an error, none of them.
+**
+**	JSON: an object of schemes, each an object of class counts with "rgb(r,g,b)" or "#rrggbb" colors, the family
+**	as "type" ("div", "qual", "seq") and optional property arrays, either directly or in a "properties" object.
+**	A property array holds one value for all class counts or one value per class count in ascending order.
+**  { "Blues": { "3": ["rgb(222,235,247)", "rgb(158,202,225)", "rgb(49,130,189)"], "type": "seq", "blind": [1] } }
+**
+**	CSV: the colorbrewer table with the columns ColorName, NumOfColors, Type, R, G, B and one row per color.
+**	Name, count and type are only given on the first row of a scheme, properties are not part of the table.
+**
+**	Usage:
+**  PaletteLoader loader;
+**	if (loader.loadJson("palettes.json") && loader.loadCsv("more.csv"))
+**		ColorBrewer::ColorView view = loader.registry().getView(ColorBrewer::sequential, loader.registry().findName(ColorBrewer::sequential, "Blues"), 3);
+**
+**/
+
+
+class PaletteLoader
+{
+
+public:
+	// largest number of classes of a loaded scheme
+	static const int maxColors = 256;
+
+
+public:
+	PaletteLoader();
+
+	bool loadJson(const std::string &path);
+	bool loadCsv(const std::string &path);
+
+	// parse definitions in memory, data does not need to be zero terminated
+	bool parseJson(const char *data, std::size_t size);
+	bool parseCsv(const char *data, std::size_t size);
+
+	void clear();
+
+	// number of loaded schemes over all families
+	std::size_t size() const;
+
+	// tables of all loaded schemes, valid until the next load or clear()
+	const PaletteRegistry &registry() const { return m_registry; }
+
+
+private:
+	struct Classes
+	{
+		int family;
+		int scheme;
+		unsigned short n;
+		unsigned short properties[PaletteRegistry::numProperties];
+		unsigned int offset; // into m_colors
+	};
+
+	PaletteLoader(const PaletteLoader &);
+	PaletteLoader &operator=(const PaletteLoader &);
+
+	int addScheme(int family, const char *name, std::size_t length);
+	void rollback(std::size_t numClasses, std::size_t numColors, const int *numSchemes);
+	bool build();
+
+	// definitions in load order, colors as 8 bit rgb
+	std::vector<Classes> m_classes;
+	std::vector<unsigned char> m_colors;
+	std::map<std::string, int> m_names[PaletteRegistry::numFamilies];
+
+	// dense tables of the registry
+	std::vector<ColorBrewer::ColorScheme> m_entries;
+	std::vector<float> m_rgb;
+	std::vector<float> m_normalized;
+	std::vector<unsigned char> m_rgb8;
+	std::vector<float> m_lab;
+	std::vector<float> m_oklab;
+	std::vector<unsigned int> m_classIndex;
+	std::vector<unsigned int> m_propertyIndex;
+	std::vector<char> m_nameTable;
+
+	PaletteRegistry m_registry;
+};
+
+
+#endif
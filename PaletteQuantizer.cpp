@@ -0,0 +1,307 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "PaletteQuantizer.h"
+#include "ColorSpace.h"
+#include "PaletteRegistry.h"
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PALETTEQUANTIZER_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#define PALETTEQUANTIZER_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(PALETTEQUANTIZER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PALETTEQUANTIZER_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PALETTEQUANTIZER_TARGET(isa)
+#endif
+
+
+namespace
+{
+	// pixels per block when expanding indices to colors
+	const std::size_t blockSize = 256;
+
+	unsigned char toByte(float c)
+	{
+		c = c < 0.0f ? 0.0f : (c > 1.0f ? 1.0f : c);
+		return static_cast<unsigned char>(c * 255.0f + 0.5f);
+	}
+
+	void indicesScalar(const unsigned char *cube, unsigned int bits, const unsigned char *rgb, std::size_t count, unsigned char *indices)
+	{
+		unsigned int shift = 8 - bits;
+
+		for (std::size_t i = 0; i < count; ++i, rgb += 3)
+			indices[i] = cube[((rgb[0] >> shift) << (2 * bits)) | ((rgb[1] >> shift) << bits) | (rgb[2] >> shift)];
+	}
+
+#ifdef PALETTEQUANTIZER_X86
+	// 8 pixels per step: spread the channels to 32 bit lanes, compute the cell and gather from the padded cube
+	PALETTEQUANTIZER_TARGET("avx2")
+	void indicesAvx2(const unsigned char *cube, unsigned int bits, const unsigned char *rgb, std::size_t count, unsigned char *indices)
+	{
+		const __m256i words = _mm256_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6);
+		const __m256i red = _mm256_setr_epi8(0, -1, -1, -1, 3, -1, -1, -1, 6, -1, -1, -1, 9, -1, -1, -1,
+			0, -1, -1, -1, 3, -1, -1, -1, 6, -1, -1, -1, 9, -1, -1, -1);
+		const __m256i green = _mm256_setr_epi8(1, -1, -1, -1, 4, -1, -1, -1, 7, -1, -1, -1, 10, -1, -1, -1,
+			1, -1, -1, -1, 4, -1, -1, -1, 7, -1, -1, -1, 10, -1, -1, -1);
+		const __m256i blue = _mm256_setr_epi8(2, -1, -1, -1, 5, -1, -1, -1, 8, -1, -1, -1, 11, -1, -1, -1,
+			2, -1, -1, -1, 5, -1, -1, -1, 8, -1, -1, -1, 11, -1, -1, -1);
+		const __m256i low = _mm256_set1_epi32(0xff);
+		const __m128i shift = _mm_cvtsi32_si128(8 - bits);
+		const __m128i shiftRed = _mm_cvtsi32_si128(2 * bits);
+		const __m128i shiftGreen = _mm_cvtsi32_si128(bits);
+
+		std::size_t i = 0;
+
+		// each step loads 32 bytes for 24 bytes of pixels
+		for (; i + 11 <= count; i += 8)
+		{
+			__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rgb + 3 * i));
+			bytes = _mm256_permutevar8x32_epi32(bytes, words);
+
+			__m256i r = _mm256_srl_epi32(_mm256_shuffle_epi8(bytes, red), shift);
+			__m256i g = _mm256_srl_epi32(_mm256_shuffle_epi8(bytes, green), shift);
+			__m256i b = _mm256_srl_epi32(_mm256_shuffle_epi8(bytes, blue), shift);
+
+			__m256i cell = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(r, shiftRed), _mm256_sll_epi32(g, shiftGreen)), b);
+			__m256i index = _mm256_and_si256(_mm256_i32gather_epi32(reinterpret_cast<const int *>(cube), cell, 1), low);
+
+			index = _mm256_packus_epi32(index, index);
+			index = _mm256_packus_epi16(index, index);
+
+			std::uint32_t first = static_cast<std::uint32_t>(_mm256_cvtsi256_si32(index));
+			std::uint32_t second = static_cast<std::uint32_t>(_mm256_extract_epi32(index, 4));
+			std::memcpy(indices + i, &first, 4);
+			std::memcpy(indices + i + 4, &second, 4);
+		}
+
+		indicesScalar(cube, bits, rgb + 3 * i, count - i, indices + i);
+	}
+#endif
+
+#ifdef PALETTEQUANTIZER_NEON
+	// 16 pixels per step: deinterleave with vld3 and compute the cells in 16 bit lanes
+	void indicesNeon(const unsigned char *cube, unsigned int bits, const unsigned char *rgb, std::size_t count, unsigned char *indices)
+	{
+		const int8x16_t shift = vdupq_n_s8(static_cast<signed char>(bits) - 8);
+		const int16x8_t shiftRed = vdupq_n_s16(static_cast<short>(2 * bits));
+		const int16x8_t shiftGreen = vdupq_n_s16(static_cast<short>(bits));
+
+		std::uint16_t cells[16];
+		std::size_t i = 0;
+
+		for (; i + 16 <= count; i += 16)
+		{
+			uint8x16x3_t pixels = vld3q_u8(rgb + 3 * i);
+			uint8x16_t r = vshlq_u8(pixels.val[0], shift);
+			uint8x16_t g = vshlq_u8(pixels.val[1], shift);
+			uint8x16_t b = vshlq_u8(pixels.val[2], shift);
+
+			uint16x8_t lo = vorrq_u16(vorrq_u16(vshlq_u16(vmovl_u8(vget_low_u8(r)), shiftRed), vshlq_u16(vmovl_u8(vget_low_u8(g)), shiftGreen)), vmovl_u8(vget_low_u8(b)));
+			uint16x8_t hi = vorrq_u16(vorrq_u16(vshlq_u16(vmovl_u8(vget_high_u8(r)), shiftRed), vshlq_u16(vmovl_u8(vget_high_u8(g)), shiftGreen)), vmovl_u8(vget_high_u8(b)));
+
+			vst1q_u16(cells, lo);
+			vst1q_u16(cells + 8, hi);
+
+			for (int k = 0; k < 16; ++k)
+				indices[i + k] = cube[cells[k]];
+		}
+
+		indicesScalar(cube, bits, rgb + 3 * i, count - i, indices + i);
+	}
+#endif
+}
+
+
+PaletteQuantizer::PaletteQuantizer(const float *colors, unsigned int n, unsigned int bits)
+: m_size(n < 1 ? 1 : (n > 256 ? 256 : n)),
+  m_bits(bits < 4 ? 4 : (bits > 7 ? 7 : bits)),
+  m_isa(ColorMapper::scalar)
+{
+	setIsa(ColorMapper::detectIsa());
+	build(colors);
+}
+
+std::shared_ptr<const PaletteQuantizer> PaletteQuantizer::get(ColorBrewer::Family family, int name, int n, unsigned int bits)
+{
+	static std::mutex cacheMutex;
+	static std::map<unsigned long long, std::shared_ptr<const PaletteQuantizer> > cache;
+
+	ColorBrewer::ColorView view = PaletteRegistry::builtin().getView(family, name, n);
+	if (view.empty())
+		return std::shared_ptr<const PaletteQuantizer>();
+
+	// clamped as in the constructor, so equivalent requests share one quantizer
+	bits = bits < 4 ? 4 : (bits > 7 ? 7 : bits);
+
+	unsigned long long key = (static_cast<unsigned long long>(family) << 24) | (static_cast<unsigned long long>(name) << 16) |
+		(static_cast<unsigned long long>(n) << 8) | bits;
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	std::shared_ptr<const PaletteQuantizer> &quantizer = cache[key];
+	if (!quantizer)
+		quantizer = std::make_shared<PaletteQuantizer>(view.rgb, view.n, bits);
+
+	return quantizer;
+}
+
+void PaletteQuantizer::setIsa(ColorMapper::Isa isa)
+{
+	// kernels exist for avx2, neon and scalar, sse41 falls back to scalar
+	ColorMapper::Isa best = ColorMapper::detectIsa();
+
+	if (isa == ColorMapper::avx2 && best == ColorMapper::avx2)
+		m_isa = ColorMapper::avx2;
+	else if (isa == ColorMapper::neon && best == ColorMapper::neon)
+		m_isa = ColorMapper::neon;
+	else
+		m_isa = ColorMapper::scalar;
+}
+
+std::size_t PaletteQuantizer::pixelSize(Output output)
+{
+	switch (output)
+	{
+	case rgb8:
+		return 3;
+	case rgba8:
+	case bgra8:
+		return 4;
+	default:
+		return 1;
+	}
+}
+
+void PaletteQuantizer::quantize(const unsigned char *rgb, std::size_t count, void *out, Output output) const
+{
+	unsigned char *outBytes = static_cast<unsigned char *>(out);
+
+	if (output == indices)
+	{
+		getIndices(rgb, count, outBytes);
+		return;
+	}
+
+	unsigned char block[blockSize];
+	std::size_t size = pixelSize(output);
+	const std::uint32_t *packed = output == rgba8 ? m_rgba8.data() : m_bgra8.data();
+
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		getIndices(rgb + 3 * i, n, block);
+
+		unsigned char *dst = outBytes + size * i;
+		if (output == rgb8)
+		{
+			for (std::size_t k = 0; k < n; ++k)
+				std::memcpy(dst + 3 * k, &m_palette[3 * block[k]], 3);
+		}
+		else
+		{
+			for (std::size_t k = 0; k < n; ++k)
+				std::memcpy(dst + 4 * k, &packed[block[k]], 4);
+		}
+	}
+}
+
+void PaletteQuantizer::build(const float *colors)
+{
+	std::vector<float> lab(3 * m_size);
+
+	m_palette.resize(3 * m_size);
+	m_rgba8.resize(m_size);
+	m_bgra8.resize(m_size);
+
+	for (unsigned int i = 0; i < m_size; ++i)
+	{
+		ColorSpace::rgbToLab(colors + 3 * i, &lab[3 * i]);
+
+		unsigned char r = toByte(colors[3 * i]);
+		unsigned char g = toByte(colors[3 * i + 1]);
+		unsigned char b = toByte(colors[3 * i + 2]);
+
+		m_palette[3 * i] = r;
+		m_palette[3 * i + 1] = g;
+		m_palette[3 * i + 2] = b;
+		m_rgba8[i] = ColorBrewer::pack(r, g, b, 255);
+		m_bgra8[i] = ColorBrewer::pack(b, g, r, 255);
+	}
+
+	// 3 bytes of padding for the 32 bit gathers of the avx2 kernel
+	unsigned int cells = 1u << m_bits;
+	m_cube.assign(cells * cells * cells + 3, 0);
+
+	// nearest palette color to each cell center, ties go to the lower index
+	std::vector<float> row(3 * cells);
+	float *channels[3] = { row.data(), row.data() + cells, row.data() + 2 * cells };
+
+	for (unsigned int cell = 0; cell < cells * cells * cells; ++cell)
+	{
+		unsigned int blue = cell & (cells - 1);
+
+		// cell centers along blue converted to CIELAB in one batch
+		if (blue == 0)
+		{
+			for (unsigned int k = 0; k < cells; ++k)
+			{
+				channels[0][k] = ((cell >> (2 * m_bits)) + 0.5f) / cells;
+				channels[1][k] = (((cell >> m_bits) & (cells - 1)) + 0.5f) / cells;
+				channels[2][k] = (k + 0.5f) / cells;
+			}
+
+			ColorSpace::rgbToLab(channels, channels, cells);
+		}
+
+		float c[3] = { channels[0][blue], channels[1][blue], channels[2][blue] };
+
+		unsigned int best = 0;
+		float bestDistance = 1e30f;
+
+		for (unsigned int i = 0; i < m_size; ++i)
+		{
+			float dl = c[0] - lab[3 * i];
+			float da = c[1] - lab[3 * i + 1];
+			float db = c[2] - lab[3 * i + 2];
+			float distance = dl * dl + da * da + db * db;
+
+			if (distance < bestDistance)
+			{
+				bestDistance = distance;
+				best = i;
+			}
+		}
+
+		m_cube[cell] = static_cast<unsigned char>(best);
+	}
+}
+
+void PaletteQuantizer::getIndices(const unsigned char *rgb, std::size_t count, unsigned char *indices) const
+{
+	switch (m_isa)
+	{
+#ifdef PALETTEQUANTIZER_X86
+	case ColorMapper::avx2:
+		indicesAvx2(m_cube.data(), m_bits, rgb, count, indices);
+		break;
+#endif
+#ifdef PALETTEQUANTIZER_NEON
+	case ColorMapper::neon:
+		indicesNeon(m_cube.data(), m_bits, rgb, count, indices);
+		break;
+#endif
+	default:
+		indicesScalar(m_cube.data(), m_bits, rgb, count, indices);
+		break;
+	}
+}
@@ -0,0 +1,84 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef PALETTEQUANTIZER
+#define PALETTEQUANTIZER
+
+#include "ColorBrewer.h"
+#include "ColorMapper.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+**  Maps 8 bit rgb pixels to the nearest color of a palette through a precomputed cube of (2^bits)^3 cells.
+**  Each cell holds the palette index nearest to the cell center in CIELAB, so a pixel costs one table lookup.
+**  Pixels in a cell share its index, which is exact up to a cell width of 2^(8 - bits) per channel.
+**
+**	Output: indices (1 byte), rgb8 (3 bytes), rgba8 / bgra8 (4 bytes, see ColorBrewer::pack())
+**
+**	Usage:
+**  std::shared_ptr<const PaletteQuantizer> quantizer = PaletteQuantizer::get(ColorBrewer::qualitative, ColorBrewer::Set1, 9);
+**	quantizer->quantize(rgb, width * height, out, PaletteQuantizer::rgb8);
+**
+**/
+
+
+class PaletteQuantizer
+{
+
+public:
+	enum Output
+	{
+		indices, rgb8, rgba8, bgra8
+	};
+
+
+public:
+	// n normalized rgb colors, n <= 256; bits per channel of the cube in [4, 7]
+	PaletteQuantizer(const float *colors, unsigned int n, unsigned int bits = 5);
+
+	// cached quantizer for a scheme of the built-in registry, empty if the scheme does not exist
+	static std::shared_ptr<const PaletteQuantizer> get(ColorBrewer::Family family, int name, int n, unsigned int bits = 5);
+
+	unsigned int size() const { return m_size; }
+	unsigned int bits() const { return m_bits; }
+
+	// palette as 8 bit rgb, 3 * size() bytes
+	const unsigned char *palette() const { return m_palette.data(); }
+
+	// cube of palette indices, red is the slowest axis
+	const unsigned char *cube() const { return m_cube.data(); }
+
+	void setIsa(ColorMapper::Isa isa);
+	ColorMapper::Isa getIsa() const { return m_isa; }
+
+	static std::size_t pixelSize(Output output);
+
+	unsigned int index(unsigned char r, unsigned char g, unsigned char b) const
+	{
+		unsigned int shift = 8 - m_bits;
+		return m_cube[((r >> shift) << (2 * m_bits)) | ((g >> shift) << m_bits) | (b >> shift)];
+	}
+
+	// count pixels of 3 bytes each
+	void quantize(const unsigned char *rgb, std::size_t count, void *out, Output output = indices) const;
+
+
+private:
+	void build(const float *colors);
+	void getIndices(const unsigned char *rgb, std::size_t count, unsigned char *indices) const;
+
+	unsigned int m_size;
+	unsigned int m_bits;
+	ColorMapper::Isa m_isa;
+
+	std::vector<unsigned char> m_cube;
+	std::vector<unsigned char> m_palette;
+	std::vector<std::uint32_t> m_rgba8;
+	std::vector<std::uint32_t> m_bgra8;
+};
+
+
+#endif
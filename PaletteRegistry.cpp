@@ -0,0 +1,2036 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "PaletteRegistry.h"
+#include <cassert>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+namespace
+{
+	const int numFamilies = PaletteRegistry::numFamilies;
+	const int maxSchemes = 18;
+	const int minClasses = 3;
+	const int maxClasses = 12;
+	const int numProperties = PaletteRegistry::numProperties;
+
+	// All colors packed into one buffer per representation: rgb in [0, 255], normalized to [0, 1], as 8 bit values,
+	// CIELAB and OKLab. Each scheme and number of classes is a run of 3 * n values starting at ColorScheme::offset.
+
+	constexpr float rgbTable[5067] =
+	{
+		// diverging
+		// Spectral
+		252.0f, 141.0f, 89.0f, 255.0f, 255.0f, 191.0f, 153.0f, 213.0f, 148.0f,
+		215.0f, 25.0f, 28.0f, 253.0f, 174.0f, 97.0f, 171.0f, 221.0f, 164.0f, 43.0f, 131.0f, 186.0f,
+		215.0f, 25.0f, 28.0f, 253.0f, 174.0f, 97.0f, 255.0f, 255.0f, 191.0f, 171.0f, 221.0f, 164.0f, 43.0f, 131.0f, 186.0f,
+		213.0f, 62.0f, 79.0f, 252.0f, 141.0f, 89.0f, 254.0f, 224.0f, 139.0f, 230.0f, 245.0f, 152.0f, 153.0f, 213.0f, 148.0f, 50.0f, 136.0f, 189.0f,
+		213.0f, 62.0f, 79.0f, 252.0f, 141.0f, 89.0f, 254.0f, 224.0f, 139.0f, 255.0f, 255.0f, 191.0f, 230.0f, 245.0f, 152.0f, 153.0f, 213.0f, 148.0f, 50.0f, 136.0f, 189.0f,
+		213.0f, 62.0f, 79.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 230.0f, 245.0f, 152.0f, 171.0f, 221.0f, 164.0f, 102.0f, 194.0f, 165.0f, 50.0f, 136.0f, 189.0f,
+		213.0f, 62.0f, 79.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 255.0f, 255.0f, 191.0f, 230.0f, 245.0f, 152.0f, 171.0f, 221.0f, 164.0f, 102.0f, 194.0f, 165.0f, 50.0f, 136.0f, 189.0f,
+		158.0f, 1.0f, 66.0f, 213.0f, 62.0f, 79.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 230.0f, 245.0f, 152.0f, 171.0f, 221.0f, 164.0f, 102.0f, 194.0f, 165.0f, 50.0f, 136.0f, 189.0f, 94.0f, 79.0f, 162.0f,
+		158.0f, 1.0f, 66.0f, 213.0f, 62.0f, 79.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 255.0f, 255.0f, 191.0f, 230.0f, 245.0f, 152.0f, 171.0f, 221.0f, 164.0f, 102.0f, 194.0f, 165.0f, 50.0f, 136.0f, 189.0f, 94.0f, 79.0f, 162.0f,
+		// RdYlGn
+		252.0f, 141.0f, 89.0f, 255.0f, 255.0f, 191.0f, 145.0f, 207.0f, 96.0f,
+		215.0f, 25.0f, 28.0f, 253.0f, 174.0f, 97.0f, 166.0f, 217.0f, 106.0f, 26.0f, 150.0f, 65.0f,
+		215.0f, 25.0f, 28.0f, 253.0f, 174.0f, 97.0f, 255.0f, 255.0f, 191.0f, 166.0f, 217.0f, 106.0f, 26.0f, 150.0f, 65.0f,
+		215.0f, 48.0f, 39.0f, 252.0f, 141.0f, 89.0f, 254.0f, 224.0f, 139.0f, 217.0f, 239.0f, 139.0f, 145.0f, 207.0f, 96.0f, 26.0f, 152.0f, 80.0f,
+		215.0f, 48.0f, 39.0f, 252.0f, 141.0f, 89.0f, 254.0f, 224.0f, 139.0f, 255.0f, 255.0f, 191.0f, 217.0f, 239.0f, 139.0f, 145.0f, 207.0f, 96.0f, 26.0f, 152.0f, 80.0f,
+		215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 217.0f, 239.0f, 139.0f, 166.0f, 217.0f, 106.0f, 102.0f, 189.0f, 99.0f, 26.0f, 152.0f, 80.0f,
+		215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 255.0f, 255.0f, 191.0f, 217.0f, 239.0f, 139.0f, 166.0f, 217.0f, 106.0f, 102.0f, 189.0f, 99.0f, 26.0f, 152.0f, 80.0f,
+		165.0f, 0.0f, 38.0f, 215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 217.0f, 239.0f, 139.0f, 166.0f, 217.0f, 106.0f, 102.0f, 189.0f, 99.0f, 26.0f, 152.0f, 80.0f, 0.0f, 104.0f, 55.0f,
+		165.0f, 0.0f, 38.0f, 215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 139.0f, 255.0f, 255.0f, 191.0f, 217.0f, 239.0f, 139.0f, 166.0f, 217.0f, 106.0f, 102.0f, 189.0f, 99.0f, 26.0f, 152.0f, 80.0f, 0.0f, 104.0f, 55.0f,
+		// RdBu
+		239.0f, 138.0f, 98.0f, 247.0f, 247.0f, 247.0f, 103.0f, 169.0f, 207.0f,
+		202.0f, 0.0f, 32.0f, 244.0f, 165.0f, 130.0f, 146.0f, 197.0f, 222.0f, 5.0f, 113.0f, 176.0f,
+		202.0f, 0.0f, 32.0f, 244.0f, 165.0f, 130.0f, 247.0f, 247.0f, 247.0f, 146.0f, 197.0f, 222.0f, 5.0f, 113.0f, 176.0f,
+		178.0f, 24.0f, 43.0f, 239.0f, 138.0f, 98.0f, 253.0f, 219.0f, 199.0f, 209.0f, 229.0f, 240.0f, 103.0f, 169.0f, 207.0f, 33.0f, 102.0f, 172.0f,
+		178.0f, 24.0f, 43.0f, 239.0f, 138.0f, 98.0f, 253.0f, 219.0f, 199.0f, 247.0f, 247.0f, 247.0f, 209.0f, 229.0f, 240.0f, 103.0f, 169.0f, 207.0f, 33.0f, 102.0f, 172.0f,
+		178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 209.0f, 229.0f, 240.0f, 146.0f, 197.0f, 222.0f, 67.0f, 147.0f, 195.0f, 33.0f, 102.0f, 172.0f,
+		178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 247.0f, 247.0f, 247.0f, 209.0f, 229.0f, 240.0f, 146.0f, 197.0f, 222.0f, 67.0f, 147.0f, 195.0f, 33.0f, 102.0f, 172.0f,
+		103.0f, 0.0f, 31.0f, 178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 209.0f, 229.0f, 240.0f, 146.0f, 197.0f, 222.0f, 67.0f, 147.0f, 195.0f, 33.0f, 102.0f, 172.0f, 5.0f, 48.0f, 97.0f,
+		103.0f, 0.0f, 31.0f, 178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 247.0f, 247.0f, 247.0f, 209.0f, 229.0f, 240.0f, 146.0f, 197.0f, 222.0f, 67.0f, 147.0f, 195.0f, 33.0f, 102.0f, 172.0f, 5.0f, 48.0f, 97.0f,
+		// PiYG
+		233.0f, 163.0f, 201.0f, 247.0f, 247.0f, 247.0f, 161.0f, 215.0f, 106.0f,
+		208.0f, 28.0f, 139.0f, 241.0f, 182.0f, 218.0f, 184.0f, 225.0f, 134.0f, 77.0f, 172.0f, 38.0f,
+		208.0f, 28.0f, 139.0f, 241.0f, 182.0f, 218.0f, 247.0f, 247.0f, 247.0f, 184.0f, 225.0f, 134.0f, 77.0f, 172.0f, 38.0f,
+		197.0f, 27.0f, 125.0f, 233.0f, 163.0f, 201.0f, 253.0f, 224.0f, 239.0f, 230.0f, 245.0f, 208.0f, 161.0f, 215.0f, 106.0f, 77.0f, 146.0f, 33.0f,
+		197.0f, 27.0f, 125.0f, 233.0f, 163.0f, 201.0f, 253.0f, 224.0f, 239.0f, 247.0f, 247.0f, 247.0f, 230.0f, 245.0f, 208.0f, 161.0f, 215.0f, 106.0f, 77.0f, 146.0f, 33.0f,
+		197.0f, 27.0f, 125.0f, 222.0f, 119.0f, 174.0f, 241.0f, 182.0f, 218.0f, 253.0f, 224.0f, 239.0f, 230.0f, 245.0f, 208.0f, 184.0f, 225.0f, 134.0f, 127.0f, 188.0f, 65.0f, 77.0f, 146.0f, 33.0f,
+		197.0f, 27.0f, 125.0f, 222.0f, 119.0f, 174.0f, 241.0f, 182.0f, 218.0f, 253.0f, 224.0f, 239.0f, 247.0f, 247.0f, 247.0f, 230.0f, 245.0f, 208.0f, 184.0f, 225.0f, 134.0f, 127.0f, 188.0f, 65.0f, 77.0f, 146.0f, 33.0f,
+		142.0f, 1.0f, 82.0f, 197.0f, 27.0f, 125.0f, 222.0f, 119.0f, 174.0f, 241.0f, 182.0f, 218.0f, 253.0f, 224.0f, 239.0f, 230.0f, 245.0f, 208.0f, 184.0f, 225.0f, 134.0f, 127.0f, 188.0f, 65.0f, 77.0f, 146.0f, 33.0f, 39.0f, 100.0f, 25.0f,
+		142.0f, 1.0f, 82.0f, 197.0f, 27.0f, 125.0f, 222.0f, 119.0f, 174.0f, 241.0f, 182.0f, 218.0f, 253.0f, 224.0f, 239.0f, 247.0f, 247.0f, 247.0f, 230.0f, 245.0f, 208.0f, 184.0f, 225.0f, 134.0f, 127.0f, 188.0f, 65.0f, 77.0f, 146.0f, 33.0f, 39.0f, 100.0f, 25.0f,
+		// PRGn
+		175.0f, 141.0f, 195.0f, 247.0f, 247.0f, 247.0f, 127.0f, 191.0f, 123.0f,
+		123.0f, 50.0f, 148.0f, 194.0f, 165.0f, 207.0f, 166.0f, 219.0f, 160.0f, 0.0f, 136.0f, 55.0f,
+		123.0f, 50.0f, 148.0f, 194.0f, 165.0f, 207.0f, 247.0f, 247.0f, 247.0f, 166.0f, 219.0f, 160.0f, 0.0f, 136.0f, 55.0f,
+		118.0f, 42.0f, 131.0f, 175.0f, 141.0f, 195.0f, 231.0f, 212.0f, 232.0f, 217.0f, 240.0f, 211.0f, 127.0f, 191.0f, 123.0f, 27.0f, 120.0f, 55.0f,
+		118.0f, 42.0f, 131.0f, 175.0f, 141.0f, 195.0f, 231.0f, 212.0f, 232.0f, 247.0f, 247.0f, 247.0f, 217.0f, 240.0f, 211.0f, 127.0f, 191.0f, 123.0f, 27.0f, 120.0f, 55.0f,
+		118.0f, 42.0f, 131.0f, 153.0f, 112.0f, 171.0f, 194.0f, 165.0f, 207.0f, 231.0f, 212.0f, 232.0f, 217.0f, 240.0f, 211.0f, 166.0f, 219.0f, 160.0f, 90.0f, 174.0f, 97.0f, 27.0f, 120.0f, 55.0f,
+		118.0f, 42.0f, 131.0f, 153.0f, 112.0f, 171.0f, 194.0f, 165.0f, 207.0f, 231.0f, 212.0f, 232.0f, 247.0f, 247.0f, 247.0f, 217.0f, 240.0f, 211.0f, 166.0f, 219.0f, 160.0f, 90.0f, 174.0f, 97.0f, 27.0f, 120.0f, 55.0f,
+		64.0f, 0.0f, 75.0f, 118.0f, 42.0f, 131.0f, 153.0f, 112.0f, 171.0f, 194.0f, 165.0f, 207.0f, 231.0f, 212.0f, 232.0f, 217.0f, 240.0f, 211.0f, 166.0f, 219.0f, 160.0f, 90.0f, 174.0f, 97.0f, 27.0f, 120.0f, 55.0f, 0.0f, 68.0f, 27.0f,
+		64.0f, 0.0f, 75.0f, 118.0f, 42.0f, 131.0f, 153.0f, 112.0f, 171.0f, 194.0f, 165.0f, 207.0f, 231.0f, 212.0f, 232.0f, 247.0f, 247.0f, 247.0f, 217.0f, 240.0f, 211.0f, 166.0f, 219.0f, 160.0f, 90.0f, 174.0f, 97.0f, 27.0f, 120.0f, 55.0f, 0.0f, 68.0f, 27.0f,
+		// RdYlBu
+		252.0f, 141.0f, 89.0f, 255.0f, 255.0f, 191.0f, 145.0f, 191.0f, 219.0f,
+		215.0f, 25.0f, 28.0f, 253.0f, 174.0f, 97.0f, 171.0f, 217.0f, 233.0f, 44.0f, 123.0f, 182.0f,
+		215.0f, 25.0f, 28.0f, 253.0f, 174.0f, 97.0f, 255.0f, 255.0f, 191.0f, 171.0f, 217.0f, 233.0f, 44.0f, 123.0f, 182.0f,
+		215.0f, 48.0f, 39.0f, 252.0f, 141.0f, 89.0f, 254.0f, 224.0f, 144.0f, 224.0f, 243.0f, 248.0f, 145.0f, 191.0f, 219.0f, 69.0f, 117.0f, 180.0f,
+		215.0f, 48.0f, 39.0f, 252.0f, 141.0f, 89.0f, 254.0f, 224.0f, 144.0f, 255.0f, 255.0f, 191.0f, 224.0f, 243.0f, 248.0f, 145.0f, 191.0f, 219.0f, 69.0f, 117.0f, 180.0f,
+		215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 144.0f, 224.0f, 243.0f, 248.0f, 171.0f, 217.0f, 233.0f, 116.0f, 173.0f, 209.0f, 69.0f, 117.0f, 180.0f,
+		215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 144.0f, 255.0f, 255.0f, 191.0f, 224.0f, 243.0f, 248.0f, 171.0f, 217.0f, 233.0f, 116.0f, 173.0f, 209.0f, 69.0f, 117.0f, 180.0f,
+		165.0f, 0.0f, 38.0f, 215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 144.0f, 224.0f, 243.0f, 248.0f, 171.0f, 217.0f, 233.0f, 116.0f, 173.0f, 209.0f, 69.0f, 117.0f, 180.0f, 49.0f, 54.0f, 149.0f,
+		165.0f, 0.0f, 38.0f, 215.0f, 48.0f, 39.0f, 244.0f, 109.0f, 67.0f, 253.0f, 174.0f, 97.0f, 254.0f, 224.0f, 144.0f, 255.0f, 255.0f, 191.0f, 224.0f, 243.0f, 248.0f, 171.0f, 217.0f, 233.0f, 116.0f, 173.0f, 209.0f, 69.0f, 117.0f, 180.0f, 49.0f, 54.0f, 149.0f,
+		// BrBG
+		216.0f, 179.0f, 101.0f, 245.0f, 245.0f, 245.0f, 90.0f, 180.0f, 172.0f,
+		166.0f, 97.0f, 26.0f, 223.0f, 194.0f, 125.0f, 128.0f, 205.0f, 193.0f, 1.0f, 133.0f, 113.0f,
+		166.0f, 97.0f, 26.0f, 223.0f, 194.0f, 125.0f, 245.0f, 245.0f, 245.0f, 128.0f, 205.0f, 193.0f, 1.0f, 133.0f, 113.0f,
+		140.0f, 81.0f, 10.0f, 216.0f, 179.0f, 101.0f, 246.0f, 232.0f, 195.0f, 199.0f, 234.0f, 229.0f, 90.0f, 180.0f, 172.0f, 1.0f, 102.0f, 94.0f,
+		140.0f, 81.0f, 10.0f, 216.0f, 179.0f, 101.0f, 246.0f, 232.0f, 195.0f, 245.0f, 245.0f, 245.0f, 199.0f, 234.0f, 229.0f, 90.0f, 180.0f, 172.0f, 1.0f, 102.0f, 94.0f,
+		140.0f, 81.0f, 10.0f, 191.0f, 129.0f, 45.0f, 223.0f, 194.0f, 125.0f, 246.0f, 232.0f, 195.0f, 199.0f, 234.0f, 229.0f, 128.0f, 205.0f, 193.0f, 53.0f, 151.0f, 143.0f, 1.0f, 102.0f, 94.0f,
+		140.0f, 81.0f, 10.0f, 191.0f, 129.0f, 45.0f, 223.0f, 194.0f, 125.0f, 246.0f, 232.0f, 195.0f, 245.0f, 245.0f, 245.0f, 199.0f, 234.0f, 229.0f, 128.0f, 205.0f, 193.0f, 53.0f, 151.0f, 143.0f, 1.0f, 102.0f, 94.0f,
+		84.0f, 48.0f, 5.0f, 140.0f, 81.0f, 10.0f, 191.0f, 129.0f, 45.0f, 223.0f, 194.0f, 125.0f, 246.0f, 232.0f, 195.0f, 199.0f, 234.0f, 229.0f, 128.0f, 205.0f, 193.0f, 53.0f, 151.0f, 143.0f, 1.0f, 102.0f, 94.0f, 0.0f, 60.0f, 48.0f,
+		84.0f, 48.0f, 5.0f, 140.0f, 81.0f, 10.0f, 191.0f, 129.0f, 45.0f, 223.0f, 194.0f, 125.0f, 246.0f, 232.0f, 195.0f, 245.0f, 245.0f, 245.0f, 199.0f, 234.0f, 229.0f, 128.0f, 205.0f, 193.0f, 53.0f, 151.0f, 143.0f, 1.0f, 102.0f, 94.0f, 0.0f, 60.0f, 48.0f,
+		// RdGy
+		239.0f, 138.0f, 98.0f, 255.0f, 255.0f, 255.0f, 153.0f, 153.0f, 153.0f,
+		202.0f, 0.0f, 32.0f, 244.0f, 165.0f, 130.0f, 186.0f, 186.0f, 186.0f, 64.0f, 64.0f, 64.0f,
+		202.0f, 0.0f, 32.0f, 244.0f, 165.0f, 130.0f, 255.0f, 255.0f, 255.0f, 186.0f, 186.0f, 186.0f, 64.0f, 64.0f, 64.0f,
+		178.0f, 24.0f, 43.0f, 239.0f, 138.0f, 98.0f, 253.0f, 219.0f, 199.0f, 224.0f, 224.0f, 224.0f, 153.0f, 153.0f, 153.0f, 77.0f, 77.0f, 77.0f,
+		178.0f, 24.0f, 43.0f, 239.0f, 138.0f, 98.0f, 253.0f, 219.0f, 199.0f, 255.0f, 255.0f, 255.0f, 224.0f, 224.0f, 224.0f, 153.0f, 153.0f, 153.0f, 77.0f, 77.0f, 77.0f,
+		178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 224.0f, 224.0f, 224.0f, 186.0f, 186.0f, 186.0f, 135.0f, 135.0f, 135.0f, 77.0f, 77.0f, 77.0f,
+		178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 255.0f, 255.0f, 255.0f, 224.0f, 224.0f, 224.0f, 186.0f, 186.0f, 186.0f, 135.0f, 135.0f, 135.0f, 77.0f, 77.0f, 77.0f,
+		103.0f, 0.0f, 31.0f, 178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 224.0f, 224.0f, 224.0f, 186.0f, 186.0f, 186.0f, 135.0f, 135.0f, 135.0f, 77.0f, 77.0f, 77.0f, 26.0f, 26.0f, 26.0f,
+		103.0f, 0.0f, 31.0f, 178.0f, 24.0f, 43.0f, 214.0f, 96.0f, 77.0f, 244.0f, 165.0f, 130.0f, 253.0f, 219.0f, 199.0f, 255.0f, 255.0f, 255.0f, 224.0f, 224.0f, 224.0f, 186.0f, 186.0f, 186.0f, 135.0f, 135.0f, 135.0f, 77.0f, 77.0f, 77.0f, 26.0f, 26.0f, 26.0f,
+		// PuOr
+		241.0f, 163.0f, 64.0f, 247.0f, 247.0f, 247.0f, 153.0f, 142.0f, 195.0f,
+		230.0f, 97.0f, 1.0f, 253.0f, 184.0f, 99.0f, 178.0f, 171.0f, 210.0f, 94.0f, 60.0f, 153.0f,
+		230.0f, 97.0f, 1.0f, 253.0f, 184.0f, 99.0f, 247.0f, 247.0f, 247.0f, 178.0f, 171.0f, 210.0f, 94.0f, 60.0f, 153.0f,
+		179.0f, 88.0f, 6.0f, 241.0f, 163.0f, 64.0f, 254.0f, 224.0f, 182.0f, 216.0f, 218.0f, 235.0f, 153.0f, 142.0f, 195.0f, 84.0f, 39.0f, 136.0f,
+		179.0f, 88.0f, 6.0f, 241.0f, 163.0f, 64.0f, 254.0f, 224.0f, 182.0f, 247.0f, 247.0f, 247.0f, 216.0f, 218.0f, 235.0f, 153.0f, 142.0f, 195.0f, 84.0f, 39.0f, 136.0f,
+		179.0f, 88.0f, 6.0f, 224.0f, 130.0f, 20.0f, 253.0f, 184.0f, 99.0f, 254.0f, 224.0f, 182.0f, 216.0f, 218.0f, 235.0f, 178.0f, 171.0f, 210.0f, 128.0f, 115.0f, 172.0f, 84.0f, 39.0f, 136.0f,
+		179.0f, 88.0f, 6.0f, 224.0f, 130.0f, 20.0f, 253.0f, 184.0f, 99.0f, 254.0f, 224.0f, 182.0f, 247.0f, 247.0f, 247.0f, 216.0f, 218.0f, 235.0f, 178.0f, 171.0f, 210.0f, 128.0f, 115.0f, 172.0f, 84.0f, 39.0f, 136.0f,
+		127.0f, 59.0f, 8.0f, 179.0f, 88.0f, 6.0f, 224.0f, 130.0f, 20.0f, 253.0f, 184.0f, 99.0f, 254.0f, 224.0f, 182.0f, 216.0f, 218.0f, 235.0f, 178.0f, 171.0f, 210.0f, 128.0f, 115.0f, 172.0f, 84.0f, 39.0f, 136.0f, 45.0f, 0.0f, 75.0f,
+		127.0f, 59.0f, 8.0f, 179.0f, 88.0f, 6.0f, 224.0f, 130.0f, 20.0f, 253.0f, 184.0f, 99.0f, 254.0f, 224.0f, 182.0f, 247.0f, 247.0f, 247.0f, 216.0f, 218.0f, 235.0f, 178.0f, 171.0f, 210.0f, 128.0f, 115.0f, 172.0f, 84.0f, 39.0f, 136.0f, 45.0f, 0.0f, 75.0f,
+
+		// qualitative
+		// Set2
+		102.0f, 194.0f, 165.0f, 252.0f, 141.0f, 98.0f, 141.0f, 160.0f, 203.0f,
+		102.0f, 194.0f, 165.0f, 252.0f, 141.0f, 98.0f, 141.0f, 160.0f, 203.0f, 231.0f, 138.0f, 195.0f,
+		102.0f, 194.0f, 165.0f, 252.0f, 141.0f, 98.0f, 141.0f, 160.0f, 203.0f, 231.0f, 138.0f, 195.0f, 166.0f, 216.0f, 84.0f,
+		102.0f, 194.0f, 165.0f, 252.0f, 141.0f, 98.0f, 141.0f, 160.0f, 203.0f, 231.0f, 138.0f, 195.0f, 166.0f, 216.0f, 84.0f, 255.0f, 217.0f, 47.0f,
+		102.0f, 194.0f, 165.0f, 252.0f, 141.0f, 98.0f, 141.0f, 160.0f, 203.0f, 231.0f, 138.0f, 195.0f, 166.0f, 216.0f, 84.0f, 255.0f, 217.0f, 47.0f, 229.0f, 196.0f, 148.0f,
+		102.0f, 194.0f, 165.0f, 252.0f, 141.0f, 98.0f, 141.0f, 160.0f, 203.0f, 231.0f, 138.0f, 195.0f, 166.0f, 216.0f, 84.0f, 255.0f, 217.0f, 47.0f, 229.0f, 196.0f, 148.0f, 179.0f, 179.0f, 179.0f,
+		// Accent
+		127.0f, 201.0f, 127.0f, 190.0f, 174.0f, 212.0f, 253.0f, 192.0f, 134.0f,
+		127.0f, 201.0f, 127.0f, 190.0f, 174.0f, 212.0f, 253.0f, 192.0f, 134.0f, 255.0f, 255.0f, 153.0f,
+		127.0f, 201.0f, 127.0f, 190.0f, 174.0f, 212.0f, 253.0f, 192.0f, 134.0f, 255.0f, 255.0f, 153.0f, 56.0f, 108.0f, 176.0f,
+		127.0f, 201.0f, 127.0f, 190.0f, 174.0f, 212.0f, 253.0f, 192.0f, 134.0f, 255.0f, 255.0f, 153.0f, 56.0f, 108.0f, 176.0f, 240.0f, 2.0f, 127.0f,
+		127.0f, 201.0f, 127.0f, 190.0f, 174.0f, 212.0f, 253.0f, 192.0f, 134.0f, 255.0f, 255.0f, 153.0f, 56.0f, 108.0f, 176.0f, 240.0f, 2.0f, 127.0f, 191.0f, 91.0f, 23.0f,
+		127.0f, 201.0f, 127.0f, 190.0f, 174.0f, 212.0f, 253.0f, 192.0f, 134.0f, 255.0f, 255.0f, 153.0f, 56.0f, 108.0f, 176.0f, 240.0f, 2.0f, 127.0f, 191.0f, 91.0f, 23.0f, 102.0f, 102.0f, 102.0f,
+		// Set1
+		228.0f, 26.0f, 28.0f, 55.0f, 126.0f, 184.0f, 77.0f, 175.0f, 74.0f,
+		228.0f, 26.0f, 28.0f, 55.0f, 126.0f, 184.0f, 77.0f, 175.0f, 74.0f, 152.0f, 78.0f, 163.0f,
+		228.0f, 26.0f, 28.0f, 55.0f, 126.0f, 184.0f, 77.0f, 175.0f, 74.0f, 152.0f, 78.0f, 163.0f, 255.0f, 127.0f, 0.0f,
+		228.0f, 26.0f, 28.0f, 55.0f, 126.0f, 184.0f, 77.0f, 175.0f, 74.0f, 152.0f, 78.0f, 163.0f, 255.0f, 127.0f, 0.0f, 255.0f, 255.0f, 51.0f,
+		228.0f, 26.0f, 28.0f, 55.0f, 126.0f, 184.0f, 77.0f, 175.0f, 74.0f, 152.0f, 78.0f, 163.0f, 255.0f, 127.0f, 0.0f, 255.0f, 255.0f, 51.0f, 166.0f, 86.0f, 40.0f,
+		228.0f, 26.0f, 28.0f, 55.0f, 126.0f, 184.0f, 77.0f, 175.0f, 74.0f, 152.0f, 78.0f, 163.0f, 255.0f, 127.0f, 0.0f, 255.0f, 255.0f, 51.0f, 166.0f, 86.0f, 40.0f, 247.0f, 129.0f, 191.0f,
+		228.0f, 26.0f, 28.0f, 55.0f, 126.0f, 184.0f, 77.0f, 175.0f, 74.0f, 152.0f, 78.0f, 163.0f, 255.0f, 127.0f, 0.0f, 255.0f, 255.0f, 51.0f, 166.0f, 86.0f, 40.0f, 247.0f, 129.0f, 191.0f, 153.0f, 153.0f, 153.0f,
+		// Set3
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f, 253.0f, 180.0f, 98.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f, 253.0f, 180.0f, 98.0f, 179.0f, 222.0f, 105.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f, 253.0f, 180.0f, 98.0f, 179.0f, 222.0f, 105.0f, 252.0f, 205.0f, 229.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f, 253.0f, 180.0f, 98.0f, 179.0f, 222.0f, 105.0f, 252.0f, 205.0f, 229.0f, 217.0f, 217.0f, 217.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f, 253.0f, 180.0f, 98.0f, 179.0f, 222.0f, 105.0f, 252.0f, 205.0f, 229.0f, 217.0f, 217.0f, 217.0f, 188.0f, 128.0f, 189.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f, 253.0f, 180.0f, 98.0f, 179.0f, 222.0f, 105.0f, 252.0f, 205.0f, 229.0f, 217.0f, 217.0f, 217.0f, 188.0f, 128.0f, 189.0f, 204.0f, 235.0f, 197.0f,
+		141.0f, 211.0f, 199.0f, 255.0f, 255.0f, 179.0f, 190.0f, 186.0f, 218.0f, 251.0f, 128.0f, 114.0f, 128.0f, 177.0f, 211.0f, 253.0f, 180.0f, 98.0f, 179.0f, 222.0f, 105.0f, 252.0f, 205.0f, 229.0f, 217.0f, 217.0f, 217.0f, 188.0f, 128.0f, 189.0f, 204.0f, 235.0f, 197.0f, 255.0f, 237.0f, 111.0f,
+		// Dark2
+		27.0f, 158.0f, 119.0f, 217.0f, 95.0f, 2.0f, 117.0f, 112.0f, 179.0f,
+		27.0f, 158.0f, 119.0f, 217.0f, 95.0f, 2.0f, 117.0f, 112.0f, 179.0f, 231.0f, 41.0f, 138.0f,
+		27.0f, 158.0f, 119.0f, 217.0f, 95.0f, 2.0f, 117.0f, 112.0f, 179.0f, 231.0f, 41.0f, 138.0f, 102.0f, 166.0f, 30.0f,
+		27.0f, 158.0f, 119.0f, 217.0f, 95.0f, 2.0f, 117.0f, 112.0f, 179.0f, 231.0f, 41.0f, 138.0f, 102.0f, 166.0f, 30.0f, 230.0f, 171.0f, 2.0f,
+		27.0f, 158.0f, 119.0f, 217.0f, 95.0f, 2.0f, 117.0f, 112.0f, 179.0f, 231.0f, 41.0f, 138.0f, 102.0f, 166.0f, 30.0f, 230.0f, 171.0f, 2.0f, 166.0f, 118.0f, 29.0f,
+		27.0f, 158.0f, 119.0f, 217.0f, 95.0f, 2.0f, 117.0f, 112.0f, 179.0f, 231.0f, 41.0f, 138.0f, 102.0f, 166.0f, 30.0f, 230.0f, 171.0f, 2.0f, 166.0f, 118.0f, 29.0f, 102.0f, 102.0f, 102.0f,
+		// Paired
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f, 227.0f, 26.0f, 28.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f, 227.0f, 26.0f, 28.0f, 253.0f, 191.0f, 111.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f, 227.0f, 26.0f, 28.0f, 253.0f, 191.0f, 111.0f, 255.0f, 127.0f, 0.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f, 227.0f, 26.0f, 28.0f, 253.0f, 191.0f, 111.0f, 255.0f, 127.0f, 0.0f, 202.0f, 178.0f, 214.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f, 227.0f, 26.0f, 28.0f, 253.0f, 191.0f, 111.0f, 255.0f, 127.0f, 0.0f, 202.0f, 178.0f, 214.0f, 106.0f, 61.0f, 154.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f, 227.0f, 26.0f, 28.0f, 253.0f, 191.0f, 111.0f, 255.0f, 127.0f, 0.0f, 202.0f, 178.0f, 214.0f, 106.0f, 61.0f, 154.0f, 255.0f, 255.0f, 153.0f,
+		166.0f, 206.0f, 227.0f, 31.0f, 120.0f, 180.0f, 178.0f, 223.0f, 138.0f, 51.0f, 160.0f, 44.0f, 251.0f, 154.0f, 153.0f, 227.0f, 26.0f, 28.0f, 253.0f, 191.0f, 111.0f, 255.0f, 127.0f, 0.0f, 202.0f, 178.0f, 214.0f, 106.0f, 61.0f, 154.0f, 255.0f, 255.0f, 153.0f, 177.0f, 89.0f, 40.0f,
+		// Pastel2
+		179.0f, 226.0f, 205.0f, 253.0f, 205.0f, 172.0f, 203.0f, 213.0f, 232.0f,
+		179.0f, 226.0f, 205.0f, 253.0f, 205.0f, 172.0f, 203.0f, 213.0f, 232.0f, 244.0f, 202.0f, 228.0f,
+		179.0f, 226.0f, 205.0f, 253.0f, 205.0f, 172.0f, 203.0f, 213.0f, 232.0f, 244.0f, 202.0f, 228.0f, 230.0f, 245.0f, 201.0f,
+		179.0f, 226.0f, 205.0f, 253.0f, 205.0f, 172.0f, 203.0f, 213.0f, 232.0f, 244.0f, 202.0f, 228.0f, 230.0f, 245.0f, 201.0f, 255.0f, 242.0f, 174.0f,
+		179.0f, 226.0f, 205.0f, 253.0f, 205.0f, 172.0f, 203.0f, 213.0f, 232.0f, 244.0f, 202.0f, 228.0f, 230.0f, 245.0f, 201.0f, 255.0f, 242.0f, 174.0f, 241.0f, 226.0f, 204.0f,
+		179.0f, 226.0f, 205.0f, 253.0f, 205.0f, 172.0f, 203.0f, 213.0f, 232.0f, 244.0f, 202.0f, 228.0f, 230.0f, 245.0f, 201.0f, 255.0f, 242.0f, 174.0f, 241.0f, 226.0f, 204.0f, 204.0f, 204.0f, 204.0f,
+		// Pastel1
+		251.0f, 180.0f, 174.0f, 179.0f, 205.0f, 227.0f, 204.0f, 235.0f, 197.0f,
+		251.0f, 180.0f, 174.0f, 179.0f, 205.0f, 227.0f, 204.0f, 235.0f, 197.0f, 222.0f, 203.0f, 228.0f,
+		251.0f, 180.0f, 174.0f, 179.0f, 205.0f, 227.0f, 204.0f, 235.0f, 197.0f, 222.0f, 203.0f, 228.0f, 254.0f, 217.0f, 166.0f,
+		251.0f, 180.0f, 174.0f, 179.0f, 205.0f, 227.0f, 204.0f, 235.0f, 197.0f, 222.0f, 203.0f, 228.0f, 254.0f, 217.0f, 166.0f, 255.0f, 255.0f, 204.0f,
+		251.0f, 180.0f, 174.0f, 179.0f, 205.0f, 227.0f, 204.0f, 235.0f, 197.0f, 222.0f, 203.0f, 228.0f, 254.0f, 217.0f, 166.0f, 255.0f, 255.0f, 204.0f, 229.0f, 216.0f, 189.0f,
+		251.0f, 180.0f, 174.0f, 179.0f, 205.0f, 227.0f, 204.0f, 235.0f, 197.0f, 222.0f, 203.0f, 228.0f, 254.0f, 217.0f, 166.0f, 255.0f, 255.0f, 204.0f, 229.0f, 216.0f, 189.0f, 253.0f, 218.0f, 236.0f,
+		251.0f, 180.0f, 174.0f, 179.0f, 205.0f, 227.0f, 204.0f, 235.0f, 197.0f, 222.0f, 203.0f, 228.0f, 254.0f, 217.0f, 166.0f, 255.0f, 255.0f, 204.0f, 229.0f, 216.0f, 189.0f, 253.0f, 218.0f, 236.0f, 242.0f, 242.0f, 242.0f,
+
+		// sequential
+		// OrRd
+		254.0f, 232.0f, 200.0f, 253.0f, 187.0f, 132.0f, 227.0f, 74.0f, 51.0f,
+		254.0f, 240.0f, 217.0f, 253.0f, 204.0f, 138.0f, 252.0f, 141.0f, 89.0f, 215.0f, 48.0f, 31.0f,
+		254.0f, 240.0f, 217.0f, 253.0f, 204.0f, 138.0f, 252.0f, 141.0f, 89.0f, 227.0f, 74.0f, 51.0f, 179.0f, 0.0f, 0.0f,
+		254.0f, 240.0f, 217.0f, 253.0f, 212.0f, 158.0f, 253.0f, 187.0f, 132.0f, 252.0f, 141.0f, 89.0f, 227.0f, 74.0f, 51.0f, 179.0f, 0.0f, 0.0f,
+		254.0f, 240.0f, 217.0f, 253.0f, 212.0f, 158.0f, 253.0f, 187.0f, 132.0f, 252.0f, 141.0f, 89.0f, 239.0f, 101.0f, 72.0f, 215.0f, 48.0f, 31.0f, 153.0f, 0.0f, 0.0f,
+		255.0f, 247.0f, 236.0f, 254.0f, 232.0f, 200.0f, 253.0f, 212.0f, 158.0f, 253.0f, 187.0f, 132.0f, 252.0f, 141.0f, 89.0f, 239.0f, 101.0f, 72.0f, 215.0f, 48.0f, 31.0f, 153.0f, 0.0f, 0.0f,
+		255.0f, 247.0f, 236.0f, 254.0f, 232.0f, 200.0f, 253.0f, 212.0f, 158.0f, 253.0f, 187.0f, 132.0f, 252.0f, 141.0f, 89.0f, 239.0f, 101.0f, 72.0f, 215.0f, 48.0f, 31.0f, 179.0f, 0.0f, 0.0f, 127.0f, 0.0f, 0.0f,
+		// PuBu
+		236.0f, 231.0f, 242.0f, 166.0f, 189.0f, 219.0f, 43.0f, 140.0f, 190.0f,
+		241.0f, 238.0f, 246.0f, 189.0f, 201.0f, 225.0f, 116.0f, 169.0f, 207.0f, 5.0f, 112.0f, 176.0f,
+		241.0f, 238.0f, 246.0f, 189.0f, 201.0f, 225.0f, 116.0f, 169.0f, 207.0f, 43.0f, 140.0f, 190.0f, 4.0f, 90.0f, 141.0f,
+		241.0f, 238.0f, 246.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 116.0f, 169.0f, 207.0f, 43.0f, 140.0f, 190.0f, 4.0f, 90.0f, 141.0f,
+		241.0f, 238.0f, 246.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 116.0f, 169.0f, 207.0f, 54.0f, 144.0f, 192.0f, 5.0f, 112.0f, 176.0f, 3.0f, 78.0f, 123.0f,
+		255.0f, 247.0f, 251.0f, 236.0f, 231.0f, 242.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 116.0f, 169.0f, 207.0f, 54.0f, 144.0f, 192.0f, 5.0f, 112.0f, 176.0f, 3.0f, 78.0f, 123.0f,
+		255.0f, 247.0f, 251.0f, 236.0f, 231.0f, 242.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 116.0f, 169.0f, 207.0f, 54.0f, 144.0f, 192.0f, 5.0f, 112.0f, 176.0f, 4.0f, 90.0f, 141.0f, 2.0f, 56.0f, 88.0f,
+		// BuPu
+		224.0f, 236.0f, 244.0f, 158.0f, 188.0f, 218.0f, 136.0f, 86.0f, 167.0f,
+		237.0f, 248.0f, 251.0f, 179.0f, 205.0f, 227.0f, 140.0f, 150.0f, 198.0f, 136.0f, 65.0f, 157.0f,
+		237.0f, 248.0f, 251.0f, 179.0f, 205.0f, 227.0f, 140.0f, 150.0f, 198.0f, 136.0f, 86.0f, 167.0f, 129.0f, 15.0f, 124.0f,
+		237.0f, 248.0f, 251.0f, 191.0f, 211.0f, 230.0f, 158.0f, 188.0f, 218.0f, 140.0f, 150.0f, 198.0f, 136.0f, 86.0f, 167.0f, 129.0f, 15.0f, 124.0f,
+		237.0f, 248.0f, 251.0f, 191.0f, 211.0f, 230.0f, 158.0f, 188.0f, 218.0f, 140.0f, 150.0f, 198.0f, 140.0f, 107.0f, 177.0f, 136.0f, 65.0f, 157.0f, 110.0f, 1.0f, 107.0f,
+		247.0f, 252.0f, 253.0f, 224.0f, 236.0f, 244.0f, 191.0f, 211.0f, 230.0f, 158.0f, 188.0f, 218.0f, 140.0f, 150.0f, 198.0f, 140.0f, 107.0f, 177.0f, 136.0f, 65.0f, 157.0f, 110.0f, 1.0f, 107.0f,
+		247.0f, 252.0f, 253.0f, 224.0f, 236.0f, 244.0f, 191.0f, 211.0f, 230.0f, 158.0f, 188.0f, 218.0f, 140.0f, 150.0f, 198.0f, 140.0f, 107.0f, 177.0f, 136.0f, 65.0f, 157.0f, 129.0f, 15.0f, 124.0f, 77.0f, 0.0f, 75.0f,
+		// Oranges
+		254.0f, 230.0f, 206.0f, 253.0f, 174.0f, 107.0f, 230.0f, 85.0f, 13.0f,
+		254.0f, 237.0f, 222.0f, 253.0f, 190.0f, 133.0f, 253.0f, 141.0f, 60.0f, 217.0f, 71.0f, 1.0f,
+		254.0f, 237.0f, 222.0f, 253.0f, 190.0f, 133.0f, 253.0f, 141.0f, 60.0f, 230.0f, 85.0f, 13.0f, 166.0f, 54.0f, 3.0f,
+		254.0f, 237.0f, 222.0f, 253.0f, 208.0f, 162.0f, 253.0f, 174.0f, 107.0f, 253.0f, 141.0f, 60.0f, 230.0f, 85.0f, 13.0f, 166.0f, 54.0f, 3.0f,
+		254.0f, 237.0f, 222.0f, 253.0f, 208.0f, 162.0f, 253.0f, 174.0f, 107.0f, 253.0f, 141.0f, 60.0f, 241.0f, 105.0f, 19.0f, 217.0f, 72.0f, 1.0f, 140.0f, 45.0f, 4.0f,
+		255.0f, 245.0f, 235.0f, 254.0f, 230.0f, 206.0f, 253.0f, 208.0f, 162.0f, 253.0f, 174.0f, 107.0f, 253.0f, 141.0f, 60.0f, 241.0f, 105.0f, 19.0f, 217.0f, 72.0f, 1.0f, 140.0f, 45.0f, 4.0f,
+		255.0f, 245.0f, 235.0f, 254.0f, 230.0f, 206.0f, 253.0f, 208.0f, 162.0f, 253.0f, 174.0f, 107.0f, 253.0f, 141.0f, 60.0f, 241.0f, 105.0f, 19.0f, 217.0f, 72.0f, 1.0f, 166.0f, 54.0f, 3.0f, 127.0f, 39.0f, 4.0f,
+		// BuGn
+		229.0f, 245.0f, 249.0f, 153.0f, 216.0f, 201.0f, 44.0f, 162.0f, 95.0f,
+		237.0f, 248.0f, 251.0f, 178.0f, 226.0f, 226.0f, 102.0f, 194.0f, 164.0f, 35.0f, 139.0f, 69.0f,
+		237.0f, 248.0f, 251.0f, 178.0f, 226.0f, 226.0f, 102.0f, 194.0f, 164.0f, 44.0f, 162.0f, 95.0f, 0.0f, 109.0f, 44.0f,
+		237.0f, 248.0f, 251.0f, 204.0f, 236.0f, 230.0f, 153.0f, 216.0f, 201.0f, 102.0f, 194.0f, 164.0f, 44.0f, 162.0f, 95.0f, 0.0f, 109.0f, 44.0f,
+		237.0f, 248.0f, 251.0f, 204.0f, 236.0f, 230.0f, 153.0f, 216.0f, 201.0f, 102.0f, 194.0f, 164.0f, 65.0f, 174.0f, 118.0f, 35.0f, 139.0f, 69.0f, 0.0f, 88.0f, 36.0f,
+		247.0f, 252.0f, 253.0f, 229.0f, 245.0f, 249.0f, 204.0f, 236.0f, 230.0f, 153.0f, 216.0f, 201.0f, 102.0f, 194.0f, 164.0f, 65.0f, 174.0f, 118.0f, 35.0f, 139.0f, 69.0f, 0.0f, 88.0f, 36.0f,
+		247.0f, 252.0f, 253.0f, 229.0f, 245.0f, 249.0f, 204.0f, 236.0f, 230.0f, 153.0f, 216.0f, 201.0f, 102.0f, 194.0f, 164.0f, 65.0f, 174.0f, 118.0f, 35.0f, 139.0f, 69.0f, 0.0f, 109.0f, 44.0f, 0.0f, 68.0f, 27.0f,
+		// YlOrBr
+		255.0f, 247.0f, 188.0f, 254.0f, 196.0f, 79.0f, 217.0f, 95.0f, 14.0f,
+		255.0f, 255.0f, 212.0f, 254.0f, 217.0f, 142.0f, 254.0f, 153.0f, 41.0f, 204.0f, 76.0f, 2.0f,
+		255.0f, 255.0f, 212.0f, 254.0f, 217.0f, 142.0f, 254.0f, 153.0f, 41.0f, 217.0f, 95.0f, 14.0f, 153.0f, 52.0f, 4.0f,
+		255.0f, 255.0f, 212.0f, 254.0f, 227.0f, 145.0f, 254.0f, 196.0f, 79.0f, 254.0f, 153.0f, 41.0f, 217.0f, 95.0f, 14.0f, 153.0f, 52.0f, 4.0f,
+		255.0f, 255.0f, 212.0f, 254.0f, 227.0f, 145.0f, 254.0f, 196.0f, 79.0f, 254.0f, 153.0f, 41.0f, 236.0f, 112.0f, 20.0f, 204.0f, 76.0f, 2.0f, 140.0f, 45.0f, 4.0f,
+		255.0f, 255.0f, 229.0f, 255.0f, 247.0f, 188.0f, 254.0f, 227.0f, 145.0f, 254.0f, 196.0f, 79.0f, 254.0f, 153.0f, 41.0f, 236.0f, 112.0f, 20.0f, 204.0f, 76.0f, 2.0f, 140.0f, 45.0f, 4.0f,
+		255.0f, 255.0f, 229.0f, 255.0f, 247.0f, 188.0f, 254.0f, 227.0f, 145.0f, 254.0f, 196.0f, 79.0f, 254.0f, 153.0f, 41.0f, 236.0f, 112.0f, 20.0f, 204.0f, 76.0f, 2.0f, 153.0f, 52.0f, 4.0f, 102.0f, 37.0f, 6.0f,
+		// YlGn
+		247.0f, 252.0f, 185.0f, 173.0f, 221.0f, 142.0f, 49.0f, 163.0f, 84.0f,
+		255.0f, 255.0f, 204.0f, 194.0f, 230.0f, 153.0f, 120.0f, 198.0f, 121.0f, 35.0f, 132.0f, 67.0f,
+		255.0f, 255.0f, 204.0f, 194.0f, 230.0f, 153.0f, 120.0f, 198.0f, 121.0f, 49.0f, 163.0f, 84.0f, 0.0f, 104.0f, 55.0f,
+		255.0f, 255.0f, 204.0f, 217.0f, 240.0f, 163.0f, 173.0f, 221.0f, 142.0f, 120.0f, 198.0f, 121.0f, 49.0f, 163.0f, 84.0f, 0.0f, 104.0f, 55.0f,
+		255.0f, 255.0f, 204.0f, 217.0f, 240.0f, 163.0f, 173.0f, 221.0f, 142.0f, 120.0f, 198.0f, 121.0f, 65.0f, 171.0f, 93.0f, 35.0f, 132.0f, 67.0f, 0.0f, 90.0f, 50.0f,
+		255.0f, 255.0f, 229.0f, 247.0f, 252.0f, 185.0f, 217.0f, 240.0f, 163.0f, 173.0f, 221.0f, 142.0f, 120.0f, 198.0f, 121.0f, 65.0f, 171.0f, 93.0f, 35.0f, 132.0f, 67.0f, 0.0f, 90.0f, 50.0f,
+		255.0f, 255.0f, 229.0f, 247.0f, 252.0f, 185.0f, 217.0f, 240.0f, 163.0f, 173.0f, 221.0f, 142.0f, 120.0f, 198.0f, 121.0f, 65.0f, 171.0f, 93.0f, 35.0f, 132.0f, 67.0f, 0.0f, 104.0f, 55.0f, 0.0f, 69.0f, 41.0f,
+		// Reds
+		254.0f, 224.0f, 210.0f, 252.0f, 146.0f, 114.0f, 222.0f, 45.0f, 38.0f,
+		254.0f, 229.0f, 217.0f, 252.0f, 174.0f, 145.0f, 251.0f, 106.0f, 74.0f, 203.0f, 24.0f, 29.0f,
+		254.0f, 229.0f, 217.0f, 252.0f, 174.0f, 145.0f, 251.0f, 106.0f, 74.0f, 222.0f, 45.0f, 38.0f, 165.0f, 15.0f, 21.0f,
+		254.0f, 229.0f, 217.0f, 252.0f, 187.0f, 161.0f, 252.0f, 146.0f, 114.0f, 251.0f, 106.0f, 74.0f, 222.0f, 45.0f, 38.0f, 165.0f, 15.0f, 21.0f,
+		254.0f, 229.0f, 217.0f, 252.0f, 187.0f, 161.0f, 252.0f, 146.0f, 114.0f, 251.0f, 106.0f, 74.0f, 239.0f, 59.0f, 44.0f, 203.0f, 24.0f, 29.0f, 153.0f, 0.0f, 13.0f,
+		255.0f, 245.0f, 240.0f, 254.0f, 224.0f, 210.0f, 252.0f, 187.0f, 161.0f, 252.0f, 146.0f, 114.0f, 251.0f, 106.0f, 74.0f, 239.0f, 59.0f, 44.0f, 203.0f, 24.0f, 29.0f, 153.0f, 0.0f, 13.0f,
+		255.0f, 245.0f, 240.0f, 254.0f, 224.0f, 210.0f, 252.0f, 187.0f, 161.0f, 252.0f, 146.0f, 114.0f, 251.0f, 106.0f, 74.0f, 239.0f, 59.0f, 44.0f, 203.0f, 24.0f, 29.0f, 165.0f, 15.0f, 21.0f, 103.0f, 0.0f, 13.0f,
+		// RdPu
+		253.0f, 224.0f, 221.0f, 250.0f, 159.0f, 181.0f, 197.0f, 27.0f, 138.0f,
+		254.0f, 235.0f, 226.0f, 251.0f, 180.0f, 185.0f, 247.0f, 104.0f, 161.0f, 174.0f, 1.0f, 126.0f,
+		254.0f, 235.0f, 226.0f, 251.0f, 180.0f, 185.0f, 247.0f, 104.0f, 161.0f, 197.0f, 27.0f, 138.0f, 122.0f, 1.0f, 119.0f,
+		254.0f, 235.0f, 226.0f, 252.0f, 197.0f, 192.0f, 250.0f, 159.0f, 181.0f, 247.0f, 104.0f, 161.0f, 197.0f, 27.0f, 138.0f, 122.0f, 1.0f, 119.0f,
+		254.0f, 235.0f, 226.0f, 252.0f, 197.0f, 192.0f, 250.0f, 159.0f, 181.0f, 247.0f, 104.0f, 161.0f, 221.0f, 52.0f, 151.0f, 174.0f, 1.0f, 126.0f, 122.0f, 1.0f, 119.0f,
+		255.0f, 247.0f, 243.0f, 253.0f, 224.0f, 221.0f, 252.0f, 197.0f, 192.0f, 250.0f, 159.0f, 181.0f, 247.0f, 104.0f, 161.0f, 221.0f, 52.0f, 151.0f, 174.0f, 1.0f, 126.0f, 122.0f, 1.0f, 119.0f,
+		255.0f, 247.0f, 243.0f, 253.0f, 224.0f, 221.0f, 252.0f, 197.0f, 192.0f, 250.0f, 159.0f, 181.0f, 247.0f, 104.0f, 161.0f, 221.0f, 52.0f, 151.0f, 174.0f, 1.0f, 126.0f, 122.0f, 1.0f, 119.0f, 73.0f, 0.0f, 106.0f,
+		// Greens
+		229.0f, 245.0f, 224.0f, 161.0f, 217.0f, 155.0f, 49.0f, 163.0f, 84.0f,
+		237.0f, 248.0f, 233.0f, 186.0f, 228.0f, 179.0f, 116.0f, 196.0f, 118.0f, 35.0f, 139.0f, 69.0f,
+		237.0f, 248.0f, 233.0f, 186.0f, 228.0f, 179.0f, 116.0f, 196.0f, 118.0f, 49.0f, 163.0f, 84.0f, 0.0f, 109.0f, 44.0f,
+		237.0f, 248.0f, 233.0f, 199.0f, 233.0f, 192.0f, 161.0f, 217.0f, 155.0f, 116.0f, 196.0f, 118.0f, 49.0f, 163.0f, 84.0f, 0.0f, 109.0f, 44.0f,
+		237.0f, 248.0f, 233.0f, 199.0f, 233.0f, 192.0f, 161.0f, 217.0f, 155.0f, 116.0f, 196.0f, 118.0f, 65.0f, 171.0f, 93.0f, 35.0f, 139.0f, 69.0f, 0.0f, 90.0f, 50.0f,
+		247.0f, 252.0f, 245.0f, 229.0f, 245.0f, 224.0f, 199.0f, 233.0f, 192.0f, 161.0f, 217.0f, 155.0f, 116.0f, 196.0f, 118.0f, 65.0f, 171.0f, 93.0f, 35.0f, 139.0f, 69.0f, 0.0f, 90.0f, 50.0f,
+		247.0f, 252.0f, 245.0f, 229.0f, 245.0f, 224.0f, 199.0f, 233.0f, 192.0f, 161.0f, 217.0f, 155.0f, 116.0f, 196.0f, 118.0f, 65.0f, 171.0f, 93.0f, 35.0f, 139.0f, 69.0f, 0.0f, 109.0f, 44.0f, 0.0f, 68.0f, 27.0f,
+		// YlGnBu
+		237.0f, 248.0f, 177.0f, 127.0f, 205.0f, 187.0f, 44.0f, 127.0f, 184.0f,
+		255.0f, 255.0f, 204.0f, 161.0f, 218.0f, 180.0f, 65.0f, 182.0f, 196.0f, 34.0f, 94.0f, 168.0f,
+		255.0f, 255.0f, 204.0f, 161.0f, 218.0f, 180.0f, 65.0f, 182.0f, 196.0f, 44.0f, 127.0f, 184.0f, 37.0f, 52.0f, 148.0f,
+		255.0f, 255.0f, 204.0f, 199.0f, 233.0f, 180.0f, 127.0f, 205.0f, 187.0f, 65.0f, 182.0f, 196.0f, 44.0f, 127.0f, 184.0f, 37.0f, 52.0f, 148.0f,
+		255.0f, 255.0f, 204.0f, 199.0f, 233.0f, 180.0f, 127.0f, 205.0f, 187.0f, 65.0f, 182.0f, 196.0f, 29.0f, 145.0f, 192.0f, 34.0f, 94.0f, 168.0f, 12.0f, 44.0f, 132.0f,
+		255.0f, 255.0f, 217.0f, 237.0f, 248.0f, 177.0f, 199.0f, 233.0f, 180.0f, 127.0f, 205.0f, 187.0f, 65.0f, 182.0f, 196.0f, 29.0f, 145.0f, 192.0f, 34.0f, 94.0f, 168.0f, 12.0f, 44.0f, 132.0f,
+		255.0f, 255.0f, 217.0f, 237.0f, 248.0f, 177.0f, 199.0f, 233.0f, 180.0f, 127.0f, 205.0f, 187.0f, 65.0f, 182.0f, 196.0f, 29.0f, 145.0f, 192.0f, 34.0f, 94.0f, 168.0f, 37.0f, 52.0f, 148.0f, 8.0f, 29.0f, 88.0f,
+		// Purples
+		239.0f, 237.0f, 245.0f, 188.0f, 189.0f, 220.0f, 117.0f, 107.0f, 177.0f,
+		242.0f, 240.0f, 247.0f, 203.0f, 201.0f, 226.0f, 158.0f, 154.0f, 200.0f, 106.0f, 81.0f, 163.0f,
+		242.0f, 240.0f, 247.0f, 203.0f, 201.0f, 226.0f, 158.0f, 154.0f, 200.0f, 117.0f, 107.0f, 177.0f, 84.0f, 39.0f, 143.0f,
+		242.0f, 240.0f, 247.0f, 218.0f, 218.0f, 235.0f, 188.0f, 189.0f, 220.0f, 158.0f, 154.0f, 200.0f, 117.0f, 107.0f, 177.0f, 84.0f, 39.0f, 143.0f,
+		242.0f, 240.0f, 247.0f, 218.0f, 218.0f, 235.0f, 188.0f, 189.0f, 220.0f, 158.0f, 154.0f, 200.0f, 128.0f, 125.0f, 186.0f, 106.0f, 81.0f, 163.0f, 74.0f, 20.0f, 134.0f,
+		252.0f, 251.0f, 253.0f, 239.0f, 237.0f, 245.0f, 218.0f, 218.0f, 235.0f, 188.0f, 189.0f, 220.0f, 158.0f, 154.0f, 200.0f, 128.0f, 125.0f, 186.0f, 106.0f, 81.0f, 163.0f, 74.0f, 20.0f, 134.0f,
+		252.0f, 251.0f, 253.0f, 239.0f, 237.0f, 245.0f, 218.0f, 218.0f, 235.0f, 188.0f, 189.0f, 220.0f, 158.0f, 154.0f, 200.0f, 128.0f, 125.0f, 186.0f, 106.0f, 81.0f, 163.0f, 84.0f, 39.0f, 143.0f, 63.0f, 0.0f, 125.0f,
+		// GnBu
+		224.0f, 243.0f, 219.0f, 168.0f, 221.0f, 181.0f, 67.0f, 162.0f, 202.0f,
+		240.0f, 249.0f, 232.0f, 186.0f, 228.0f, 188.0f, 123.0f, 204.0f, 196.0f, 43.0f, 140.0f, 190.0f,
+		240.0f, 249.0f, 232.0f, 186.0f, 228.0f, 188.0f, 123.0f, 204.0f, 196.0f, 67.0f, 162.0f, 202.0f, 8.0f, 104.0f, 172.0f,
+		240.0f, 249.0f, 232.0f, 204.0f, 235.0f, 197.0f, 168.0f, 221.0f, 181.0f, 123.0f, 204.0f, 196.0f, 67.0f, 162.0f, 202.0f, 8.0f, 104.0f, 172.0f,
+		240.0f, 249.0f, 232.0f, 204.0f, 235.0f, 197.0f, 168.0f, 221.0f, 181.0f, 123.0f, 204.0f, 196.0f, 78.0f, 179.0f, 211.0f, 43.0f, 140.0f, 190.0f, 8.0f, 88.0f, 158.0f,
+		247.0f, 252.0f, 240.0f, 224.0f, 243.0f, 219.0f, 204.0f, 235.0f, 197.0f, 168.0f, 221.0f, 181.0f, 123.0f, 204.0f, 196.0f, 78.0f, 179.0f, 211.0f, 43.0f, 140.0f, 190.0f, 8.0f, 88.0f, 158.0f,
+		247.0f, 252.0f, 240.0f, 224.0f, 243.0f, 219.0f, 204.0f, 235.0f, 197.0f, 168.0f, 221.0f, 181.0f, 123.0f, 204.0f, 196.0f, 78.0f, 179.0f, 211.0f, 43.0f, 140.0f, 190.0f, 8.0f, 104.0f, 172.0f, 8.0f, 64.0f, 129.0f,
+		// Greys
+		240.0f, 240.0f, 240.0f, 189.0f, 189.0f, 189.0f, 99.0f, 99.0f, 99.0f,
+		247.0f, 247.0f, 247.0f, 204.0f, 204.0f, 204.0f, 150.0f, 150.0f, 150.0f, 82.0f, 82.0f, 82.0f,
+		247.0f, 247.0f, 247.0f, 204.0f, 204.0f, 204.0f, 150.0f, 150.0f, 150.0f, 99.0f, 99.0f, 99.0f, 37.0f, 37.0f, 37.0f,
+		247.0f, 247.0f, 247.0f, 217.0f, 217.0f, 217.0f, 189.0f, 189.0f, 189.0f, 150.0f, 150.0f, 150.0f, 99.0f, 99.0f, 99.0f, 37.0f, 37.0f, 37.0f,
+		247.0f, 247.0f, 247.0f, 217.0f, 217.0f, 217.0f, 189.0f, 189.0f, 189.0f, 150.0f, 150.0f, 150.0f, 115.0f, 115.0f, 115.0f, 82.0f, 82.0f, 82.0f, 37.0f, 37.0f, 37.0f,
+		255.0f, 255.0f, 255.0f, 240.0f, 240.0f, 240.0f, 217.0f, 217.0f, 217.0f, 189.0f, 189.0f, 189.0f, 150.0f, 150.0f, 150.0f, 115.0f, 115.0f, 115.0f, 82.0f, 82.0f, 82.0f, 37.0f, 37.0f, 37.0f,
+		255.0f, 255.0f, 255.0f, 240.0f, 240.0f, 240.0f, 217.0f, 217.0f, 217.0f, 189.0f, 189.0f, 189.0f, 150.0f, 150.0f, 150.0f, 115.0f, 115.0f, 115.0f, 82.0f, 82.0f, 82.0f, 37.0f, 37.0f, 37.0f, 0.0f, 0.0f, 0.0f,
+		// YlOrRd
+		255.0f, 237.0f, 160.0f, 254.0f, 178.0f, 76.0f, 240.0f, 59.0f, 32.0f,
+		255.0f, 255.0f, 178.0f, 254.0f, 204.0f, 92.0f, 253.0f, 141.0f, 60.0f, 227.0f, 26.0f, 28.0f,
+		255.0f, 255.0f, 178.0f, 254.0f, 204.0f, 92.0f, 253.0f, 141.0f, 60.0f, 240.0f, 59.0f, 32.0f, 189.0f, 0.0f, 38.0f,
+		255.0f, 255.0f, 178.0f, 254.0f, 217.0f, 118.0f, 254.0f, 178.0f, 76.0f, 253.0f, 141.0f, 60.0f, 240.0f, 59.0f, 32.0f, 189.0f, 0.0f, 38.0f,
+		255.0f, 255.0f, 178.0f, 254.0f, 217.0f, 118.0f, 254.0f, 178.0f, 76.0f, 253.0f, 141.0f, 60.0f, 252.0f, 78.0f, 42.0f, 227.0f, 26.0f, 28.0f, 177.0f, 0.0f, 38.0f,
+		255.0f, 255.0f, 204.0f, 255.0f, 237.0f, 160.0f, 254.0f, 217.0f, 118.0f, 254.0f, 178.0f, 76.0f, 253.0f, 141.0f, 60.0f, 252.0f, 78.0f, 42.0f, 227.0f, 26.0f, 28.0f, 177.0f, 0.0f, 38.0f,
+		255.0f, 255.0f, 204.0f, 255.0f, 237.0f, 160.0f, 254.0f, 217.0f, 118.0f, 254.0f, 178.0f, 76.0f, 253.0f, 141.0f, 60.0f, 252.0f, 78.0f, 42.0f, 227.0f, 26.0f, 28.0f, 189.0f, 0.0f, 38.0f, 128.0f, 0.0f, 38.0f,
+		// PuRd
+		231.0f, 225.0f, 239.0f, 201.0f, 148.0f, 199.0f, 221.0f, 28.0f, 119.0f,
+		241.0f, 238.0f, 246.0f, 215.0f, 181.0f, 216.0f, 223.0f, 101.0f, 176.0f, 206.0f, 18.0f, 86.0f,
+		241.0f, 238.0f, 246.0f, 215.0f, 181.0f, 216.0f, 223.0f, 101.0f, 176.0f, 221.0f, 28.0f, 119.0f, 152.0f, 0.0f, 67.0f,
+		241.0f, 238.0f, 246.0f, 212.0f, 185.0f, 218.0f, 201.0f, 148.0f, 199.0f, 223.0f, 101.0f, 176.0f, 221.0f, 28.0f, 119.0f, 152.0f, 0.0f, 67.0f,
+		241.0f, 238.0f, 246.0f, 212.0f, 185.0f, 218.0f, 201.0f, 148.0f, 199.0f, 223.0f, 101.0f, 176.0f, 231.0f, 41.0f, 138.0f, 206.0f, 18.0f, 86.0f, 145.0f, 0.0f, 63.0f,
+		247.0f, 244.0f, 249.0f, 231.0f, 225.0f, 239.0f, 212.0f, 185.0f, 218.0f, 201.0f, 148.0f, 199.0f, 223.0f, 101.0f, 176.0f, 231.0f, 41.0f, 138.0f, 206.0f, 18.0f, 86.0f, 145.0f, 0.0f, 63.0f,
+		247.0f, 244.0f, 249.0f, 231.0f, 225.0f, 239.0f, 212.0f, 185.0f, 218.0f, 201.0f, 148.0f, 199.0f, 223.0f, 101.0f, 176.0f, 231.0f, 41.0f, 138.0f, 206.0f, 18.0f, 86.0f, 152.0f, 0.0f, 67.0f, 103.0f, 0.0f, 31.0f,
+		// Blues
+		222.0f, 235.0f, 247.0f, 158.0f, 202.0f, 225.0f, 49.0f, 130.0f, 189.0f,
+		239.0f, 243.0f, 255.0f, 189.0f, 215.0f, 231.0f, 107.0f, 174.0f, 214.0f, 33.0f, 113.0f, 181.0f,
+		239.0f, 243.0f, 255.0f, 189.0f, 215.0f, 231.0f, 107.0f, 174.0f, 214.0f, 49.0f, 130.0f, 189.0f, 8.0f, 81.0f, 156.0f,
+		239.0f, 243.0f, 255.0f, 198.0f, 219.0f, 239.0f, 158.0f, 202.0f, 225.0f, 107.0f, 174.0f, 214.0f, 49.0f, 130.0f, 189.0f, 8.0f, 81.0f, 156.0f,
+		239.0f, 243.0f, 255.0f, 198.0f, 219.0f, 239.0f, 158.0f, 202.0f, 225.0f, 107.0f, 174.0f, 214.0f, 66.0f, 146.0f, 198.0f, 33.0f, 113.0f, 181.0f, 8.0f, 69.0f, 148.0f,
+		247.0f, 251.0f, 255.0f, 222.0f, 235.0f, 247.0f, 198.0f, 219.0f, 239.0f, 158.0f, 202.0f, 225.0f, 107.0f, 174.0f, 214.0f, 66.0f, 146.0f, 198.0f, 33.0f, 113.0f, 181.0f, 8.0f, 69.0f, 148.0f,
+		247.0f, 251.0f, 255.0f, 222.0f, 235.0f, 247.0f, 198.0f, 219.0f, 239.0f, 158.0f, 202.0f, 225.0f, 107.0f, 174.0f, 214.0f, 66.0f, 146.0f, 198.0f, 33.0f, 113.0f, 181.0f, 8.0f, 81.0f, 156.0f, 8.0f, 48.0f, 107.0f,
+		// PuBuGn
+		236.0f, 226.0f, 240.0f, 166.0f, 189.0f, 219.0f, 28.0f, 144.0f, 153.0f,
+		246.0f, 239.0f, 247.0f, 189.0f, 201.0f, 225.0f, 103.0f, 169.0f, 207.0f, 2.0f, 129.0f, 138.0f,
+		246.0f, 239.0f, 247.0f, 189.0f, 201.0f, 225.0f, 103.0f, 169.0f, 207.0f, 28.0f, 144.0f, 153.0f, 1.0f, 108.0f, 89.0f,
+		246.0f, 239.0f, 247.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 103.0f, 169.0f, 207.0f, 28.0f, 144.0f, 153.0f, 1.0f, 108.0f, 89.0f,
+		246.0f, 239.0f, 247.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 103.0f, 169.0f, 207.0f, 54.0f, 144.0f, 192.0f, 2.0f, 129.0f, 138.0f, 1.0f, 100.0f, 80.0f,
+		255.0f, 247.0f, 251.0f, 236.0f, 226.0f, 240.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 103.0f, 169.0f, 207.0f, 54.0f, 144.0f, 192.0f, 2.0f, 129.0f, 138.0f, 1.0f, 100.0f, 80.0f,
+		255.0f, 247.0f, 251.0f, 236.0f, 226.0f, 240.0f, 208.0f, 209.0f, 230.0f, 166.0f, 189.0f, 219.0f, 103.0f, 169.0f, 207.0f, 54.0f, 144.0f, 192.0f, 2.0f, 129.0f, 138.0f, 1.0f, 108.0f, 89.0f, 1.0f, 70.0f, 54.0f
+	};
+
+
+	constexpr float normalizedTable[5067] =
+	{
+		// diverging
+		// Spectral
+		0.9882353f, 0.5529412f, 0.34901962f, 1.0f, 1.0f, 0.7490196f, 0.6f, 0.8352941f, 0.5803922f,
+		0.84313726f, 0.09803922f, 0.10980392f, 0.99215686f, 0.68235296f, 0.38039216f, 0.67058825f, 0.8666667f, 0.6431373f, 0.16862746f, 0.5137255f, 0.7294118f,
+		0.84313726f, 0.09803922f, 0.10980392f, 0.99215686f, 0.68235296f, 0.38039216f, 1.0f, 1.0f, 0.7490196f, 0.67058825f, 0.8666667f, 0.6431373f, 0.16862746f, 0.5137255f, 0.7294118f,
+		0.8352941f, 0.24313726f, 0.30980393f, 0.9882353f, 0.5529412f, 0.34901962f, 0.99607843f, 0.8784314f, 0.54509807f, 0.9019608f, 0.9607843f, 0.59607846f, 0.6f, 0.8352941f, 0.5803922f, 0.19607843f, 0.53333336f, 0.7411765f,
+		0.8352941f, 0.24313726f, 0.30980393f, 0.9882353f, 0.5529412f, 0.34901962f, 0.99607843f, 0.8784314f, 0.54509807f, 1.0f, 1.0f, 0.7490196f, 0.9019608f, 0.9607843f, 0.59607846f, 0.6f, 0.8352941f, 0.5803922f, 0.19607843f, 0.53333336f, 0.7411765f,
+		0.8352941f, 0.24313726f, 0.30980393f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 0.9019608f, 0.9607843f, 0.59607846f, 0.67058825f, 0.8666667f, 0.6431373f, 0.4f, 0.7607843f, 0.64705884f, 0.19607843f, 0.53333336f, 0.7411765f,
+		0.8352941f, 0.24313726f, 0.30980393f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 1.0f, 1.0f, 0.7490196f, 0.9019608f, 0.9607843f, 0.59607846f, 0.67058825f, 0.8666667f, 0.6431373f, 0.4f, 0.7607843f, 0.64705884f, 0.19607843f, 0.53333336f, 0.7411765f,
+		0.61960787f, 0.003921569f, 0.25882354f, 0.8352941f, 0.24313726f, 0.30980393f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 0.9019608f, 0.9607843f, 0.59607846f, 0.67058825f, 0.8666667f, 0.6431373f, 0.4f, 0.7607843f, 0.64705884f, 0.19607843f, 0.53333336f, 0.7411765f, 0.36862746f, 0.30980393f, 0.63529414f,
+		0.61960787f, 0.003921569f, 0.25882354f, 0.8352941f, 0.24313726f, 0.30980393f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 1.0f, 1.0f, 0.7490196f, 0.9019608f, 0.9607843f, 0.59607846f, 0.67058825f, 0.8666667f, 0.6431373f, 0.4f, 0.7607843f, 0.64705884f, 0.19607843f, 0.53333336f, 0.7411765f, 0.36862746f, 0.30980393f, 0.63529414f,
+		// RdYlGn
+		0.9882353f, 0.5529412f, 0.34901962f, 1.0f, 1.0f, 0.7490196f, 0.5686275f, 0.8117647f, 0.3764706f,
+		0.84313726f, 0.09803922f, 0.10980392f, 0.99215686f, 0.68235296f, 0.38039216f, 0.6509804f, 0.8509804f, 0.41568628f, 0.101960786f, 0.5882353f, 0.25490198f,
+		0.84313726f, 0.09803922f, 0.10980392f, 0.99215686f, 0.68235296f, 0.38039216f, 1.0f, 1.0f, 0.7490196f, 0.6509804f, 0.8509804f, 0.41568628f, 0.101960786f, 0.5882353f, 0.25490198f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.9882353f, 0.5529412f, 0.34901962f, 0.99607843f, 0.8784314f, 0.54509807f, 0.8509804f, 0.9372549f, 0.54509807f, 0.5686275f, 0.8117647f, 0.3764706f, 0.101960786f, 0.59607846f, 0.3137255f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.9882353f, 0.5529412f, 0.34901962f, 0.99607843f, 0.8784314f, 0.54509807f, 1.0f, 1.0f, 0.7490196f, 0.8509804f, 0.9372549f, 0.54509807f, 0.5686275f, 0.8117647f, 0.3764706f, 0.101960786f, 0.59607846f, 0.3137255f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 0.8509804f, 0.9372549f, 0.54509807f, 0.6509804f, 0.8509804f, 0.41568628f, 0.4f, 0.7411765f, 0.3882353f, 0.101960786f, 0.59607846f, 0.3137255f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 1.0f, 1.0f, 0.7490196f, 0.8509804f, 0.9372549f, 0.54509807f, 0.6509804f, 0.8509804f, 0.41568628f, 0.4f, 0.7411765f, 0.3882353f, 0.101960786f, 0.59607846f, 0.3137255f,
+		0.64705884f, 0.0f, 0.14901961f, 0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 0.8509804f, 0.9372549f, 0.54509807f, 0.6509804f, 0.8509804f, 0.41568628f, 0.4f, 0.7411765f, 0.3882353f, 0.101960786f, 0.59607846f, 0.3137255f, 0.0f, 0.40784314f, 0.21568628f,
+		0.64705884f, 0.0f, 0.14901961f, 0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.54509807f, 1.0f, 1.0f, 0.7490196f, 0.8509804f, 0.9372549f, 0.54509807f, 0.6509804f, 0.8509804f, 0.41568628f, 0.4f, 0.7411765f, 0.3882353f, 0.101960786f, 0.59607846f, 0.3137255f, 0.0f, 0.40784314f, 0.21568628f,
+		// RdBu
+		0.9372549f, 0.5411765f, 0.38431373f, 0.96862745f, 0.96862745f, 0.96862745f, 0.40392157f, 0.6627451f, 0.8117647f,
+		0.7921569f, 0.0f, 0.1254902f, 0.95686275f, 0.64705884f, 0.50980395f, 0.57254905f, 0.77254903f, 0.87058824f, 0.019607844f, 0.44313726f, 0.6901961f,
+		0.7921569f, 0.0f, 0.1254902f, 0.95686275f, 0.64705884f, 0.50980395f, 0.96862745f, 0.96862745f, 0.96862745f, 0.57254905f, 0.77254903f, 0.87058824f, 0.019607844f, 0.44313726f, 0.6901961f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.9372549f, 0.5411765f, 0.38431373f, 0.99215686f, 0.85882354f, 0.78039217f, 0.81960785f, 0.8980392f, 0.9411765f, 0.40392157f, 0.6627451f, 0.8117647f, 0.12941177f, 0.4f, 0.6745098f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.9372549f, 0.5411765f, 0.38431373f, 0.99215686f, 0.85882354f, 0.78039217f, 0.96862745f, 0.96862745f, 0.96862745f, 0.81960785f, 0.8980392f, 0.9411765f, 0.40392157f, 0.6627451f, 0.8117647f, 0.12941177f, 0.4f, 0.6745098f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 0.81960785f, 0.8980392f, 0.9411765f, 0.57254905f, 0.77254903f, 0.87058824f, 0.2627451f, 0.5764706f, 0.7647059f, 0.12941177f, 0.4f, 0.6745098f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 0.96862745f, 0.96862745f, 0.96862745f, 0.81960785f, 0.8980392f, 0.9411765f, 0.57254905f, 0.77254903f, 0.87058824f, 0.2627451f, 0.5764706f, 0.7647059f, 0.12941177f, 0.4f, 0.6745098f,
+		0.40392157f, 0.0f, 0.12156863f, 0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 0.81960785f, 0.8980392f, 0.9411765f, 0.57254905f, 0.77254903f, 0.87058824f, 0.2627451f, 0.5764706f, 0.7647059f, 0.12941177f, 0.4f, 0.6745098f, 0.019607844f, 0.1882353f, 0.38039216f,
+		0.40392157f, 0.0f, 0.12156863f, 0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 0.96862745f, 0.96862745f, 0.96862745f, 0.81960785f, 0.8980392f, 0.9411765f, 0.57254905f, 0.77254903f, 0.87058824f, 0.2627451f, 0.5764706f, 0.7647059f, 0.12941177f, 0.4f, 0.6745098f, 0.019607844f, 0.1882353f, 0.38039216f,
+		// PiYG
+		0.9137255f, 0.6392157f, 0.7882353f, 0.96862745f, 0.96862745f, 0.96862745f, 0.6313726f, 0.84313726f, 0.41568628f,
+		0.8156863f, 0.10980392f, 0.54509807f, 0.94509804f, 0.7137255f, 0.85490197f, 0.72156864f, 0.88235295f, 0.5254902f, 0.3019608f, 0.6745098f, 0.14901961f,
+		0.8156863f, 0.10980392f, 0.54509807f, 0.94509804f, 0.7137255f, 0.85490197f, 0.96862745f, 0.96862745f, 0.96862745f, 0.72156864f, 0.88235295f, 0.5254902f, 0.3019608f, 0.6745098f, 0.14901961f,
+		0.77254903f, 0.105882354f, 0.49019608f, 0.9137255f, 0.6392157f, 0.7882353f, 0.99215686f, 0.8784314f, 0.9372549f, 0.9019608f, 0.9607843f, 0.8156863f, 0.6313726f, 0.84313726f, 0.41568628f, 0.3019608f, 0.57254905f, 0.12941177f,
+		0.77254903f, 0.105882354f, 0.49019608f, 0.9137255f, 0.6392157f, 0.7882353f, 0.99215686f, 0.8784314f, 0.9372549f, 0.96862745f, 0.96862745f, 0.96862745f, 0.9019608f, 0.9607843f, 0.8156863f, 0.6313726f, 0.84313726f, 0.41568628f, 0.3019608f, 0.57254905f, 0.12941177f,
+		0.77254903f, 0.105882354f, 0.49019608f, 0.87058824f, 0.46666667f, 0.68235296f, 0.94509804f, 0.7137255f, 0.85490197f, 0.99215686f, 0.8784314f, 0.9372549f, 0.9019608f, 0.9607843f, 0.8156863f, 0.72156864f, 0.88235295f, 0.5254902f, 0.49803922f, 0.7372549f, 0.25490198f, 0.3019608f, 0.57254905f, 0.12941177f,
+		0.77254903f, 0.105882354f, 0.49019608f, 0.87058824f, 0.46666667f, 0.68235296f, 0.94509804f, 0.7137255f, 0.85490197f, 0.99215686f, 0.8784314f, 0.9372549f, 0.96862745f, 0.96862745f, 0.96862745f, 0.9019608f, 0.9607843f, 0.8156863f, 0.72156864f, 0.88235295f, 0.5254902f, 0.49803922f, 0.7372549f, 0.25490198f, 0.3019608f, 0.57254905f, 0.12941177f,
+		0.5568628f, 0.003921569f, 0.32156864f, 0.77254903f, 0.105882354f, 0.49019608f, 0.87058824f, 0.46666667f, 0.68235296f, 0.94509804f, 0.7137255f, 0.85490197f, 0.99215686f, 0.8784314f, 0.9372549f, 0.9019608f, 0.9607843f, 0.8156863f, 0.72156864f, 0.88235295f, 0.5254902f, 0.49803922f, 0.7372549f, 0.25490198f, 0.3019608f, 0.57254905f, 0.12941177f, 0.15294118f, 0.39215687f, 0.09803922f,
+		0.5568628f, 0.003921569f, 0.32156864f, 0.77254903f, 0.105882354f, 0.49019608f, 0.87058824f, 0.46666667f, 0.68235296f, 0.94509804f, 0.7137255f, 0.85490197f, 0.99215686f, 0.8784314f, 0.9372549f, 0.96862745f, 0.96862745f, 0.96862745f, 0.9019608f, 0.9607843f, 0.8156863f, 0.72156864f, 0.88235295f, 0.5254902f, 0.49803922f, 0.7372549f, 0.25490198f, 0.3019608f, 0.57254905f, 0.12941177f, 0.15294118f, 0.39215687f, 0.09803922f,
+		// PRGn
+		0.6862745f, 0.5529412f, 0.7647059f, 0.96862745f, 0.96862745f, 0.96862745f, 0.49803922f, 0.7490196f, 0.48235294f,
+		0.48235294f, 0.19607843f, 0.5803922f, 0.7607843f, 0.64705884f, 0.8117647f, 0.6509804f, 0.85882354f, 0.627451f, 0.0f, 0.53333336f, 0.21568628f,
+		0.48235294f, 0.19607843f, 0.5803922f, 0.7607843f, 0.64705884f, 0.8117647f, 0.96862745f, 0.96862745f, 0.96862745f, 0.6509804f, 0.85882354f, 0.627451f, 0.0f, 0.53333336f, 0.21568628f,
+		0.4627451f, 0.16470589f, 0.5137255f, 0.6862745f, 0.5529412f, 0.7647059f, 0.90588236f, 0.83137256f, 0.9098039f, 0.8509804f, 0.9411765f, 0.827451f, 0.49803922f, 0.7490196f, 0.48235294f, 0.105882354f, 0.47058824f, 0.21568628f,
+		0.4627451f, 0.16470589f, 0.5137255f, 0.6862745f, 0.5529412f, 0.7647059f, 0.90588236f, 0.83137256f, 0.9098039f, 0.96862745f, 0.96862745f, 0.96862745f, 0.8509804f, 0.9411765f, 0.827451f, 0.49803922f, 0.7490196f, 0.48235294f, 0.105882354f, 0.47058824f, 0.21568628f,
+		0.4627451f, 0.16470589f, 0.5137255f, 0.6f, 0.4392157f, 0.67058825f, 0.7607843f, 0.64705884f, 0.8117647f, 0.90588236f, 0.83137256f, 0.9098039f, 0.8509804f, 0.9411765f, 0.827451f, 0.6509804f, 0.85882354f, 0.627451f, 0.3529412f, 0.68235296f, 0.38039216f, 0.105882354f, 0.47058824f, 0.21568628f,
+		0.4627451f, 0.16470589f, 0.5137255f, 0.6f, 0.4392157f, 0.67058825f, 0.7607843f, 0.64705884f, 0.8117647f, 0.90588236f, 0.83137256f, 0.9098039f, 0.96862745f, 0.96862745f, 0.96862745f, 0.8509804f, 0.9411765f, 0.827451f, 0.6509804f, 0.85882354f, 0.627451f, 0.3529412f, 0.68235296f, 0.38039216f, 0.105882354f, 0.47058824f, 0.21568628f,
+		0.2509804f, 0.0f, 0.29411766f, 0.4627451f, 0.16470589f, 0.5137255f, 0.6f, 0.4392157f, 0.67058825f, 0.7607843f, 0.64705884f, 0.8117647f, 0.90588236f, 0.83137256f, 0.9098039f, 0.8509804f, 0.9411765f, 0.827451f, 0.6509804f, 0.85882354f, 0.627451f, 0.3529412f, 0.68235296f, 0.38039216f, 0.105882354f, 0.47058824f, 0.21568628f, 0.0f, 0.26666668f, 0.105882354f,
+		0.2509804f, 0.0f, 0.29411766f, 0.4627451f, 0.16470589f, 0.5137255f, 0.6f, 0.4392157f, 0.67058825f, 0.7607843f, 0.64705884f, 0.8117647f, 0.90588236f, 0.83137256f, 0.9098039f, 0.96862745f, 0.96862745f, 0.96862745f, 0.8509804f, 0.9411765f, 0.827451f, 0.6509804f, 0.85882354f, 0.627451f, 0.3529412f, 0.68235296f, 0.38039216f, 0.105882354f, 0.47058824f, 0.21568628f, 0.0f, 0.26666668f, 0.105882354f,
+		// RdYlBu
+		0.9882353f, 0.5529412f, 0.34901962f, 1.0f, 1.0f, 0.7490196f, 0.5686275f, 0.7490196f, 0.85882354f,
+		0.84313726f, 0.09803922f, 0.10980392f, 0.99215686f, 0.68235296f, 0.38039216f, 0.67058825f, 0.8509804f, 0.9137255f, 0.17254902f, 0.48235294f, 0.7137255f,
+		0.84313726f, 0.09803922f, 0.10980392f, 0.99215686f, 0.68235296f, 0.38039216f, 1.0f, 1.0f, 0.7490196f, 0.67058825f, 0.8509804f, 0.9137255f, 0.17254902f, 0.48235294f, 0.7137255f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.9882353f, 0.5529412f, 0.34901962f, 0.99607843f, 0.8784314f, 0.5647059f, 0.8784314f, 0.9529412f, 0.972549f, 0.5686275f, 0.7490196f, 0.85882354f, 0.27058825f, 0.45882353f, 0.7058824f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.9882353f, 0.5529412f, 0.34901962f, 0.99607843f, 0.8784314f, 0.5647059f, 1.0f, 1.0f, 0.7490196f, 0.8784314f, 0.9529412f, 0.972549f, 0.5686275f, 0.7490196f, 0.85882354f, 0.27058825f, 0.45882353f, 0.7058824f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.5647059f, 0.8784314f, 0.9529412f, 0.972549f, 0.67058825f, 0.8509804f, 0.9137255f, 0.45490196f, 0.6784314f, 0.81960785f, 0.27058825f, 0.45882353f, 0.7058824f,
+		0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.5647059f, 1.0f, 1.0f, 0.7490196f, 0.8784314f, 0.9529412f, 0.972549f, 0.67058825f, 0.8509804f, 0.9137255f, 0.45490196f, 0.6784314f, 0.81960785f, 0.27058825f, 0.45882353f, 0.7058824f,
+		0.64705884f, 0.0f, 0.14901961f, 0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.5647059f, 0.8784314f, 0.9529412f, 0.972549f, 0.67058825f, 0.8509804f, 0.9137255f, 0.45490196f, 0.6784314f, 0.81960785f, 0.27058825f, 0.45882353f, 0.7058824f, 0.19215687f, 0.21176471f, 0.58431375f,
+		0.64705884f, 0.0f, 0.14901961f, 0.84313726f, 0.1882353f, 0.15294118f, 0.95686275f, 0.42745098f, 0.2627451f, 0.99215686f, 0.68235296f, 0.38039216f, 0.99607843f, 0.8784314f, 0.5647059f, 1.0f, 1.0f, 0.7490196f, 0.8784314f, 0.9529412f, 0.972549f, 0.67058825f, 0.8509804f, 0.9137255f, 0.45490196f, 0.6784314f, 0.81960785f, 0.27058825f, 0.45882353f, 0.7058824f, 0.19215687f, 0.21176471f, 0.58431375f,
+		// BrBG
+		0.84705883f, 0.7019608f, 0.39607844f, 0.9607843f, 0.9607843f, 0.9607843f, 0.3529412f, 0.7058824f, 0.6745098f,
+		0.6509804f, 0.38039216f, 0.101960786f, 0.8745098f, 0.7607843f, 0.49019608f, 0.5019608f, 0.8039216f, 0.75686276f, 0.003921569f, 0.52156866f, 0.44313726f,
+		0.6509804f, 0.38039216f, 0.101960786f, 0.8745098f, 0.7607843f, 0.49019608f, 0.9607843f, 0.9607843f, 0.9607843f, 0.5019608f, 0.8039216f, 0.75686276f, 0.003921569f, 0.52156866f, 0.44313726f,
+		0.54901963f, 0.31764707f, 0.039215688f, 0.84705883f, 0.7019608f, 0.39607844f, 0.9647059f, 0.9098039f, 0.7647059f, 0.78039217f, 0.91764706f, 0.8980392f, 0.3529412f, 0.7058824f, 0.6745098f, 0.003921569f, 0.4f, 0.36862746f,
+		0.54901963f, 0.31764707f, 0.039215688f, 0.84705883f, 0.7019608f, 0.39607844f, 0.9647059f, 0.9098039f, 0.7647059f, 0.9607843f, 0.9607843f, 0.9607843f, 0.78039217f, 0.91764706f, 0.8980392f, 0.3529412f, 0.7058824f, 0.6745098f, 0.003921569f, 0.4f, 0.36862746f,
+		0.54901963f, 0.31764707f, 0.039215688f, 0.7490196f, 0.5058824f, 0.1764706f, 0.8745098f, 0.7607843f, 0.49019608f, 0.9647059f, 0.9098039f, 0.7647059f, 0.78039217f, 0.91764706f, 0.8980392f, 0.5019608f, 0.8039216f, 0.75686276f, 0.20784314f, 0.5921569f, 0.56078434f, 0.003921569f, 0.4f, 0.36862746f,
+		0.54901963f, 0.31764707f, 0.039215688f, 0.7490196f, 0.5058824f, 0.1764706f, 0.8745098f, 0.7607843f, 0.49019608f, 0.9647059f, 0.9098039f, 0.7647059f, 0.9607843f, 0.9607843f, 0.9607843f, 0.78039217f, 0.91764706f, 0.8980392f, 0.5019608f, 0.8039216f, 0.75686276f, 0.20784314f, 0.5921569f, 0.56078434f, 0.003921569f, 0.4f, 0.36862746f,
+		0.32941177f, 0.1882353f, 0.019607844f, 0.54901963f, 0.31764707f, 0.039215688f, 0.7490196f, 0.5058824f, 0.1764706f, 0.8745098f, 0.7607843f, 0.49019608f, 0.9647059f, 0.9098039f, 0.7647059f, 0.78039217f, 0.91764706f, 0.8980392f, 0.5019608f, 0.8039216f, 0.75686276f, 0.20784314f, 0.5921569f, 0.56078434f, 0.003921569f, 0.4f, 0.36862746f, 0.0f, 0.23529412f, 0.1882353f,
+		0.32941177f, 0.1882353f, 0.019607844f, 0.54901963f, 0.31764707f, 0.039215688f, 0.7490196f, 0.5058824f, 0.1764706f, 0.8745098f, 0.7607843f, 0.49019608f, 0.9647059f, 0.9098039f, 0.7647059f, 0.9607843f, 0.9607843f, 0.9607843f, 0.78039217f, 0.91764706f, 0.8980392f, 0.5019608f, 0.8039216f, 0.75686276f, 0.20784314f, 0.5921569f, 0.56078434f, 0.003921569f, 0.4f, 0.36862746f, 0.0f, 0.23529412f, 0.1882353f,
+		// RdGy
+		0.9372549f, 0.5411765f, 0.38431373f, 1.0f, 1.0f, 1.0f, 0.6f, 0.6f, 0.6f,
+		0.7921569f, 0.0f, 0.1254902f, 0.95686275f, 0.64705884f, 0.50980395f, 0.7294118f, 0.7294118f, 0.7294118f, 0.2509804f, 0.2509804f, 0.2509804f,
+		0.7921569f, 0.0f, 0.1254902f, 0.95686275f, 0.64705884f, 0.50980395f, 1.0f, 1.0f, 1.0f, 0.7294118f, 0.7294118f, 0.7294118f, 0.2509804f, 0.2509804f, 0.2509804f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.9372549f, 0.5411765f, 0.38431373f, 0.99215686f, 0.85882354f, 0.78039217f, 0.8784314f, 0.8784314f, 0.8784314f, 0.6f, 0.6f, 0.6f, 0.3019608f, 0.3019608f, 0.3019608f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.9372549f, 0.5411765f, 0.38431373f, 0.99215686f, 0.85882354f, 0.78039217f, 1.0f, 1.0f, 1.0f, 0.8784314f, 0.8784314f, 0.8784314f, 0.6f, 0.6f, 0.6f, 0.3019608f, 0.3019608f, 0.3019608f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 0.8784314f, 0.8784314f, 0.8784314f, 0.7294118f, 0.7294118f, 0.7294118f, 0.5294118f, 0.5294118f, 0.5294118f, 0.3019608f, 0.3019608f, 0.3019608f,
+		0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 1.0f, 1.0f, 1.0f, 0.8784314f, 0.8784314f, 0.8784314f, 0.7294118f, 0.7294118f, 0.7294118f, 0.5294118f, 0.5294118f, 0.5294118f, 0.3019608f, 0.3019608f, 0.3019608f,
+		0.40392157f, 0.0f, 0.12156863f, 0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 0.8784314f, 0.8784314f, 0.8784314f, 0.7294118f, 0.7294118f, 0.7294118f, 0.5294118f, 0.5294118f, 0.5294118f, 0.3019608f, 0.3019608f, 0.3019608f, 0.101960786f, 0.101960786f, 0.101960786f,
+		0.40392157f, 0.0f, 0.12156863f, 0.69803923f, 0.09411765f, 0.16862746f, 0.8392157f, 0.3764706f, 0.3019608f, 0.95686275f, 0.64705884f, 0.50980395f, 0.99215686f, 0.85882354f, 0.78039217f, 1.0f, 1.0f, 1.0f, 0.8784314f, 0.8784314f, 0.8784314f, 0.7294118f, 0.7294118f, 0.7294118f, 0.5294118f, 0.5294118f, 0.5294118f, 0.3019608f, 0.3019608f, 0.3019608f, 0.101960786f, 0.101960786f, 0.101960786f,
+		// PuOr
+		0.94509804f, 0.6392157f, 0.2509804f, 0.96862745f, 0.96862745f, 0.96862745f, 0.6f, 0.5568628f, 0.7647059f,
+		0.9019608f, 0.38039216f, 0.003921569f, 0.99215686f, 0.72156864f, 0.3882353f, 0.69803923f, 0.67058825f, 0.8235294f, 0.36862746f, 0.23529412f, 0.6f,
+		0.9019608f, 0.38039216f, 0.003921569f, 0.99215686f, 0.72156864f, 0.3882353f, 0.96862745f, 0.96862745f, 0.96862745f, 0.69803923f, 0.67058825f, 0.8235294f, 0.36862746f, 0.23529412f, 0.6f,
+		0.7019608f, 0.34509805f, 0.023529412f, 0.94509804f, 0.6392157f, 0.2509804f, 0.99607843f, 0.8784314f, 0.7137255f, 0.84705883f, 0.85490197f, 0.92156863f, 0.6f, 0.5568628f, 0.7647059f, 0.32941177f, 0.15294118f, 0.53333336f,
+		0.7019608f, 0.34509805f, 0.023529412f, 0.94509804f, 0.6392157f, 0.2509804f, 0.99607843f, 0.8784314f, 0.7137255f, 0.96862745f, 0.96862745f, 0.96862745f, 0.84705883f, 0.85490197f, 0.92156863f, 0.6f, 0.5568628f, 0.7647059f, 0.32941177f, 0.15294118f, 0.53333336f,
+		0.7019608f, 0.34509805f, 0.023529412f, 0.8784314f, 0.50980395f, 0.078431375f, 0.99215686f, 0.72156864f, 0.3882353f, 0.99607843f, 0.8784314f, 0.7137255f, 0.84705883f, 0.85490197f, 0.92156863f, 0.69803923f, 0.67058825f, 0.8235294f, 0.5019608f, 0.4509804f, 0.6745098f, 0.32941177f, 0.15294118f, 0.53333336f,
+		0.7019608f, 0.34509805f, 0.023529412f, 0.8784314f, 0.50980395f, 0.078431375f, 0.99215686f, 0.72156864f, 0.3882353f, 0.99607843f, 0.8784314f, 0.7137255f, 0.96862745f, 0.96862745f, 0.96862745f, 0.84705883f, 0.85490197f, 0.92156863f, 0.69803923f, 0.67058825f, 0.8235294f, 0.5019608f, 0.4509804f, 0.6745098f, 0.32941177f, 0.15294118f, 0.53333336f,
+		0.49803922f, 0.23137255f, 0.03137255f, 0.7019608f, 0.34509805f, 0.023529412f, 0.8784314f, 0.50980395f, 0.078431375f, 0.99215686f, 0.72156864f, 0.3882353f, 0.99607843f, 0.8784314f, 0.7137255f, 0.84705883f, 0.85490197f, 0.92156863f, 0.69803923f, 0.67058825f, 0.8235294f, 0.5019608f, 0.4509804f, 0.6745098f, 0.32941177f, 0.15294118f, 0.53333336f, 0.1764706f, 0.0f, 0.29411766f,
+		0.49803922f, 0.23137255f, 0.03137255f, 0.7019608f, 0.34509805f, 0.023529412f, 0.8784314f, 0.50980395f, 0.078431375f, 0.99215686f, 0.72156864f, 0.3882353f, 0.99607843f, 0.8784314f, 0.7137255f, 0.96862745f, 0.96862745f, 0.96862745f, 0.84705883f, 0.85490197f, 0.92156863f, 0.69803923f, 0.67058825f, 0.8235294f, 0.5019608f, 0.4509804f, 0.6745098f, 0.32941177f, 0.15294118f, 0.53333336f, 0.1764706f, 0.0f, 0.29411766f,
+
+		// qualitative
+		// Set2
+		0.4f, 0.7607843f, 0.64705884f, 0.9882353f, 0.5529412f, 0.38431373f, 0.5529412f, 0.627451f, 0.79607844f,
+		0.4f, 0.7607843f, 0.64705884f, 0.9882353f, 0.5529412f, 0.38431373f, 0.5529412f, 0.627451f, 0.79607844f, 0.90588236f, 0.5411765f, 0.7647059f,
+		0.4f, 0.7607843f, 0.64705884f, 0.9882353f, 0.5529412f, 0.38431373f, 0.5529412f, 0.627451f, 0.79607844f, 0.90588236f, 0.5411765f, 0.7647059f, 0.6509804f, 0.84705883f, 0.32941177f,
+		0.4f, 0.7607843f, 0.64705884f, 0.9882353f, 0.5529412f, 0.38431373f, 0.5529412f, 0.627451f, 0.79607844f, 0.90588236f, 0.5411765f, 0.7647059f, 0.6509804f, 0.84705883f, 0.32941177f, 1.0f, 0.8509804f, 0.18431373f,
+		0.4f, 0.7607843f, 0.64705884f, 0.9882353f, 0.5529412f, 0.38431373f, 0.5529412f, 0.627451f, 0.79607844f, 0.90588236f, 0.5411765f, 0.7647059f, 0.6509804f, 0.84705883f, 0.32941177f, 1.0f, 0.8509804f, 0.18431373f, 0.8980392f, 0.76862746f, 0.5803922f,
+		0.4f, 0.7607843f, 0.64705884f, 0.9882353f, 0.5529412f, 0.38431373f, 0.5529412f, 0.627451f, 0.79607844f, 0.90588236f, 0.5411765f, 0.7647059f, 0.6509804f, 0.84705883f, 0.32941177f, 1.0f, 0.8509804f, 0.18431373f, 0.8980392f, 0.76862746f, 0.5803922f, 0.7019608f, 0.7019608f, 0.7019608f,
+		// Accent
+		0.49803922f, 0.7882353f, 0.49803922f, 0.74509805f, 0.68235296f, 0.83137256f, 0.99215686f, 0.7529412f, 0.5254902f,
+		0.49803922f, 0.7882353f, 0.49803922f, 0.74509805f, 0.68235296f, 0.83137256f, 0.99215686f, 0.7529412f, 0.5254902f, 1.0f, 1.0f, 0.6f,
+		0.49803922f, 0.7882353f, 0.49803922f, 0.74509805f, 0.68235296f, 0.83137256f, 0.99215686f, 0.7529412f, 0.5254902f, 1.0f, 1.0f, 0.6f, 0.21960784f, 0.42352942f, 0.6901961f,
+		0.49803922f, 0.7882353f, 0.49803922f, 0.74509805f, 0.68235296f, 0.83137256f, 0.99215686f, 0.7529412f, 0.5254902f, 1.0f, 1.0f, 0.6f, 0.21960784f, 0.42352942f, 0.6901961f, 0.9411765f, 0.007843138f, 0.49803922f,
+		0.49803922f, 0.7882353f, 0.49803922f, 0.74509805f, 0.68235296f, 0.83137256f, 0.99215686f, 0.7529412f, 0.5254902f, 1.0f, 1.0f, 0.6f, 0.21960784f, 0.42352942f, 0.6901961f, 0.9411765f, 0.007843138f, 0.49803922f, 0.7490196f, 0.35686275f, 0.09019608f,
+		0.49803922f, 0.7882353f, 0.49803922f, 0.74509805f, 0.68235296f, 0.83137256f, 0.99215686f, 0.7529412f, 0.5254902f, 1.0f, 1.0f, 0.6f, 0.21960784f, 0.42352942f, 0.6901961f, 0.9411765f, 0.007843138f, 0.49803922f, 0.7490196f, 0.35686275f, 0.09019608f, 0.4f, 0.4f, 0.4f,
+		// Set1
+		0.89411765f, 0.101960786f, 0.10980392f, 0.21568628f, 0.49411765f, 0.72156864f, 0.3019608f, 0.6862745f, 0.2901961f,
+		0.89411765f, 0.101960786f, 0.10980392f, 0.21568628f, 0.49411765f, 0.72156864f, 0.3019608f, 0.6862745f, 0.2901961f, 0.59607846f, 0.30588236f, 0.6392157f,
+		0.89411765f, 0.101960786f, 0.10980392f, 0.21568628f, 0.49411765f, 0.72156864f, 0.3019608f, 0.6862745f, 0.2901961f, 0.59607846f, 0.30588236f, 0.6392157f, 1.0f, 0.49803922f, 0.0f,
+		0.89411765f, 0.101960786f, 0.10980392f, 0.21568628f, 0.49411765f, 0.72156864f, 0.3019608f, 0.6862745f, 0.2901961f, 0.59607846f, 0.30588236f, 0.6392157f, 1.0f, 0.49803922f, 0.0f, 1.0f, 1.0f, 0.2f,
+		0.89411765f, 0.101960786f, 0.10980392f, 0.21568628f, 0.49411765f, 0.72156864f, 0.3019608f, 0.6862745f, 0.2901961f, 0.59607846f, 0.30588236f, 0.6392157f, 1.0f, 0.49803922f, 0.0f, 1.0f, 1.0f, 0.2f, 0.6509804f, 0.3372549f, 0.15686275f,
+		0.89411765f, 0.101960786f, 0.10980392f, 0.21568628f, 0.49411765f, 0.72156864f, 0.3019608f, 0.6862745f, 0.2901961f, 0.59607846f, 0.30588236f, 0.6392157f, 1.0f, 0.49803922f, 0.0f, 1.0f, 1.0f, 0.2f, 0.6509804f, 0.3372549f, 0.15686275f, 0.96862745f, 0.5058824f, 0.7490196f,
+		0.89411765f, 0.101960786f, 0.10980392f, 0.21568628f, 0.49411765f, 0.72156864f, 0.3019608f, 0.6862745f, 0.2901961f, 0.59607846f, 0.30588236f, 0.6392157f, 1.0f, 0.49803922f, 0.0f, 1.0f, 1.0f, 0.2f, 0.6509804f, 0.3372549f, 0.15686275f, 0.96862745f, 0.5058824f, 0.7490196f, 0.6f, 0.6f, 0.6f,
+		// Set3
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f, 0.99215686f, 0.7058824f, 0.38431373f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f, 0.99215686f, 0.7058824f, 0.38431373f, 0.7019608f, 0.87058824f, 0.4117647f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f, 0.99215686f, 0.7058824f, 0.38431373f, 0.7019608f, 0.87058824f, 0.4117647f, 0.9882353f, 0.8039216f, 0.8980392f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f, 0.99215686f, 0.7058824f, 0.38431373f, 0.7019608f, 0.87058824f, 0.4117647f, 0.9882353f, 0.8039216f, 0.8980392f, 0.8509804f, 0.8509804f, 0.8509804f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f, 0.99215686f, 0.7058824f, 0.38431373f, 0.7019608f, 0.87058824f, 0.4117647f, 0.9882353f, 0.8039216f, 0.8980392f, 0.8509804f, 0.8509804f, 0.8509804f, 0.7372549f, 0.5019608f, 0.7411765f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f, 0.99215686f, 0.7058824f, 0.38431373f, 0.7019608f, 0.87058824f, 0.4117647f, 0.9882353f, 0.8039216f, 0.8980392f, 0.8509804f, 0.8509804f, 0.8509804f, 0.7372549f, 0.5019608f, 0.7411765f, 0.8f, 0.92156863f, 0.77254903f,
+		0.5529412f, 0.827451f, 0.78039217f, 1.0f, 1.0f, 0.7019608f, 0.74509805f, 0.7294118f, 0.85490197f, 0.9843137f, 0.5019608f, 0.44705883f, 0.5019608f, 0.69411767f, 0.827451f, 0.99215686f, 0.7058824f, 0.38431373f, 0.7019608f, 0.87058824f, 0.4117647f, 0.9882353f, 0.8039216f, 0.8980392f, 0.8509804f, 0.8509804f, 0.8509804f, 0.7372549f, 0.5019608f, 0.7411765f, 0.8f, 0.92156863f, 0.77254903f, 1.0f, 0.92941177f, 0.43529412f,
+		// Dark2
+		0.105882354f, 0.61960787f, 0.46666667f, 0.8509804f, 0.37254903f, 0.007843138f, 0.45882353f, 0.4392157f, 0.7019608f,
+		0.105882354f, 0.61960787f, 0.46666667f, 0.8509804f, 0.37254903f, 0.007843138f, 0.45882353f, 0.4392157f, 0.7019608f, 0.90588236f, 0.16078432f, 0.5411765f,
+		0.105882354f, 0.61960787f, 0.46666667f, 0.8509804f, 0.37254903f, 0.007843138f, 0.45882353f, 0.4392157f, 0.7019608f, 0.90588236f, 0.16078432f, 0.5411765f, 0.4f, 0.6509804f, 0.11764706f,
+		0.105882354f, 0.61960787f, 0.46666667f, 0.8509804f, 0.37254903f, 0.007843138f, 0.45882353f, 0.4392157f, 0.7019608f, 0.90588236f, 0.16078432f, 0.5411765f, 0.4f, 0.6509804f, 0.11764706f, 0.9019608f, 0.67058825f, 0.007843138f,
+		0.105882354f, 0.61960787f, 0.46666667f, 0.8509804f, 0.37254903f, 0.007843138f, 0.45882353f, 0.4392157f, 0.7019608f, 0.90588236f, 0.16078432f, 0.5411765f, 0.4f, 0.6509804f, 0.11764706f, 0.9019608f, 0.67058825f, 0.007843138f, 0.6509804f, 0.4627451f, 0.11372549f,
+		0.105882354f, 0.61960787f, 0.46666667f, 0.8509804f, 0.37254903f, 0.007843138f, 0.45882353f, 0.4392157f, 0.7019608f, 0.90588236f, 0.16078432f, 0.5411765f, 0.4f, 0.6509804f, 0.11764706f, 0.9019608f, 0.67058825f, 0.007843138f, 0.6509804f, 0.4627451f, 0.11372549f, 0.4f, 0.4f, 0.4f,
+		// Paired
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f, 0.8901961f, 0.101960786f, 0.10980392f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f, 0.8901961f, 0.101960786f, 0.10980392f, 0.99215686f, 0.7490196f, 0.43529412f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f, 0.8901961f, 0.101960786f, 0.10980392f, 0.99215686f, 0.7490196f, 0.43529412f, 1.0f, 0.49803922f, 0.0f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f, 0.8901961f, 0.101960786f, 0.10980392f, 0.99215686f, 0.7490196f, 0.43529412f, 1.0f, 0.49803922f, 0.0f, 0.7921569f, 0.69803923f, 0.8392157f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f, 0.8901961f, 0.101960786f, 0.10980392f, 0.99215686f, 0.7490196f, 0.43529412f, 1.0f, 0.49803922f, 0.0f, 0.7921569f, 0.69803923f, 0.8392157f, 0.41568628f, 0.23921569f, 0.6039216f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f, 0.8901961f, 0.101960786f, 0.10980392f, 0.99215686f, 0.7490196f, 0.43529412f, 1.0f, 0.49803922f, 0.0f, 0.7921569f, 0.69803923f, 0.8392157f, 0.41568628f, 0.23921569f, 0.6039216f, 1.0f, 1.0f, 0.6f,
+		0.6509804f, 0.80784315f, 0.8901961f, 0.12156863f, 0.47058824f, 0.7058824f, 0.69803923f, 0.8745098f, 0.5411765f, 0.2f, 0.627451f, 0.17254902f, 0.9843137f, 0.6039216f, 0.6f, 0.8901961f, 0.101960786f, 0.10980392f, 0.99215686f, 0.7490196f, 0.43529412f, 1.0f, 0.49803922f, 0.0f, 0.7921569f, 0.69803923f, 0.8392157f, 0.41568628f, 0.23921569f, 0.6039216f, 1.0f, 1.0f, 0.6f, 0.69411767f, 0.34901962f, 0.15686275f,
+		// Pastel2
+		0.7019608f, 0.8862745f, 0.8039216f, 0.99215686f, 0.8039216f, 0.6745098f, 0.79607844f, 0.8352941f, 0.9098039f,
+		0.7019608f, 0.8862745f, 0.8039216f, 0.99215686f, 0.8039216f, 0.6745098f, 0.79607844f, 0.8352941f, 0.9098039f, 0.95686275f, 0.7921569f, 0.89411765f,
+		0.7019608f, 0.8862745f, 0.8039216f, 0.99215686f, 0.8039216f, 0.6745098f, 0.79607844f, 0.8352941f, 0.9098039f, 0.95686275f, 0.7921569f, 0.89411765f, 0.9019608f, 0.9607843f, 0.7882353f,
+		0.7019608f, 0.8862745f, 0.8039216f, 0.99215686f, 0.8039216f, 0.6745098f, 0.79607844f, 0.8352941f, 0.9098039f, 0.95686275f, 0.7921569f, 0.89411765f, 0.9019608f, 0.9607843f, 0.7882353f, 1.0f, 0.9490196f, 0.68235296f,
+		0.7019608f, 0.8862745f, 0.8039216f, 0.99215686f, 0.8039216f, 0.6745098f, 0.79607844f, 0.8352941f, 0.9098039f, 0.95686275f, 0.7921569f, 0.89411765f, 0.9019608f, 0.9607843f, 0.7882353f, 1.0f, 0.9490196f, 0.68235296f, 0.94509804f, 0.8862745f, 0.8f,
+		0.7019608f, 0.8862745f, 0.8039216f, 0.99215686f, 0.8039216f, 0.6745098f, 0.79607844f, 0.8352941f, 0.9098039f, 0.95686275f, 0.7921569f, 0.89411765f, 0.9019608f, 0.9607843f, 0.7882353f, 1.0f, 0.9490196f, 0.68235296f, 0.94509804f, 0.8862745f, 0.8f, 0.8f, 0.8f, 0.8f,
+		// Pastel1
+		0.9843137f, 0.7058824f, 0.68235296f, 0.7019608f, 0.8039216f, 0.8901961f, 0.8f, 0.92156863f, 0.77254903f,
+		0.9843137f, 0.7058824f, 0.68235296f, 0.7019608f, 0.8039216f, 0.8901961f, 0.8f, 0.92156863f, 0.77254903f, 0.87058824f, 0.79607844f, 0.89411765f,
+		0.9843137f, 0.7058824f, 0.68235296f, 0.7019608f, 0.8039216f, 0.8901961f, 0.8f, 0.92156863f, 0.77254903f, 0.87058824f, 0.79607844f, 0.89411765f, 0.99607843f, 0.8509804f, 0.6509804f,
+		0.9843137f, 0.7058824f, 0.68235296f, 0.7019608f, 0.8039216f, 0.8901961f, 0.8f, 0.92156863f, 0.77254903f, 0.87058824f, 0.79607844f, 0.89411765f, 0.99607843f, 0.8509804f, 0.6509804f, 1.0f, 1.0f, 0.8f,
+		0.9843137f, 0.7058824f, 0.68235296f, 0.7019608f, 0.8039216f, 0.8901961f, 0.8f, 0.92156863f, 0.77254903f, 0.87058824f, 0.79607844f, 0.89411765f, 0.99607843f, 0.8509804f, 0.6509804f, 1.0f, 1.0f, 0.8f, 0.8980392f, 0.84705883f, 0.7411765f,
+		0.9843137f, 0.7058824f, 0.68235296f, 0.7019608f, 0.8039216f, 0.8901961f, 0.8f, 0.92156863f, 0.77254903f, 0.87058824f, 0.79607844f, 0.89411765f, 0.99607843f, 0.8509804f, 0.6509804f, 1.0f, 1.0f, 0.8f, 0.8980392f, 0.84705883f, 0.7411765f, 0.99215686f, 0.85490197f, 0.9254902f,
+		0.9843137f, 0.7058824f, 0.68235296f, 0.7019608f, 0.8039216f, 0.8901961f, 0.8f, 0.92156863f, 0.77254903f, 0.87058824f, 0.79607844f, 0.89411765f, 0.99607843f, 0.8509804f, 0.6509804f, 1.0f, 1.0f, 0.8f, 0.8980392f, 0.84705883f, 0.7411765f, 0.99215686f, 0.85490197f, 0.9254902f, 0.9490196f, 0.9490196f, 0.9490196f,
+
+		// sequential
+		// OrRd
+		0.99607843f, 0.9098039f, 0.78431374f, 0.99215686f, 0.73333335f, 0.5176471f, 0.8901961f, 0.2901961f, 0.2f,
+		0.99607843f, 0.9411765f, 0.8509804f, 0.99215686f, 0.8f, 0.5411765f, 0.9882353f, 0.5529412f, 0.34901962f, 0.84313726f, 0.1882353f, 0.12156863f,
+		0.99607843f, 0.9411765f, 0.8509804f, 0.99215686f, 0.8f, 0.5411765f, 0.9882353f, 0.5529412f, 0.34901962f, 0.8901961f, 0.2901961f, 0.2f, 0.7019608f, 0.0f, 0.0f,
+		0.99607843f, 0.9411765f, 0.8509804f, 0.99215686f, 0.83137256f, 0.61960787f, 0.99215686f, 0.73333335f, 0.5176471f, 0.9882353f, 0.5529412f, 0.34901962f, 0.8901961f, 0.2901961f, 0.2f, 0.7019608f, 0.0f, 0.0f,
+		0.99607843f, 0.9411765f, 0.8509804f, 0.99215686f, 0.83137256f, 0.61960787f, 0.99215686f, 0.73333335f, 0.5176471f, 0.9882353f, 0.5529412f, 0.34901962f, 0.9372549f, 0.39607844f, 0.28235295f, 0.84313726f, 0.1882353f, 0.12156863f, 0.6f, 0.0f, 0.0f,
+		1.0f, 0.96862745f, 0.9254902f, 0.99607843f, 0.9098039f, 0.78431374f, 0.99215686f, 0.83137256f, 0.61960787f, 0.99215686f, 0.73333335f, 0.5176471f, 0.9882353f, 0.5529412f, 0.34901962f, 0.9372549f, 0.39607844f, 0.28235295f, 0.84313726f, 0.1882353f, 0.12156863f, 0.6f, 0.0f, 0.0f,
+		1.0f, 0.96862745f, 0.9254902f, 0.99607843f, 0.9098039f, 0.78431374f, 0.99215686f, 0.83137256f, 0.61960787f, 0.99215686f, 0.73333335f, 0.5176471f, 0.9882353f, 0.5529412f, 0.34901962f, 0.9372549f, 0.39607844f, 0.28235295f, 0.84313726f, 0.1882353f, 0.12156863f, 0.7019608f, 0.0f, 0.0f, 0.49803922f, 0.0f, 0.0f,
+		// PuBu
+		0.9254902f, 0.90588236f, 0.9490196f, 0.6509804f, 0.7411765f, 0.85882354f, 0.16862746f, 0.54901963f, 0.74509805f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.7411765f, 0.7882353f, 0.88235295f, 0.45490196f, 0.6627451f, 0.8117647f, 0.019607844f, 0.4392157f, 0.6901961f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.7411765f, 0.7882353f, 0.88235295f, 0.45490196f, 0.6627451f, 0.8117647f, 0.16862746f, 0.54901963f, 0.74509805f, 0.015686275f, 0.3529412f, 0.5529412f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.45490196f, 0.6627451f, 0.8117647f, 0.16862746f, 0.54901963f, 0.74509805f, 0.015686275f, 0.3529412f, 0.5529412f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.45490196f, 0.6627451f, 0.8117647f, 0.21176471f, 0.5647059f, 0.7529412f, 0.019607844f, 0.4392157f, 0.6901961f, 0.011764706f, 0.30588236f, 0.48235294f,
+		1.0f, 0.96862745f, 0.9843137f, 0.9254902f, 0.90588236f, 0.9490196f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.45490196f, 0.6627451f, 0.8117647f, 0.21176471f, 0.5647059f, 0.7529412f, 0.019607844f, 0.4392157f, 0.6901961f, 0.011764706f, 0.30588236f, 0.48235294f,
+		1.0f, 0.96862745f, 0.9843137f, 0.9254902f, 0.90588236f, 0.9490196f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.45490196f, 0.6627451f, 0.8117647f, 0.21176471f, 0.5647059f, 0.7529412f, 0.019607844f, 0.4392157f, 0.6901961f, 0.015686275f, 0.3529412f, 0.5529412f, 0.007843138f, 0.21960784f, 0.34509805f,
+		// BuPu
+		0.8784314f, 0.9254902f, 0.95686275f, 0.61960787f, 0.7372549f, 0.85490197f, 0.53333336f, 0.3372549f, 0.654902f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.7019608f, 0.8039216f, 0.8901961f, 0.54901963f, 0.5882353f, 0.7764706f, 0.53333336f, 0.25490198f, 0.6156863f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.7019608f, 0.8039216f, 0.8901961f, 0.54901963f, 0.5882353f, 0.7764706f, 0.53333336f, 0.3372549f, 0.654902f, 0.5058824f, 0.05882353f, 0.4862745f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.7490196f, 0.827451f, 0.9019608f, 0.61960787f, 0.7372549f, 0.85490197f, 0.54901963f, 0.5882353f, 0.7764706f, 0.53333336f, 0.3372549f, 0.654902f, 0.5058824f, 0.05882353f, 0.4862745f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.7490196f, 0.827451f, 0.9019608f, 0.61960787f, 0.7372549f, 0.85490197f, 0.54901963f, 0.5882353f, 0.7764706f, 0.54901963f, 0.41960785f, 0.69411767f, 0.53333336f, 0.25490198f, 0.6156863f, 0.43137255f, 0.003921569f, 0.41960785f,
+		0.96862745f, 0.9882353f, 0.99215686f, 0.8784314f, 0.9254902f, 0.95686275f, 0.7490196f, 0.827451f, 0.9019608f, 0.61960787f, 0.7372549f, 0.85490197f, 0.54901963f, 0.5882353f, 0.7764706f, 0.54901963f, 0.41960785f, 0.69411767f, 0.53333336f, 0.25490198f, 0.6156863f, 0.43137255f, 0.003921569f, 0.41960785f,
+		0.96862745f, 0.9882353f, 0.99215686f, 0.8784314f, 0.9254902f, 0.95686275f, 0.7490196f, 0.827451f, 0.9019608f, 0.61960787f, 0.7372549f, 0.85490197f, 0.54901963f, 0.5882353f, 0.7764706f, 0.54901963f, 0.41960785f, 0.69411767f, 0.53333336f, 0.25490198f, 0.6156863f, 0.5058824f, 0.05882353f, 0.4862745f, 0.3019608f, 0.0f, 0.29411766f,
+		// Oranges
+		0.99607843f, 0.9019608f, 0.80784315f, 0.99215686f, 0.68235296f, 0.41960785f, 0.9019608f, 0.33333334f, 0.050980393f,
+		0.99607843f, 0.92941177f, 0.87058824f, 0.99215686f, 0.74509805f, 0.52156866f, 0.99215686f, 0.5529412f, 0.23529412f, 0.8509804f, 0.2784314f, 0.003921569f,
+		0.99607843f, 0.92941177f, 0.87058824f, 0.99215686f, 0.74509805f, 0.52156866f, 0.99215686f, 0.5529412f, 0.23529412f, 0.9019608f, 0.33333334f, 0.050980393f, 0.6509804f, 0.21176471f, 0.011764706f,
+		0.99607843f, 0.92941177f, 0.87058824f, 0.99215686f, 0.8156863f, 0.63529414f, 0.99215686f, 0.68235296f, 0.41960785f, 0.99215686f, 0.5529412f, 0.23529412f, 0.9019608f, 0.33333334f, 0.050980393f, 0.6509804f, 0.21176471f, 0.011764706f,
+		0.99607843f, 0.92941177f, 0.87058824f, 0.99215686f, 0.8156863f, 0.63529414f, 0.99215686f, 0.68235296f, 0.41960785f, 0.99215686f, 0.5529412f, 0.23529412f, 0.94509804f, 0.4117647f, 0.07450981f, 0.8509804f, 0.28235295f, 0.003921569f, 0.54901963f, 0.1764706f, 0.015686275f,
+		1.0f, 0.9607843f, 0.92156863f, 0.99607843f, 0.9019608f, 0.80784315f, 0.99215686f, 0.8156863f, 0.63529414f, 0.99215686f, 0.68235296f, 0.41960785f, 0.99215686f, 0.5529412f, 0.23529412f, 0.94509804f, 0.4117647f, 0.07450981f, 0.8509804f, 0.28235295f, 0.003921569f, 0.54901963f, 0.1764706f, 0.015686275f,
+		1.0f, 0.9607843f, 0.92156863f, 0.99607843f, 0.9019608f, 0.80784315f, 0.99215686f, 0.8156863f, 0.63529414f, 0.99215686f, 0.68235296f, 0.41960785f, 0.99215686f, 0.5529412f, 0.23529412f, 0.94509804f, 0.4117647f, 0.07450981f, 0.8509804f, 0.28235295f, 0.003921569f, 0.6509804f, 0.21176471f, 0.011764706f, 0.49803922f, 0.15294118f, 0.015686275f,
+		// BuGn
+		0.8980392f, 0.9607843f, 0.9764706f, 0.6f, 0.84705883f, 0.7882353f, 0.17254902f, 0.63529414f, 0.37254903f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.69803923f, 0.8862745f, 0.8862745f, 0.4f, 0.7607843f, 0.6431373f, 0.13725491f, 0.54509807f, 0.27058825f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.69803923f, 0.8862745f, 0.8862745f, 0.4f, 0.7607843f, 0.6431373f, 0.17254902f, 0.63529414f, 0.37254903f, 0.0f, 0.42745098f, 0.17254902f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.8f, 0.9254902f, 0.9019608f, 0.6f, 0.84705883f, 0.7882353f, 0.4f, 0.7607843f, 0.6431373f, 0.17254902f, 0.63529414f, 0.37254903f, 0.0f, 0.42745098f, 0.17254902f,
+		0.92941177f, 0.972549f, 0.9843137f, 0.8f, 0.9254902f, 0.9019608f, 0.6f, 0.84705883f, 0.7882353f, 0.4f, 0.7607843f, 0.6431373f, 0.25490198f, 0.68235296f, 0.4627451f, 0.13725491f, 0.54509807f, 0.27058825f, 0.0f, 0.34509805f, 0.14117648f,
+		0.96862745f, 0.9882353f, 0.99215686f, 0.8980392f, 0.9607843f, 0.9764706f, 0.8f, 0.9254902f, 0.9019608f, 0.6f, 0.84705883f, 0.7882353f, 0.4f, 0.7607843f, 0.6431373f, 0.25490198f, 0.68235296f, 0.4627451f, 0.13725491f, 0.54509807f, 0.27058825f, 0.0f, 0.34509805f, 0.14117648f,
+		0.96862745f, 0.9882353f, 0.99215686f, 0.8980392f, 0.9607843f, 0.9764706f, 0.8f, 0.9254902f, 0.9019608f, 0.6f, 0.84705883f, 0.7882353f, 0.4f, 0.7607843f, 0.6431373f, 0.25490198f, 0.68235296f, 0.4627451f, 0.13725491f, 0.54509807f, 0.27058825f, 0.0f, 0.42745098f, 0.17254902f, 0.0f, 0.26666668f, 0.105882354f,
+		// YlOrBr
+		1.0f, 0.96862745f, 0.7372549f, 0.99607843f, 0.76862746f, 0.30980393f, 0.8509804f, 0.37254903f, 0.05490196f,
+		1.0f, 1.0f, 0.83137256f, 0.99607843f, 0.8509804f, 0.5568628f, 0.99607843f, 0.6f, 0.16078432f, 0.8f, 0.29803923f, 0.007843138f,
+		1.0f, 1.0f, 0.83137256f, 0.99607843f, 0.8509804f, 0.5568628f, 0.99607843f, 0.6f, 0.16078432f, 0.8509804f, 0.37254903f, 0.05490196f, 0.6f, 0.20392157f, 0.015686275f,
+		1.0f, 1.0f, 0.83137256f, 0.99607843f, 0.8901961f, 0.5686275f, 0.99607843f, 0.76862746f, 0.30980393f, 0.99607843f, 0.6f, 0.16078432f, 0.8509804f, 0.37254903f, 0.05490196f, 0.6f, 0.20392157f, 0.015686275f,
+		1.0f, 1.0f, 0.83137256f, 0.99607843f, 0.8901961f, 0.5686275f, 0.99607843f, 0.76862746f, 0.30980393f, 0.99607843f, 0.6f, 0.16078432f, 0.9254902f, 0.4392157f, 0.078431375f, 0.8f, 0.29803923f, 0.007843138f, 0.54901963f, 0.1764706f, 0.015686275f,
+		1.0f, 1.0f, 0.8980392f, 1.0f, 0.96862745f, 0.7372549f, 0.99607843f, 0.8901961f, 0.5686275f, 0.99607843f, 0.76862746f, 0.30980393f, 0.99607843f, 0.6f, 0.16078432f, 0.9254902f, 0.4392157f, 0.078431375f, 0.8f, 0.29803923f, 0.007843138f, 0.54901963f, 0.1764706f, 0.015686275f,
+		1.0f, 1.0f, 0.8980392f, 1.0f, 0.96862745f, 0.7372549f, 0.99607843f, 0.8901961f, 0.5686275f, 0.99607843f, 0.76862746f, 0.30980393f, 0.99607843f, 0.6f, 0.16078432f, 0.9254902f, 0.4392157f, 0.078431375f, 0.8f, 0.29803923f, 0.007843138f, 0.6f, 0.20392157f, 0.015686275f, 0.4f, 0.14509805f, 0.023529412f,
+		// YlGn
+		0.96862745f, 0.9882353f, 0.7254902f, 0.6784314f, 0.8666667f, 0.5568628f, 0.19215687f, 0.6392157f, 0.32941177f,
+		1.0f, 1.0f, 0.8f, 0.7607843f, 0.9019608f, 0.6f, 0.47058824f, 0.7764706f, 0.4745098f, 0.13725491f, 0.5176471f, 0.2627451f,
+		1.0f, 1.0f, 0.8f, 0.7607843f, 0.9019608f, 0.6f, 0.47058824f, 0.7764706f, 0.4745098f, 0.19215687f, 0.6392157f, 0.32941177f, 0.0f, 0.40784314f, 0.21568628f,
+		1.0f, 1.0f, 0.8f, 0.8509804f, 0.9411765f, 0.6392157f, 0.6784314f, 0.8666667f, 0.5568628f, 0.47058824f, 0.7764706f, 0.4745098f, 0.19215687f, 0.6392157f, 0.32941177f, 0.0f, 0.40784314f, 0.21568628f,
+		1.0f, 1.0f, 0.8f, 0.8509804f, 0.9411765f, 0.6392157f, 0.6784314f, 0.8666667f, 0.5568628f, 0.47058824f, 0.7764706f, 0.4745098f, 0.25490198f, 0.67058825f, 0.3647059f, 0.13725491f, 0.5176471f, 0.2627451f, 0.0f, 0.3529412f, 0.19607843f,
+		1.0f, 1.0f, 0.8980392f, 0.96862745f, 0.9882353f, 0.7254902f, 0.8509804f, 0.9411765f, 0.6392157f, 0.6784314f, 0.8666667f, 0.5568628f, 0.47058824f, 0.7764706f, 0.4745098f, 0.25490198f, 0.67058825f, 0.3647059f, 0.13725491f, 0.5176471f, 0.2627451f, 0.0f, 0.3529412f, 0.19607843f,
+		1.0f, 1.0f, 0.8980392f, 0.96862745f, 0.9882353f, 0.7254902f, 0.8509804f, 0.9411765f, 0.6392157f, 0.6784314f, 0.8666667f, 0.5568628f, 0.47058824f, 0.7764706f, 0.4745098f, 0.25490198f, 0.67058825f, 0.3647059f, 0.13725491f, 0.5176471f, 0.2627451f, 0.0f, 0.40784314f, 0.21568628f, 0.0f, 0.27058825f, 0.16078432f,
+		// Reds
+		0.99607843f, 0.8784314f, 0.8235294f, 0.9882353f, 0.57254905f, 0.44705883f, 0.87058824f, 0.1764706f, 0.14901961f,
+		0.99607843f, 0.8980392f, 0.8509804f, 0.9882353f, 0.68235296f, 0.5686275f, 0.9843137f, 0.41568628f, 0.2901961f, 0.79607844f, 0.09411765f, 0.11372549f,
+		0.99607843f, 0.8980392f, 0.8509804f, 0.9882353f, 0.68235296f, 0.5686275f, 0.9843137f, 0.41568628f, 0.2901961f, 0.87058824f, 0.1764706f, 0.14901961f, 0.64705884f, 0.05882353f, 0.08235294f,
+		0.99607843f, 0.8980392f, 0.8509804f, 0.9882353f, 0.73333335f, 0.6313726f, 0.9882353f, 0.57254905f, 0.44705883f, 0.9843137f, 0.41568628f, 0.2901961f, 0.87058824f, 0.1764706f, 0.14901961f, 0.64705884f, 0.05882353f, 0.08235294f,
+		0.99607843f, 0.8980392f, 0.8509804f, 0.9882353f, 0.73333335f, 0.6313726f, 0.9882353f, 0.57254905f, 0.44705883f, 0.9843137f, 0.41568628f, 0.2901961f, 0.9372549f, 0.23137255f, 0.17254902f, 0.79607844f, 0.09411765f, 0.11372549f, 0.6f, 0.0f, 0.050980393f,
+		1.0f, 0.9607843f, 0.9411765f, 0.99607843f, 0.8784314f, 0.8235294f, 0.9882353f, 0.73333335f, 0.6313726f, 0.9882353f, 0.57254905f, 0.44705883f, 0.9843137f, 0.41568628f, 0.2901961f, 0.9372549f, 0.23137255f, 0.17254902f, 0.79607844f, 0.09411765f, 0.11372549f, 0.6f, 0.0f, 0.050980393f,
+		1.0f, 0.9607843f, 0.9411765f, 0.99607843f, 0.8784314f, 0.8235294f, 0.9882353f, 0.73333335f, 0.6313726f, 0.9882353f, 0.57254905f, 0.44705883f, 0.9843137f, 0.41568628f, 0.2901961f, 0.9372549f, 0.23137255f, 0.17254902f, 0.79607844f, 0.09411765f, 0.11372549f, 0.64705884f, 0.05882353f, 0.08235294f, 0.40392157f, 0.0f, 0.050980393f,
+		// RdPu
+		0.99215686f, 0.8784314f, 0.8666667f, 0.98039216f, 0.62352943f, 0.70980394f, 0.77254903f, 0.105882354f, 0.5411765f,
+		0.99607843f, 0.92156863f, 0.8862745f, 0.9843137f, 0.7058824f, 0.7254902f, 0.96862745f, 0.40784314f, 0.6313726f, 0.68235296f, 0.003921569f, 0.49411765f,
+		0.99607843f, 0.92156863f, 0.8862745f, 0.9843137f, 0.7058824f, 0.7254902f, 0.96862745f, 0.40784314f, 0.6313726f, 0.77254903f, 0.105882354f, 0.5411765f, 0.47843137f, 0.003921569f, 0.46666667f,
+		0.99607843f, 0.92156863f, 0.8862745f, 0.9882353f, 0.77254903f, 0.7529412f, 0.98039216f, 0.62352943f, 0.70980394f, 0.96862745f, 0.40784314f, 0.6313726f, 0.77254903f, 0.105882354f, 0.5411765f, 0.47843137f, 0.003921569f, 0.46666667f,
+		0.99607843f, 0.92156863f, 0.8862745f, 0.9882353f, 0.77254903f, 0.7529412f, 0.98039216f, 0.62352943f, 0.70980394f, 0.96862745f, 0.40784314f, 0.6313726f, 0.8666667f, 0.20392157f, 0.5921569f, 0.68235296f, 0.003921569f, 0.49411765f, 0.47843137f, 0.003921569f, 0.46666667f,
+		1.0f, 0.96862745f, 0.9529412f, 0.99215686f, 0.8784314f, 0.8666667f, 0.9882353f, 0.77254903f, 0.7529412f, 0.98039216f, 0.62352943f, 0.70980394f, 0.96862745f, 0.40784314f, 0.6313726f, 0.8666667f, 0.20392157f, 0.5921569f, 0.68235296f, 0.003921569f, 0.49411765f, 0.47843137f, 0.003921569f, 0.46666667f,
+		1.0f, 0.96862745f, 0.9529412f, 0.99215686f, 0.8784314f, 0.8666667f, 0.9882353f, 0.77254903f, 0.7529412f, 0.98039216f, 0.62352943f, 0.70980394f, 0.96862745f, 0.40784314f, 0.6313726f, 0.8666667f, 0.20392157f, 0.5921569f, 0.68235296f, 0.003921569f, 0.49411765f, 0.47843137f, 0.003921569f, 0.46666667f, 0.28627452f, 0.0f, 0.41568628f,
+		// Greens
+		0.8980392f, 0.9607843f, 0.8784314f, 0.6313726f, 0.8509804f, 0.60784316f, 0.19215687f, 0.6392157f, 0.32941177f,
+		0.92941177f, 0.972549f, 0.9137255f, 0.7294118f, 0.89411765f, 0.7019608f, 0.45490196f, 0.76862746f, 0.4627451f, 0.13725491f, 0.54509807f, 0.27058825f,
+		0.92941177f, 0.972549f, 0.9137255f, 0.7294118f, 0.89411765f, 0.7019608f, 0.45490196f, 0.76862746f, 0.4627451f, 0.19215687f, 0.6392157f, 0.32941177f, 0.0f, 0.42745098f, 0.17254902f,
+		0.92941177f, 0.972549f, 0.9137255f, 0.78039217f, 0.9137255f, 0.7529412f, 0.6313726f, 0.8509804f, 0.60784316f, 0.45490196f, 0.76862746f, 0.4627451f, 0.19215687f, 0.6392157f, 0.32941177f, 0.0f, 0.42745098f, 0.17254902f,
+		0.92941177f, 0.972549f, 0.9137255f, 0.78039217f, 0.9137255f, 0.7529412f, 0.6313726f, 0.8509804f, 0.60784316f, 0.45490196f, 0.76862746f, 0.4627451f, 0.25490198f, 0.67058825f, 0.3647059f, 0.13725491f, 0.54509807f, 0.27058825f, 0.0f, 0.3529412f, 0.19607843f,
+		0.96862745f, 0.9882353f, 0.9607843f, 0.8980392f, 0.9607843f, 0.8784314f, 0.78039217f, 0.9137255f, 0.7529412f, 0.6313726f, 0.8509804f, 0.60784316f, 0.45490196f, 0.76862746f, 0.4627451f, 0.25490198f, 0.67058825f, 0.3647059f, 0.13725491f, 0.54509807f, 0.27058825f, 0.0f, 0.3529412f, 0.19607843f,
+		0.96862745f, 0.9882353f, 0.9607843f, 0.8980392f, 0.9607843f, 0.8784314f, 0.78039217f, 0.9137255f, 0.7529412f, 0.6313726f, 0.8509804f, 0.60784316f, 0.45490196f, 0.76862746f, 0.4627451f, 0.25490198f, 0.67058825f, 0.3647059f, 0.13725491f, 0.54509807f, 0.27058825f, 0.0f, 0.42745098f, 0.17254902f, 0.0f, 0.26666668f, 0.105882354f,
+		// YlGnBu
+		0.92941177f, 0.972549f, 0.69411767f, 0.49803922f, 0.8039216f, 0.73333335f, 0.17254902f, 0.49803922f, 0.72156864f,
+		1.0f, 1.0f, 0.8f, 0.6313726f, 0.85490197f, 0.7058824f, 0.25490198f, 0.7137255f, 0.76862746f, 0.13333334f, 0.36862746f, 0.65882355f,
+		1.0f, 1.0f, 0.8f, 0.6313726f, 0.85490197f, 0.7058824f, 0.25490198f, 0.7137255f, 0.76862746f, 0.17254902f, 0.49803922f, 0.72156864f, 0.14509805f, 0.20392157f, 0.5803922f,
+		1.0f, 1.0f, 0.8f, 0.78039217f, 0.9137255f, 0.7058824f, 0.49803922f, 0.8039216f, 0.73333335f, 0.25490198f, 0.7137255f, 0.76862746f, 0.17254902f, 0.49803922f, 0.72156864f, 0.14509805f, 0.20392157f, 0.5803922f,
+		1.0f, 1.0f, 0.8f, 0.78039217f, 0.9137255f, 0.7058824f, 0.49803922f, 0.8039216f, 0.73333335f, 0.25490198f, 0.7137255f, 0.76862746f, 0.11372549f, 0.5686275f, 0.7529412f, 0.13333334f, 0.36862746f, 0.65882355f, 0.047058824f, 0.17254902f, 0.5176471f,
+		1.0f, 1.0f, 0.8509804f, 0.92941177f, 0.972549f, 0.69411767f, 0.78039217f, 0.9137255f, 0.7058824f, 0.49803922f, 0.8039216f, 0.73333335f, 0.25490198f, 0.7137255f, 0.76862746f, 0.11372549f, 0.5686275f, 0.7529412f, 0.13333334f, 0.36862746f, 0.65882355f, 0.047058824f, 0.17254902f, 0.5176471f,
+		1.0f, 1.0f, 0.8509804f, 0.92941177f, 0.972549f, 0.69411767f, 0.78039217f, 0.9137255f, 0.7058824f, 0.49803922f, 0.8039216f, 0.73333335f, 0.25490198f, 0.7137255f, 0.76862746f, 0.11372549f, 0.5686275f, 0.7529412f, 0.13333334f, 0.36862746f, 0.65882355f, 0.14509805f, 0.20392157f, 0.5803922f, 0.03137255f, 0.11372549f, 0.34509805f,
+		// Purples
+		0.9372549f, 0.92941177f, 0.9607843f, 0.7372549f, 0.7411765f, 0.8627451f, 0.45882353f, 0.41960785f, 0.69411767f,
+		0.9490196f, 0.9411765f, 0.96862745f, 0.79607844f, 0.7882353f, 0.8862745f, 0.61960787f, 0.6039216f, 0.78431374f, 0.41568628f, 0.31764707f, 0.6392157f,
+		0.9490196f, 0.9411765f, 0.96862745f, 0.79607844f, 0.7882353f, 0.8862745f, 0.61960787f, 0.6039216f, 0.78431374f, 0.45882353f, 0.41960785f, 0.69411767f, 0.32941177f, 0.15294118f, 0.56078434f,
+		0.9490196f, 0.9411765f, 0.96862745f, 0.85490197f, 0.85490197f, 0.92156863f, 0.7372549f, 0.7411765f, 0.8627451f, 0.61960787f, 0.6039216f, 0.78431374f, 0.45882353f, 0.41960785f, 0.69411767f, 0.32941177f, 0.15294118f, 0.56078434f,
+		0.9490196f, 0.9411765f, 0.96862745f, 0.85490197f, 0.85490197f, 0.92156863f, 0.7372549f, 0.7411765f, 0.8627451f, 0.61960787f, 0.6039216f, 0.78431374f, 0.5019608f, 0.49019608f, 0.7294118f, 0.41568628f, 0.31764707f, 0.6392157f, 0.2901961f, 0.078431375f, 0.5254902f,
+		0.9882353f, 0.9843137f, 0.99215686f, 0.9372549f, 0.92941177f, 0.9607843f, 0.85490197f, 0.85490197f, 0.92156863f, 0.7372549f, 0.7411765f, 0.8627451f, 0.61960787f, 0.6039216f, 0.78431374f, 0.5019608f, 0.49019608f, 0.7294118f, 0.41568628f, 0.31764707f, 0.6392157f, 0.2901961f, 0.078431375f, 0.5254902f,
+		0.9882353f, 0.9843137f, 0.99215686f, 0.9372549f, 0.92941177f, 0.9607843f, 0.85490197f, 0.85490197f, 0.92156863f, 0.7372549f, 0.7411765f, 0.8627451f, 0.61960787f, 0.6039216f, 0.78431374f, 0.5019608f, 0.49019608f, 0.7294118f, 0.41568628f, 0.31764707f, 0.6392157f, 0.32941177f, 0.15294118f, 0.56078434f, 0.24705882f, 0.0f, 0.49019608f,
+		// GnBu
+		0.8784314f, 0.9529412f, 0.85882354f, 0.65882355f, 0.8666667f, 0.70980394f, 0.2627451f, 0.63529414f, 0.7921569f,
+		0.9411765f, 0.9764706f, 0.9098039f, 0.7294118f, 0.89411765f, 0.7372549f, 0.48235294f, 0.8f, 0.76862746f, 0.16862746f, 0.54901963f, 0.74509805f,
+		0.9411765f, 0.9764706f, 0.9098039f, 0.7294118f, 0.89411765f, 0.7372549f, 0.48235294f, 0.8f, 0.76862746f, 0.2627451f, 0.63529414f, 0.7921569f, 0.03137255f, 0.40784314f, 0.6745098f,
+		0.9411765f, 0.9764706f, 0.9098039f, 0.8f, 0.92156863f, 0.77254903f, 0.65882355f, 0.8666667f, 0.70980394f, 0.48235294f, 0.8f, 0.76862746f, 0.2627451f, 0.63529414f, 0.7921569f, 0.03137255f, 0.40784314f, 0.6745098f,
+		0.9411765f, 0.9764706f, 0.9098039f, 0.8f, 0.92156863f, 0.77254903f, 0.65882355f, 0.8666667f, 0.70980394f, 0.48235294f, 0.8f, 0.76862746f, 0.30588236f, 0.7019608f, 0.827451f, 0.16862746f, 0.54901963f, 0.74509805f, 0.03137255f, 0.34509805f, 0.61960787f,
+		0.96862745f, 0.9882353f, 0.9411765f, 0.8784314f, 0.9529412f, 0.85882354f, 0.8f, 0.92156863f, 0.77254903f, 0.65882355f, 0.8666667f, 0.70980394f, 0.48235294f, 0.8f, 0.76862746f, 0.30588236f, 0.7019608f, 0.827451f, 0.16862746f, 0.54901963f, 0.74509805f, 0.03137255f, 0.34509805f, 0.61960787f,
+		0.96862745f, 0.9882353f, 0.9411765f, 0.8784314f, 0.9529412f, 0.85882354f, 0.8f, 0.92156863f, 0.77254903f, 0.65882355f, 0.8666667f, 0.70980394f, 0.48235294f, 0.8f, 0.76862746f, 0.30588236f, 0.7019608f, 0.827451f, 0.16862746f, 0.54901963f, 0.74509805f, 0.03137255f, 0.40784314f, 0.6745098f, 0.03137255f, 0.2509804f, 0.5058824f,
+		// Greys
+		0.9411765f, 0.9411765f, 0.9411765f, 0.7411765f, 0.7411765f, 0.7411765f, 0.3882353f, 0.3882353f, 0.3882353f,
+		0.96862745f, 0.96862745f, 0.96862745f, 0.8f, 0.8f, 0.8f, 0.5882353f, 0.5882353f, 0.5882353f, 0.32156864f, 0.32156864f, 0.32156864f,
+		0.96862745f, 0.96862745f, 0.96862745f, 0.8f, 0.8f, 0.8f, 0.5882353f, 0.5882353f, 0.5882353f, 0.3882353f, 0.3882353f, 0.3882353f, 0.14509805f, 0.14509805f, 0.14509805f,
+		0.96862745f, 0.96862745f, 0.96862745f, 0.8509804f, 0.8509804f, 0.8509804f, 0.7411765f, 0.7411765f, 0.7411765f, 0.5882353f, 0.5882353f, 0.5882353f, 0.3882353f, 0.3882353f, 0.3882353f, 0.14509805f, 0.14509805f, 0.14509805f,
+		0.96862745f, 0.96862745f, 0.96862745f, 0.8509804f, 0.8509804f, 0.8509804f, 0.7411765f, 0.7411765f, 0.7411765f, 0.5882353f, 0.5882353f, 0.5882353f, 0.4509804f, 0.4509804f, 0.4509804f, 0.32156864f, 0.32156864f, 0.32156864f, 0.14509805f, 0.14509805f, 0.14509805f,
+		1.0f, 1.0f, 1.0f, 0.9411765f, 0.9411765f, 0.9411765f, 0.8509804f, 0.8509804f, 0.8509804f, 0.7411765f, 0.7411765f, 0.7411765f, 0.5882353f, 0.5882353f, 0.5882353f, 0.4509804f, 0.4509804f, 0.4509804f, 0.32156864f, 0.32156864f, 0.32156864f, 0.14509805f, 0.14509805f, 0.14509805f,
+		1.0f, 1.0f, 1.0f, 0.9411765f, 0.9411765f, 0.9411765f, 0.8509804f, 0.8509804f, 0.8509804f, 0.7411765f, 0.7411765f, 0.7411765f, 0.5882353f, 0.5882353f, 0.5882353f, 0.4509804f, 0.4509804f, 0.4509804f, 0.32156864f, 0.32156864f, 0.32156864f, 0.14509805f, 0.14509805f, 0.14509805f, 0.0f, 0.0f, 0.0f,
+		// YlOrRd
+		1.0f, 0.92941177f, 0.627451f, 0.99607843f, 0.69803923f, 0.29803923f, 0.9411765f, 0.23137255f, 0.1254902f,
+		1.0f, 1.0f, 0.69803923f, 0.99607843f, 0.8f, 0.36078432f, 0.99215686f, 0.5529412f, 0.23529412f, 0.8901961f, 0.101960786f, 0.10980392f,
+		1.0f, 1.0f, 0.69803923f, 0.99607843f, 0.8f, 0.36078432f, 0.99215686f, 0.5529412f, 0.23529412f, 0.9411765f, 0.23137255f, 0.1254902f, 0.7411765f, 0.0f, 0.14901961f,
+		1.0f, 1.0f, 0.69803923f, 0.99607843f, 0.8509804f, 0.4627451f, 0.99607843f, 0.69803923f, 0.29803923f, 0.99215686f, 0.5529412f, 0.23529412f, 0.9411765f, 0.23137255f, 0.1254902f, 0.7411765f, 0.0f, 0.14901961f,
+		1.0f, 1.0f, 0.69803923f, 0.99607843f, 0.8509804f, 0.4627451f, 0.99607843f, 0.69803923f, 0.29803923f, 0.99215686f, 0.5529412f, 0.23529412f, 0.9882353f, 0.30588236f, 0.16470589f, 0.8901961f, 0.101960786f, 0.10980392f, 0.69411767f, 0.0f, 0.14901961f,
+		1.0f, 1.0f, 0.8f, 1.0f, 0.92941177f, 0.627451f, 0.99607843f, 0.8509804f, 0.4627451f, 0.99607843f, 0.69803923f, 0.29803923f, 0.99215686f, 0.5529412f, 0.23529412f, 0.9882353f, 0.30588236f, 0.16470589f, 0.8901961f, 0.101960786f, 0.10980392f, 0.69411767f, 0.0f, 0.14901961f,
+		1.0f, 1.0f, 0.8f, 1.0f, 0.92941177f, 0.627451f, 0.99607843f, 0.8509804f, 0.4627451f, 0.99607843f, 0.69803923f, 0.29803923f, 0.99215686f, 0.5529412f, 0.23529412f, 0.9882353f, 0.30588236f, 0.16470589f, 0.8901961f, 0.101960786f, 0.10980392f, 0.7411765f, 0.0f, 0.14901961f, 0.5019608f, 0.0f, 0.14901961f,
+		// PuRd
+		0.90588236f, 0.88235295f, 0.9372549f, 0.7882353f, 0.5803922f, 0.78039217f, 0.8666667f, 0.10980392f, 0.46666667f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.84313726f, 0.70980394f, 0.84705883f, 0.8745098f, 0.39607844f, 0.6901961f, 0.80784315f, 0.07058824f, 0.3372549f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.84313726f, 0.70980394f, 0.84705883f, 0.8745098f, 0.39607844f, 0.6901961f, 0.8666667f, 0.10980392f, 0.46666667f, 0.59607846f, 0.0f, 0.2627451f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.83137256f, 0.7254902f, 0.85490197f, 0.7882353f, 0.5803922f, 0.78039217f, 0.8745098f, 0.39607844f, 0.6901961f, 0.8666667f, 0.10980392f, 0.46666667f, 0.59607846f, 0.0f, 0.2627451f,
+		0.94509804f, 0.93333334f, 0.9647059f, 0.83137256f, 0.7254902f, 0.85490197f, 0.7882353f, 0.5803922f, 0.78039217f, 0.8745098f, 0.39607844f, 0.6901961f, 0.90588236f, 0.16078432f, 0.5411765f, 0.80784315f, 0.07058824f, 0.3372549f, 0.5686275f, 0.0f, 0.24705882f,
+		0.96862745f, 0.95686275f, 0.9764706f, 0.90588236f, 0.88235295f, 0.9372549f, 0.83137256f, 0.7254902f, 0.85490197f, 0.7882353f, 0.5803922f, 0.78039217f, 0.8745098f, 0.39607844f, 0.6901961f, 0.90588236f, 0.16078432f, 0.5411765f, 0.80784315f, 0.07058824f, 0.3372549f, 0.5686275f, 0.0f, 0.24705882f,
+		0.96862745f, 0.95686275f, 0.9764706f, 0.90588236f, 0.88235295f, 0.9372549f, 0.83137256f, 0.7254902f, 0.85490197f, 0.7882353f, 0.5803922f, 0.78039217f, 0.8745098f, 0.39607844f, 0.6901961f, 0.90588236f, 0.16078432f, 0.5411765f, 0.80784315f, 0.07058824f, 0.3372549f, 0.59607846f, 0.0f, 0.2627451f, 0.40392157f, 0.0f, 0.12156863f,
+		// Blues
+		0.87058824f, 0.92156863f, 0.96862745f, 0.61960787f, 0.7921569f, 0.88235295f, 0.19215687f, 0.50980395f, 0.7411765f,
+		0.9372549f, 0.9529412f, 1.0f, 0.7411765f, 0.84313726f, 0.90588236f, 0.41960785f, 0.68235296f, 0.8392157f, 0.12941177f, 0.44313726f, 0.70980394f,
+		0.9372549f, 0.9529412f, 1.0f, 0.7411765f, 0.84313726f, 0.90588236f, 0.41960785f, 0.68235296f, 0.8392157f, 0.19215687f, 0.50980395f, 0.7411765f, 0.03137255f, 0.31764707f, 0.6117647f,
+		0.9372549f, 0.9529412f, 1.0f, 0.7764706f, 0.85882354f, 0.9372549f, 0.61960787f, 0.7921569f, 0.88235295f, 0.41960785f, 0.68235296f, 0.8392157f, 0.19215687f, 0.50980395f, 0.7411765f, 0.03137255f, 0.31764707f, 0.6117647f,
+		0.9372549f, 0.9529412f, 1.0f, 0.7764706f, 0.85882354f, 0.9372549f, 0.61960787f, 0.7921569f, 0.88235295f, 0.41960785f, 0.68235296f, 0.8392157f, 0.25882354f, 0.57254905f, 0.7764706f, 0.12941177f, 0.44313726f, 0.70980394f, 0.03137255f, 0.27058825f, 0.5803922f,
+		0.96862745f, 0.9843137f, 1.0f, 0.87058824f, 0.92156863f, 0.96862745f, 0.7764706f, 0.85882354f, 0.9372549f, 0.61960787f, 0.7921569f, 0.88235295f, 0.41960785f, 0.68235296f, 0.8392157f, 0.25882354f, 0.57254905f, 0.7764706f, 0.12941177f, 0.44313726f, 0.70980394f, 0.03137255f, 0.27058825f, 0.5803922f,
+		0.96862745f, 0.9843137f, 1.0f, 0.87058824f, 0.92156863f, 0.96862745f, 0.7764706f, 0.85882354f, 0.9372549f, 0.61960787f, 0.7921569f, 0.88235295f, 0.41960785f, 0.68235296f, 0.8392157f, 0.25882354f, 0.57254905f, 0.7764706f, 0.12941177f, 0.44313726f, 0.70980394f, 0.03137255f, 0.31764707f, 0.6117647f, 0.03137255f, 0.1882353f, 0.41960785f,
+		// PuBuGn
+		0.9254902f, 0.8862745f, 0.9411765f, 0.6509804f, 0.7411765f, 0.85882354f, 0.10980392f, 0.5647059f, 0.6f,
+		0.9647059f, 0.9372549f, 0.96862745f, 0.7411765f, 0.7882353f, 0.88235295f, 0.40392157f, 0.6627451f, 0.8117647f, 0.007843138f, 0.5058824f, 0.5411765f,
+		0.9647059f, 0.9372549f, 0.96862745f, 0.7411765f, 0.7882353f, 0.88235295f, 0.40392157f, 0.6627451f, 0.8117647f, 0.10980392f, 0.5647059f, 0.6f, 0.003921569f, 0.42352942f, 0.34901962f,
+		0.9647059f, 0.9372549f, 0.96862745f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.40392157f, 0.6627451f, 0.8117647f, 0.10980392f, 0.5647059f, 0.6f, 0.003921569f, 0.42352942f, 0.34901962f,
+		0.9647059f, 0.9372549f, 0.96862745f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.40392157f, 0.6627451f, 0.8117647f, 0.21176471f, 0.5647059f, 0.7529412f, 0.007843138f, 0.5058824f, 0.5411765f, 0.003921569f, 0.39215687f, 0.3137255f,
+		1.0f, 0.96862745f, 0.9843137f, 0.9254902f, 0.8862745f, 0.9411765f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.40392157f, 0.6627451f, 0.8117647f, 0.21176471f, 0.5647059f, 0.7529412f, 0.007843138f, 0.5058824f, 0.5411765f, 0.003921569f, 0.39215687f, 0.3137255f,
+		1.0f, 0.96862745f, 0.9843137f, 0.9254902f, 0.8862745f, 0.9411765f, 0.8156863f, 0.81960785f, 0.9019608f, 0.6509804f, 0.7411765f, 0.85882354f, 0.40392157f, 0.6627451f, 0.8117647f, 0.21176471f, 0.5647059f, 0.7529412f, 0.007843138f, 0.5058824f, 0.5411765f, 0.003921569f, 0.42352942f, 0.34901962f, 0.003921569f, 0.27450982f, 0.21176471f
+	};
+
+
+	constexpr unsigned char rgb8Table[5067] =
+	{
+		// diverging
+		// Spectral
+		252, 141, 89, 255, 255, 191, 153, 213, 148,
+		215, 25, 28, 253, 174, 97, 171, 221, 164, 43, 131, 186,
+		215, 25, 28, 253, 174, 97, 255, 255, 191, 171, 221, 164, 43, 131, 186,
+		213, 62, 79, 252, 141, 89, 254, 224, 139, 230, 245, 152, 153, 213, 148, 50, 136, 189,
+		213, 62, 79, 252, 141, 89, 254, 224, 139, 255, 255, 191, 230, 245, 152, 153, 213, 148, 50, 136, 189,
+		213, 62, 79, 244, 109, 67, 253, 174, 97, 254, 224, 139, 230, 245, 152, 171, 221, 164, 102, 194, 165, 50, 136, 189,
+		213, 62, 79, 244, 109, 67, 253, 174, 97, 254, 224, 139, 255, 255, 191, 230, 245, 152, 171, 221, 164, 102, 194, 165, 50, 136, 189,
+		158, 1, 66, 213, 62, 79, 244, 109, 67, 253, 174, 97, 254, 224, 139, 230, 245, 152, 171, 221, 164, 102, 194, 165, 50, 136, 189, 94, 79, 162,
+		158, 1, 66, 213, 62, 79, 244, 109, 67, 253, 174, 97, 254, 224, 139, 255, 255, 191, 230, 245, 152, 171, 221, 164, 102, 194, 165, 50, 136, 189, 94, 79, 162,
+		// RdYlGn
+		252, 141, 89, 255, 255, 191, 145, 207, 96,
+		215, 25, 28, 253, 174, 97, 166, 217, 106, 26, 150, 65,
+		215, 25, 28, 253, 174, 97, 255, 255, 191, 166, 217, 106, 26, 150, 65,
+		215, 48, 39, 252, 141, 89, 254, 224, 139, 217, 239, 139, 145, 207, 96, 26, 152, 80,
+		215, 48, 39, 252, 141, 89, 254, 224, 139, 255, 255, 191, 217, 239, 139, 145, 207, 96, 26, 152, 80,
+		215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 139, 217, 239, 139, 166, 217, 106, 102, 189, 99, 26, 152, 80,
+		215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 139, 255, 255, 191, 217, 239, 139, 166, 217, 106, 102, 189, 99, 26, 152, 80,
+		165, 0, 38, 215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 139, 217, 239, 139, 166, 217, 106, 102, 189, 99, 26, 152, 80, 0, 104, 55,
+		165, 0, 38, 215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 139, 255, 255, 191, 217, 239, 139, 166, 217, 106, 102, 189, 99, 26, 152, 80, 0, 104, 55,
+		// RdBu
+		239, 138, 98, 247, 247, 247, 103, 169, 207,
+		202, 0, 32, 244, 165, 130, 146, 197, 222, 5, 113, 176,
+		202, 0, 32, 244, 165, 130, 247, 247, 247, 146, 197, 222, 5, 113, 176,
+		178, 24, 43, 239, 138, 98, 253, 219, 199, 209, 229, 240, 103, 169, 207, 33, 102, 172,
+		178, 24, 43, 239, 138, 98, 253, 219, 199, 247, 247, 247, 209, 229, 240, 103, 169, 207, 33, 102, 172,
+		178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 209, 229, 240, 146, 197, 222, 67, 147, 195, 33, 102, 172,
+		178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 247, 247, 247, 209, 229, 240, 146, 197, 222, 67, 147, 195, 33, 102, 172,
+		103, 0, 31, 178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 209, 229, 240, 146, 197, 222, 67, 147, 195, 33, 102, 172, 5, 48, 97,
+		103, 0, 31, 178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 247, 247, 247, 209, 229, 240, 146, 197, 222, 67, 147, 195, 33, 102, 172, 5, 48, 97,
+		// PiYG
+		233, 163, 201, 247, 247, 247, 161, 215, 106,
+		208, 28, 139, 241, 182, 218, 184, 225, 134, 77, 172, 38,
+		208, 28, 139, 241, 182, 218, 247, 247, 247, 184, 225, 134, 77, 172, 38,
+		197, 27, 125, 233, 163, 201, 253, 224, 239, 230, 245, 208, 161, 215, 106, 77, 146, 33,
+		197, 27, 125, 233, 163, 201, 253, 224, 239, 247, 247, 247, 230, 245, 208, 161, 215, 106, 77, 146, 33,
+		197, 27, 125, 222, 119, 174, 241, 182, 218, 253, 224, 239, 230, 245, 208, 184, 225, 134, 127, 188, 65, 77, 146, 33,
+		197, 27, 125, 222, 119, 174, 241, 182, 218, 253, 224, 239, 247, 247, 247, 230, 245, 208, 184, 225, 134, 127, 188, 65, 77, 146, 33,
+		142, 1, 82, 197, 27, 125, 222, 119, 174, 241, 182, 218, 253, 224, 239, 230, 245, 208, 184, 225, 134, 127, 188, 65, 77, 146, 33, 39, 100, 25,
+		142, 1, 82, 197, 27, 125, 222, 119, 174, 241, 182, 218, 253, 224, 239, 247, 247, 247, 230, 245, 208, 184, 225, 134, 127, 188, 65, 77, 146, 33, 39, 100, 25,
+		// PRGn
+		175, 141, 195, 247, 247, 247, 127, 191, 123,
+		123, 50, 148, 194, 165, 207, 166, 219, 160, 0, 136, 55,
+		123, 50, 148, 194, 165, 207, 247, 247, 247, 166, 219, 160, 0, 136, 55,
+		118, 42, 131, 175, 141, 195, 231, 212, 232, 217, 240, 211, 127, 191, 123, 27, 120, 55,
+		118, 42, 131, 175, 141, 195, 231, 212, 232, 247, 247, 247, 217, 240, 211, 127, 191, 123, 27, 120, 55,
+		118, 42, 131, 153, 112, 171, 194, 165, 207, 231, 212, 232, 217, 240, 211, 166, 219, 160, 90, 174, 97, 27, 120, 55,
+		118, 42, 131, 153, 112, 171, 194, 165, 207, 231, 212, 232, 247, 247, 247, 217, 240, 211, 166, 219, 160, 90, 174, 97, 27, 120, 55,
+		64, 0, 75, 118, 42, 131, 153, 112, 171, 194, 165, 207, 231, 212, 232, 217, 240, 211, 166, 219, 160, 90, 174, 97, 27, 120, 55, 0, 68, 27,
+		64, 0, 75, 118, 42, 131, 153, 112, 171, 194, 165, 207, 231, 212, 232, 247, 247, 247, 217, 240, 211, 166, 219, 160, 90, 174, 97, 27, 120, 55, 0, 68, 27,
+		// RdYlBu
+		252, 141, 89, 255, 255, 191, 145, 191, 219,
+		215, 25, 28, 253, 174, 97, 171, 217, 233, 44, 123, 182,
+		215, 25, 28, 253, 174, 97, 255, 255, 191, 171, 217, 233, 44, 123, 182,
+		215, 48, 39, 252, 141, 89, 254, 224, 144, 224, 243, 248, 145, 191, 219, 69, 117, 180,
+		215, 48, 39, 252, 141, 89, 254, 224, 144, 255, 255, 191, 224, 243, 248, 145, 191, 219, 69, 117, 180,
+		215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 144, 224, 243, 248, 171, 217, 233, 116, 173, 209, 69, 117, 180,
+		215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 144, 255, 255, 191, 224, 243, 248, 171, 217, 233, 116, 173, 209, 69, 117, 180,
+		165, 0, 38, 215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 144, 224, 243, 248, 171, 217, 233, 116, 173, 209, 69, 117, 180, 49, 54, 149,
+		165, 0, 38, 215, 48, 39, 244, 109, 67, 253, 174, 97, 254, 224, 144, 255, 255, 191, 224, 243, 248, 171, 217, 233, 116, 173, 209, 69, 117, 180, 49, 54, 149,
+		// BrBG
+		216, 179, 101, 245, 245, 245, 90, 180, 172,
+		166, 97, 26, 223, 194, 125, 128, 205, 193, 1, 133, 113,
+		166, 97, 26, 223, 194, 125, 245, 245, 245, 128, 205, 193, 1, 133, 113,
+		140, 81, 10, 216, 179, 101, 246, 232, 195, 199, 234, 229, 90, 180, 172, 1, 102, 94,
+		140, 81, 10, 216, 179, 101, 246, 232, 195, 245, 245, 245, 199, 234, 229, 90, 180, 172, 1, 102, 94,
+		140, 81, 10, 191, 129, 45, 223, 194, 125, 246, 232, 195, 199, 234, 229, 128, 205, 193, 53, 151, 143, 1, 102, 94,
+		140, 81, 10, 191, 129, 45, 223, 194, 125, 246, 232, 195, 245, 245, 245, 199, 234, 229, 128, 205, 193, 53, 151, 143, 1, 102, 94,
+		84, 48, 5, 140, 81, 10, 191, 129, 45, 223, 194, 125, 246, 232, 195, 199, 234, 229, 128, 205, 193, 53, 151, 143, 1, 102, 94, 0, 60, 48,
+		84, 48, 5, 140, 81, 10, 191, 129, 45, 223, 194, 125, 246, 232, 195, 245, 245, 245, 199, 234, 229, 128, 205, 193, 53, 151, 143, 1, 102, 94, 0, 60, 48,
+		// RdGy
+		239, 138, 98, 255, 255, 255, 153, 153, 153,
+		202, 0, 32, 244, 165, 130, 186, 186, 186, 64, 64, 64,
+		202, 0, 32, 244, 165, 130, 255, 255, 255, 186, 186, 186, 64, 64, 64,
+		178, 24, 43, 239, 138, 98, 253, 219, 199, 224, 224, 224, 153, 153, 153, 77, 77, 77,
+		178, 24, 43, 239, 138, 98, 253, 219, 199, 255, 255, 255, 224, 224, 224, 153, 153, 153, 77, 77, 77,
+		178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 224, 224, 224, 186, 186, 186, 135, 135, 135, 77, 77, 77,
+		178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 255, 255, 255, 224, 224, 224, 186, 186, 186, 135, 135, 135, 77, 77, 77,
+		103, 0, 31, 178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 224, 224, 224, 186, 186, 186, 135, 135, 135, 77, 77, 77, 26, 26, 26,
+		103, 0, 31, 178, 24, 43, 214, 96, 77, 244, 165, 130, 253, 219, 199, 255, 255, 255, 224, 224, 224, 186, 186, 186, 135, 135, 135, 77, 77, 77, 26, 26, 26,
+		// PuOr
+		241, 163, 64, 247, 247, 247, 153, 142, 195,
+		230, 97, 1, 253, 184, 99, 178, 171, 210, 94, 60, 153,
+		230, 97, 1, 253, 184, 99, 247, 247, 247, 178, 171, 210, 94, 60, 153,
+		179, 88, 6, 241, 163, 64, 254, 224, 182, 216, 218, 235, 153, 142, 195, 84, 39, 136,
+		179, 88, 6, 241, 163, 64, 254, 224, 182, 247, 247, 247, 216, 218, 235, 153, 142, 195, 84, 39, 136,
+		179, 88, 6, 224, 130, 20, 253, 184, 99, 254, 224, 182, 216, 218, 235, 178, 171, 210, 128, 115, 172, 84, 39, 136,
+		179, 88, 6, 224, 130, 20, 253, 184, 99, 254, 224, 182, 247, 247, 247, 216, 218, 235, 178, 171, 210, 128, 115, 172, 84, 39, 136,
+		127, 59, 8, 179, 88, 6, 224, 130, 20, 253, 184, 99, 254, 224, 182, 216, 218, 235, 178, 171, 210, 128, 115, 172, 84, 39, 136, 45, 0, 75,
+		127, 59, 8, 179, 88, 6, 224, 130, 20, 253, 184, 99, 254, 224, 182, 247, 247, 247, 216, 218, 235, 178, 171, 210, 128, 115, 172, 84, 39, 136, 45, 0, 75,
+
+		// qualitative
+		// Set2
+		102, 194, 165, 252, 141, 98, 141, 160, 203,
+		102, 194, 165, 252, 141, 98, 141, 160, 203, 231, 138, 195,
+		102, 194, 165, 252, 141, 98, 141, 160, 203, 231, 138, 195, 166, 216, 84,
+		102, 194, 165, 252, 141, 98, 141, 160, 203, 231, 138, 195, 166, 216, 84, 255, 217, 47,
+		102, 194, 165, 252, 141, 98, 141, 160, 203, 231, 138, 195, 166, 216, 84, 255, 217, 47, 229, 196, 148,
+		102, 194, 165, 252, 141, 98, 141, 160, 203, 231, 138, 195, 166, 216, 84, 255, 217, 47, 229, 196, 148, 179, 179, 179,
+		// Accent
+		127, 201, 127, 190, 174, 212, 253, 192, 134,
+		127, 201, 127, 190, 174, 212, 253, 192, 134, 255, 255, 153,
+		127, 201, 127, 190, 174, 212, 253, 192, 134, 255, 255, 153, 56, 108, 176,
+		127, 201, 127, 190, 174, 212, 253, 192, 134, 255, 255, 153, 56, 108, 176, 240, 2, 127,
+		127, 201, 127, 190, 174, 212, 253, 192, 134, 255, 255, 153, 56, 108, 176, 240, 2, 127, 191, 91, 23,
+		127, 201, 127, 190, 174, 212, 253, 192, 134, 255, 255, 153, 56, 108, 176, 240, 2, 127, 191, 91, 23, 102, 102, 102,
+		// Set1
+		228, 26, 28, 55, 126, 184, 77, 175, 74,
+		228, 26, 28, 55, 126, 184, 77, 175, 74, 152, 78, 163,
+		228, 26, 28, 55, 126, 184, 77, 175, 74, 152, 78, 163, 255, 127, 0,
+		228, 26, 28, 55, 126, 184, 77, 175, 74, 152, 78, 163, 255, 127, 0, 255, 255, 51,
+		228, 26, 28, 55, 126, 184, 77, 175, 74, 152, 78, 163, 255, 127, 0, 255, 255, 51, 166, 86, 40,
+		228, 26, 28, 55, 126, 184, 77, 175, 74, 152, 78, 163, 255, 127, 0, 255, 255, 51, 166, 86, 40, 247, 129, 191,
+		228, 26, 28, 55, 126, 184, 77, 175, 74, 152, 78, 163, 255, 127, 0, 255, 255, 51, 166, 86, 40, 247, 129, 191, 153, 153, 153,
+		// Set3
+		141, 211, 199, 255, 255, 179, 190, 186, 218,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211, 253, 180, 98,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211, 253, 180, 98, 179, 222, 105,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211, 253, 180, 98, 179, 222, 105, 252, 205, 229,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211, 253, 180, 98, 179, 222, 105, 252, 205, 229, 217, 217, 217,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211, 253, 180, 98, 179, 222, 105, 252, 205, 229, 217, 217, 217, 188, 128, 189,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211, 253, 180, 98, 179, 222, 105, 252, 205, 229, 217, 217, 217, 188, 128, 189, 204, 235, 197,
+		141, 211, 199, 255, 255, 179, 190, 186, 218, 251, 128, 114, 128, 177, 211, 253, 180, 98, 179, 222, 105, 252, 205, 229, 217, 217, 217, 188, 128, 189, 204, 235, 197, 255, 237, 111,
+		// Dark2
+		27, 158, 119, 217, 95, 2, 117, 112, 179,
+		27, 158, 119, 217, 95, 2, 117, 112, 179, 231, 41, 138,
+		27, 158, 119, 217, 95, 2, 117, 112, 179, 231, 41, 138, 102, 166, 30,
+		27, 158, 119, 217, 95, 2, 117, 112, 179, 231, 41, 138, 102, 166, 30, 230, 171, 2,
+		27, 158, 119, 217, 95, 2, 117, 112, 179, 231, 41, 138, 102, 166, 30, 230, 171, 2, 166, 118, 29,
+		27, 158, 119, 217, 95, 2, 117, 112, 179, 231, 41, 138, 102, 166, 30, 230, 171, 2, 166, 118, 29, 102, 102, 102,
+		// Paired
+		166, 206, 227, 31, 120, 180, 178, 223, 138,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153, 227, 26, 28,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153, 227, 26, 28, 253, 191, 111,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153, 227, 26, 28, 253, 191, 111, 255, 127, 0,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153, 227, 26, 28, 253, 191, 111, 255, 127, 0, 202, 178, 214,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153, 227, 26, 28, 253, 191, 111, 255, 127, 0, 202, 178, 214, 106, 61, 154,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153, 227, 26, 28, 253, 191, 111, 255, 127, 0, 202, 178, 214, 106, 61, 154, 255, 255, 153,
+		166, 206, 227, 31, 120, 180, 178, 223, 138, 51, 160, 44, 251, 154, 153, 227, 26, 28, 253, 191, 111, 255, 127, 0, 202, 178, 214, 106, 61, 154, 255, 255, 153, 177, 89, 40,
+		// Pastel2
+		179, 226, 205, 253, 205, 172, 203, 213, 232,
+		179, 226, 205, 253, 205, 172, 203, 213, 232, 244, 202, 228,
+		179, 226, 205, 253, 205, 172, 203, 213, 232, 244, 202, 228, 230, 245, 201,
+		179, 226, 205, 253, 205, 172, 203, 213, 232, 244, 202, 228, 230, 245, 201, 255, 242, 174,
+		179, 226, 205, 253, 205, 172, 203, 213, 232, 244, 202, 228, 230, 245, 201, 255, 242, 174, 241, 226, 204,
+		179, 226, 205, 253, 205, 172, 203, 213, 232, 244, 202, 228, 230, 245, 201, 255, 242, 174, 241, 226, 204, 204, 204, 204,
+		// Pastel1
+		251, 180, 174, 179, 205, 227, 204, 235, 197,
+		251, 180, 174, 179, 205, 227, 204, 235, 197, 222, 203, 228,
+		251, 180, 174, 179, 205, 227, 204, 235, 197, 222, 203, 228, 254, 217, 166,
+		251, 180, 174, 179, 205, 227, 204, 235, 197, 222, 203, 228, 254, 217, 166, 255, 255, 204,
+		251, 180, 174, 179, 205, 227, 204, 235, 197, 222, 203, 228, 254, 217, 166, 255, 255, 204, 229, 216, 189,
+		251, 180, 174, 179, 205, 227, 204, 235, 197, 222, 203, 228, 254, 217, 166, 255, 255, 204, 229, 216, 189, 253, 218, 236,
+		251, 180, 174, 179, 205, 227, 204, 235, 197, 222, 203, 228, 254, 217, 166, 255, 255, 204, 229, 216, 189, 253, 218, 236, 242, 242, 242,
+
+		// sequential
+		// OrRd
+		254, 232, 200, 253, 187, 132, 227, 74, 51,
+		254, 240, 217, 253, 204, 138, 252, 141, 89, 215, 48, 31,
+		254, 240, 217, 253, 204, 138, 252, 141, 89, 227, 74, 51, 179, 0, 0,
+		254, 240, 217, 253, 212, 158, 253, 187, 132, 252, 141, 89, 227, 74, 51, 179, 0, 0,
+		254, 240, 217, 253, 212, 158, 253, 187, 132, 252, 141, 89, 239, 101, 72, 215, 48, 31, 153, 0, 0,
+		255, 247, 236, 254, 232, 200, 253, 212, 158, 253, 187, 132, 252, 141, 89, 239, 101, 72, 215, 48, 31, 153, 0, 0,
+		255, 247, 236, 254, 232, 200, 253, 212, 158, 253, 187, 132, 252, 141, 89, 239, 101, 72, 215, 48, 31, 179, 0, 0, 127, 0, 0,
+		// PuBu
+		236, 231, 242, 166, 189, 219, 43, 140, 190,
+		241, 238, 246, 189, 201, 225, 116, 169, 207, 5, 112, 176,
+		241, 238, 246, 189, 201, 225, 116, 169, 207, 43, 140, 190, 4, 90, 141,
+		241, 238, 246, 208, 209, 230, 166, 189, 219, 116, 169, 207, 43, 140, 190, 4, 90, 141,
+		241, 238, 246, 208, 209, 230, 166, 189, 219, 116, 169, 207, 54, 144, 192, 5, 112, 176, 3, 78, 123,
+		255, 247, 251, 236, 231, 242, 208, 209, 230, 166, 189, 219, 116, 169, 207, 54, 144, 192, 5, 112, 176, 3, 78, 123,
+		255, 247, 251, 236, 231, 242, 208, 209, 230, 166, 189, 219, 116, 169, 207, 54, 144, 192, 5, 112, 176, 4, 90, 141, 2, 56, 88,
+		// BuPu
+		224, 236, 244, 158, 188, 218, 136, 86, 167,
+		237, 248, 251, 179, 205, 227, 140, 150, 198, 136, 65, 157,
+		237, 248, 251, 179, 205, 227, 140, 150, 198, 136, 86, 167, 129, 15, 124,
+		237, 248, 251, 191, 211, 230, 158, 188, 218, 140, 150, 198, 136, 86, 167, 129, 15, 124,
+		237, 248, 251, 191, 211, 230, 158, 188, 218, 140, 150, 198, 140, 107, 177, 136, 65, 157, 110, 1, 107,
+		247, 252, 253, 224, 236, 244, 191, 211, 230, 158, 188, 218, 140, 150, 198, 140, 107, 177, 136, 65, 157, 110, 1, 107,
+		247, 252, 253, 224, 236, 244, 191, 211, 230, 158, 188, 218, 140, 150, 198, 140, 107, 177, 136, 65, 157, 129, 15, 124, 77, 0, 75,
+		// Oranges
+		254, 230, 206, 253, 174, 107, 230, 85, 13,
+		254, 237, 222, 253, 190, 133, 253, 141, 60, 217, 71, 1,
+		254, 237, 222, 253, 190, 133, 253, 141, 60, 230, 85, 13, 166, 54, 3,
+		254, 237, 222, 253, 208, 162, 253, 174, 107, 253, 141, 60, 230, 85, 13, 166, 54, 3,
+		254, 237, 222, 253, 208, 162, 253, 174, 107, 253, 141, 60, 241, 105, 19, 217, 72, 1, 140, 45, 4,
+		255, 245, 235, 254, 230, 206, 253, 208, 162, 253, 174, 107, 253, 141, 60, 241, 105, 19, 217, 72, 1, 140, 45, 4,
+		255, 245, 235, 254, 230, 206, 253, 208, 162, 253, 174, 107, 253, 141, 60, 241, 105, 19, 217, 72, 1, 166, 54, 3, 127, 39, 4,
+		// BuGn
+		229, 245, 249, 153, 216, 201, 44, 162, 95,
+		237, 248, 251, 178, 226, 226, 102, 194, 164, 35, 139, 69,
+		237, 248, 251, 178, 226, 226, 102, 194, 164, 44, 162, 95, 0, 109, 44,
+		237, 248, 251, 204, 236, 230, 153, 216, 201, 102, 194, 164, 44, 162, 95, 0, 109, 44,
+		237, 248, 251, 204, 236, 230, 153, 216, 201, 102, 194, 164, 65, 174, 118, 35, 139, 69, 0, 88, 36,
+		247, 252, 253, 229, 245, 249, 204, 236, 230, 153, 216, 201, 102, 194, 164, 65, 174, 118, 35, 139, 69, 0, 88, 36,
+		247, 252, 253, 229, 245, 249, 204, 236, 230, 153, 216, 201, 102, 194, 164, 65, 174, 118, 35, 139, 69, 0, 109, 44, 0, 68, 27,
+		// YlOrBr
+		255, 247, 188, 254, 196, 79, 217, 95, 14,
+		255, 255, 212, 254, 217, 142, 254, 153, 41, 204, 76, 2,
+		255, 255, 212, 254, 217, 142, 254, 153, 41, 217, 95, 14, 153, 52, 4,
+		255, 255, 212, 254, 227, 145, 254, 196, 79, 254, 153, 41, 217, 95, 14, 153, 52, 4,
+		255, 255, 212, 254, 227, 145, 254, 196, 79, 254, 153, 41, 236, 112, 20, 204, 76, 2, 140, 45, 4,
+		255, 255, 229, 255, 247, 188, 254, 227, 145, 254, 196, 79, 254, 153, 41, 236, 112, 20, 204, 76, 2, 140, 45, 4,
+		255, 255, 229, 255, 247, 188, 254, 227, 145, 254, 196, 79, 254, 153, 41, 236, 112, 20, 204, 76, 2, 153, 52, 4, 102, 37, 6,
+		// YlGn
+		247, 252, 185, 173, 221, 142, 49, 163, 84,
+		255, 255, 204, 194, 230, 153, 120, 198, 121, 35, 132, 67,
+		255, 255, 204, 194, 230, 153, 120, 198, 121, 49, 163, 84, 0, 104, 55,
+		255, 255, 204, 217, 240, 163, 173, 221, 142, 120, 198, 121, 49, 163, 84, 0, 104, 55,
+		255, 255, 204, 217, 240, 163, 173, 221, 142, 120, 198, 121, 65, 171, 93, 35, 132, 67, 0, 90, 50,
+		255, 255, 229, 247, 252, 185, 217, 240, 163, 173, 221, 142, 120, 198, 121, 65, 171, 93, 35, 132, 67, 0, 90, 50,
+		255, 255, 229, 247, 252, 185, 217, 240, 163, 173, 221, 142, 120, 198, 121, 65, 171, 93, 35, 132, 67, 0, 104, 55, 0, 69, 41,
+		// Reds
+		254, 224, 210, 252, 146, 114, 222, 45, 38,
+		254, 229, 217, 252, 174, 145, 251, 106, 74, 203, 24, 29,
+		254, 229, 217, 252, 174, 145, 251, 106, 74, 222, 45, 38, 165, 15, 21,
+		254, 229, 217, 252, 187, 161, 252, 146, 114, 251, 106, 74, 222, 45, 38, 165, 15, 21,
+		254, 229, 217, 252, 187, 161, 252, 146, 114, 251, 106, 74, 239, 59, 44, 203, 24, 29, 153, 0, 13,
+		255, 245, 240, 254, 224, 210, 252, 187, 161, 252, 146, 114, 251, 106, 74, 239, 59, 44, 203, 24, 29, 153, 0, 13,
+		255, 245, 240, 254, 224, 210, 252, 187, 161, 252, 146, 114, 251, 106, 74, 239, 59, 44, 203, 24, 29, 165, 15, 21, 103, 0, 13,
+		// RdPu
+		253, 224, 221, 250, 159, 181, 197, 27, 138,
+		254, 235, 226, 251, 180, 185, 247, 104, 161, 174, 1, 126,
+		254, 235, 226, 251, 180, 185, 247, 104, 161, 197, 27, 138, 122, 1, 119,
+		254, 235, 226, 252, 197, 192, 250, 159, 181, 247, 104, 161, 197, 27, 138, 122, 1, 119,
+		254, 235, 226, 252, 197, 192, 250, 159, 181, 247, 104, 161, 221, 52, 151, 174, 1, 126, 122, 1, 119,
+		255, 247, 243, 253, 224, 221, 252, 197, 192, 250, 159, 181, 247, 104, 161, 221, 52, 151, 174, 1, 126, 122, 1, 119,
+		255, 247, 243, 253, 224, 221, 252, 197, 192, 250, 159, 181, 247, 104, 161, 221, 52, 151, 174, 1, 126, 122, 1, 119, 73, 0, 106,
+		// Greens
+		229, 245, 224, 161, 217, 155, 49, 163, 84,
+		237, 248, 233, 186, 228, 179, 116, 196, 118, 35, 139, 69,
+		237, 248, 233, 186, 228, 179, 116, 196, 118, 49, 163, 84, 0, 109, 44,
+		237, 248, 233, 199, 233, 192, 161, 217, 155, 116, 196, 118, 49, 163, 84, 0, 109, 44,
+		237, 248, 233, 199, 233, 192, 161, 217, 155, 116, 196, 118, 65, 171, 93, 35, 139, 69, 0, 90, 50,
+		247, 252, 245, 229, 245, 224, 199, 233, 192, 161, 217, 155, 116, 196, 118, 65, 171, 93, 35, 139, 69, 0, 90, 50,
+		247, 252, 245, 229, 245, 224, 199, 233, 192, 161, 217, 155, 116, 196, 118, 65, 171, 93, 35, 139, 69, 0, 109, 44, 0, 68, 27,
+		// YlGnBu
+		237, 248, 177, 127, 205, 187, 44, 127, 184,
+		255, 255, 204, 161, 218, 180, 65, 182, 196, 34, 94, 168,
+		255, 255, 204, 161, 218, 180, 65, 182, 196, 44, 127, 184, 37, 52, 148,
+		255, 255, 204, 199, 233, 180, 127, 205, 187, 65, 182, 196, 44, 127, 184, 37, 52, 148,
+		255, 255, 204, 199, 233, 180, 127, 205, 187, 65, 182, 196, 29, 145, 192, 34, 94, 168, 12, 44, 132,
+		255, 255, 217, 237, 248, 177, 199, 233, 180, 127, 205, 187, 65, 182, 196, 29, 145, 192, 34, 94, 168, 12, 44, 132,
+		255, 255, 217, 237, 248, 177, 199, 233, 180, 127, 205, 187, 65, 182, 196, 29, 145, 192, 34, 94, 168, 37, 52, 148, 8, 29, 88,
+		// Purples
+		239, 237, 245, 188, 189, 220, 117, 107, 177,
+		242, 240, 247, 203, 201, 226, 158, 154, 200, 106, 81, 163,
+		242, 240, 247, 203, 201, 226, 158, 154, 200, 117, 107, 177, 84, 39, 143,
+		242, 240, 247, 218, 218, 235, 188, 189, 220, 158, 154, 200, 117, 107, 177, 84, 39, 143,
+		242, 240, 247, 218, 218, 235, 188, 189, 220, 158, 154, 200, 128, 125, 186, 106, 81, 163, 74, 20, 134,
+		252, 251, 253, 239, 237, 245, 218, 218, 235, 188, 189, 220, 158, 154, 200, 128, 125, 186, 106, 81, 163, 74, 20, 134,
+		252, 251, 253, 239, 237, 245, 218, 218, 235, 188, 189, 220, 158, 154, 200, 128, 125, 186, 106, 81, 163, 84, 39, 143, 63, 0, 125,
+		// GnBu
+		224, 243, 219, 168, 221, 181, 67, 162, 202,
+		240, 249, 232, 186, 228, 188, 123, 204, 196, 43, 140, 190,
+		240, 249, 232, 186, 228, 188, 123, 204, 196, 67, 162, 202, 8, 104, 172,
+		240, 249, 232, 204, 235, 197, 168, 221, 181, 123, 204, 196, 67, 162, 202, 8, 104, 172,
+		240, 249, 232, 204, 235, 197, 168, 221, 181, 123, 204, 196, 78, 179, 211, 43, 140, 190, 8, 88, 158,
+		247, 252, 240, 224, 243, 219, 204, 235, 197, 168, 221, 181, 123, 204, 196, 78, 179, 211, 43, 140, 190, 8, 88, 158,
+		247, 252, 240, 224, 243, 219, 204, 235, 197, 168, 221, 181, 123, 204, 196, 78, 179, 211, 43, 140, 190, 8, 104, 172, 8, 64, 129,
+		// Greys
+		240, 240, 240, 189, 189, 189, 99, 99, 99,
+		247, 247, 247, 204, 204, 204, 150, 150, 150, 82, 82, 82,
+		247, 247, 247, 204, 204, 204, 150, 150, 150, 99, 99, 99, 37, 37, 37,
+		247, 247, 247, 217, 217, 217, 189, 189, 189, 150, 150, 150, 99, 99, 99, 37, 37, 37,
+		247, 247, 247, 217, 217, 217, 189, 189, 189, 150, 150, 150, 115, 115, 115, 82, 82, 82, 37, 37, 37,
+		255, 255, 255, 240, 240, 240, 217, 217, 217, 189, 189, 189, 150, 150, 150, 115, 115, 115, 82, 82, 82, 37, 37, 37,
+		255, 255, 255, 240, 240, 240, 217, 217, 217, 189, 189, 189, 150, 150, 150, 115, 115, 115, 82, 82, 82, 37, 37, 37, 0, 0, 0,
+		// YlOrRd
+		255, 237, 160, 254, 178, 76, 240, 59, 32,
+		255, 255, 178, 254, 204, 92, 253, 141, 60, 227, 26, 28,
+		255, 255, 178, 254, 204, 92, 253, 141, 60, 240, 59, 32, 189, 0, 38,
+		255, 255, 178, 254, 217, 118, 254, 178, 76, 253, 141, 60, 240, 59, 32, 189, 0, 38,
+		255, 255, 178, 254, 217, 118, 254, 178, 76, 253, 141, 60, 252, 78, 42, 227, 26, 28, 177, 0, 38,
+		255, 255, 204, 255, 237, 160, 254, 217, 118, 254, 178, 76, 253, 141, 60, 252, 78, 42, 227, 26, 28, 177, 0, 38,
+		255, 255, 204, 255, 237, 160, 254, 217, 118, 254, 178, 76, 253, 141, 60, 252, 78, 42, 227, 26, 28, 189, 0, 38, 128, 0, 38,
+		// PuRd
+		231, 225, 239, 201, 148, 199, 221, 28, 119,
+		241, 238, 246, 215, 181, 216, 223, 101, 176, 206, 18, 86,
+		241, 238, 246, 215, 181, 216, 223, 101, 176, 221, 28, 119, 152, 0, 67,
+		241, 238, 246, 212, 185, 218, 201, 148, 199, 223, 101, 176, 221, 28, 119, 152, 0, 67,
+		241, 238, 246, 212, 185, 218, 201, 148, 199, 223, 101, 176, 231, 41, 138, 206, 18, 86, 145, 0, 63,
+		247, 244, 249, 231, 225, 239, 212, 185, 218, 201, 148, 199, 223, 101, 176, 231, 41, 138, 206, 18, 86, 145, 0, 63,
+		247, 244, 249, 231, 225, 239, 212, 185, 218, 201, 148, 199, 223, 101, 176, 231, 41, 138, 206, 18, 86, 152, 0, 67, 103, 0, 31,
+		// Blues
+		222, 235, 247, 158, 202, 225, 49, 130, 189,
+		239, 243, 255, 189, 215, 231, 107, 174, 214, 33, 113, 181,
+		239, 243, 255, 189, 215, 231, 107, 174, 214, 49, 130, 189, 8, 81, 156,
+		239, 243, 255, 198, 219, 239, 158, 202, 225, 107, 174, 214, 49, 130, 189, 8, 81, 156,
+		239, 243, 255, 198, 219, 239, 158, 202, 225, 107, 174, 214, 66, 146, 198, 33, 113, 181, 8, 69, 148,
+		247, 251, 255, 222, 235, 247, 198, 219, 239, 158, 202, 225, 107, 174, 214, 66, 146, 198, 33, 113, 181, 8, 69, 148,
+		247, 251, 255, 222, 235, 247, 198, 219, 239, 158, 202, 225, 107, 174, 214, 66, 146, 198, 33, 113, 181, 8, 81, 156, 8, 48, 107,
+		// PuBuGn
+		236, 226, 240, 166, 189, 219, 28, 144, 153,
+		246, 239, 247, 189, 201, 225, 103, 169, 207, 2, 129, 138,
+		246, 239, 247, 189, 201, 225, 103, 169, 207, 28, 144, 153, 1, 108, 89,
+		246, 239, 247, 208, 209, 230, 166, 189, 219, 103, 169, 207, 28, 144, 153, 1, 108, 89,
+		246, 239, 247, 208, 209, 230, 166, 189, 219, 103, 169, 207, 54, 144, 192, 2, 129, 138, 1, 100, 80,
+		255, 247, 251, 236, 226, 240, 208, 209, 230, 166, 189, 219, 103, 169, 207, 54, 144, 192, 2, 129, 138, 1, 100, 80,
+		255, 247, 251, 236, 226, 240, 208, 209, 230, 166, 189, 219, 103, 169, 207, 54, 144, 192, 2, 129, 138, 1, 108, 89, 1, 70, 54
+	};
+
+
+	constexpr float labTable[5067] =
+	{
+		// diverging
+		// Spectral
+		69.80443f, 37.716938f, 45.68794f, 98.64751f, -9.810117f, 30.691656f, 79.89603f, -31.67823f, 26.165016f,
+		45.949047f, 67.97308f, 49.71343f, 77.29438f, 21.492779f, 50.47224f, 83.46855f, -26.872784f, 22.871262f, 52.16265f, -6.8215795f, -36.173138f,
+		45.949047f, 67.97308f, 49.71343f, 77.29438f, 21.492779f, 50.47224f, 98.64751f, -9.810117f, 30.691656f, 83.46855f, -26.872784f, 22.871262f, 52.16265f, -6.8215795f, -36.173138f,
+		49.689983f, 59.457016f, 25.20892f, 69.80443f, 37.716938f, 45.68794f, 89.97494f, -0.5922152f, 45.274536f, 93.62198f, -18.934504f, 43.1248f, 79.89603f, -31.67823f, 26.165016f, 53.98277f, -7.759176f, -35.02214f,
+		49.689983f, 59.457016f, 25.20892f, 69.80443f, 37.716938f, 45.68794f, 89.97494f, -0.5922152f, 45.274536f, 98.64751f, -9.810117f, 30.691656f, 93.62198f, -18.934504f, 43.1248f, 79.89603f, -31.67823f, 26.165016f, 53.98277f, -7.759176f, -35.02214f,
+		49.689983f, 59.457016f, 25.20892f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 93.62198f, -18.934504f, 43.1248f, 83.46855f, -26.872784f, 22.871262f, 72.31024f, -34.414055f, 6.160233f, 53.98277f, -7.759176f, -35.02214f,
+		49.689983f, 59.457016f, 25.20892f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 98.64751f, -9.810117f, 30.691656f, 93.62198f, -18.934504f, 43.1248f, 83.46855f, -26.872784f, 22.871262f, 72.31024f, -34.414055f, 6.160233f, 53.98277f, -7.759176f, -35.02214f,
+		33.32129f, 58.18702f, 9.603476f, 49.689983f, 59.457016f, 25.20892f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 93.62198f, -18.934504f, 43.1248f, 83.46855f, -26.872784f, 22.871262f, 72.31024f, -34.414055f, 6.160233f, 53.98277f, -7.759176f, -35.02214f, 38.863575f, 27.148237f, -43.03939f,
+		33.32129f, 58.18702f, 9.603476f, 49.689983f, 59.457016f, 25.20892f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 98.64751f, -9.810117f, 30.691656f, 93.62198f, -18.934504f, 43.1248f, 83.46855f, -26.872784f, 22.871262f, 72.31024f, -34.414055f, 6.160233f, 53.98277f, -7.759176f, -35.02214f, 38.863575f, 27.148237f, -43.03939f,
+		// RdYlGn
+		69.80443f, 37.716938f, 45.68794f, 98.64751f, -9.810117f, 30.691656f, 76.9741f, -38.6504f, 48.341736f,
+		45.949047f, 67.97308f, 49.71343f, 77.29438f, 21.492779f, 50.47224f, 81.166336f, -34.567875f, 48.929737f, 54.461906f, -50.908794f, 35.41463f,
+		45.949047f, 67.97308f, 49.71343f, 77.29438f, 21.492779f, 50.47224f, 98.64751f, -9.810117f, 30.691656f, 81.166336f, -34.567875f, 48.929737f, 54.461906f, -50.908794f, 35.41463f,
+		47.89537f, 62.932423f, 46.00776f, 69.80443f, 37.716938f, 45.68794f, 89.97494f, -0.5922152f, 45.274536f, 90.938965f, -22.37422f, 45.87032f, 76.9741f, -38.6504f, 48.341736f, 55.332645f, -49.18749f, 28.762714f,
+		47.89537f, 62.932423f, 46.00776f, 69.80443f, 37.716938f, 45.68794f, 89.97494f, -0.5922152f, 45.274536f, 98.64751f, -9.810117f, 30.691656f, 90.938965f, -22.37422f, 45.87032f, 76.9741f, -38.6504f, 48.341736f, 55.332645f, -49.18749f, 28.762714f,
+		47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 90.938965f, -22.37422f, 45.87032f, 81.166336f, -34.567875f, 48.929737f, 69.55424f, -44.493343f, 37.377815f, 55.332645f, -49.18749f, 28.762714f,
+		47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 98.64751f, -9.810117f, 30.691656f, 90.938965f, -22.37422f, 45.87032f, 81.166336f, -34.567875f, 48.929737f, 69.55424f, -44.493343f, 37.377815f, 55.332645f, -49.18749f, 28.762714f,
+		34.276817f, 58.61068f, 29.318445f, 47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 90.938965f, -22.37422f, 45.87032f, 81.166336f, -34.567875f, 48.929737f, 69.55424f, -44.493343f, 37.377815f, 55.332645f, -49.18749f, 28.762714f, 38.155952f, -38.416523f, 20.437172f,
+		34.276817f, 58.61068f, 29.318445f, 47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 89.97494f, -0.5922152f, 45.274536f, 98.64751f, -9.810117f, 30.691656f, 90.938965f, -22.37422f, 45.87032f, 81.166336f, -34.567875f, 48.929737f, 69.55424f, -44.493343f, 37.377815f, 55.332645f, -49.18749f, 28.762714f, 38.155952f, -38.416523f, 20.437172f,
+		// RdBu
+		67.5867f, 34.800446f, 37.908695f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 66.33769f, -10.582527f, -25.822166f,
+		42.254253f, 67.63646f, 43.483974f, 74.67287f, 25.307917f, 29.991928f, 76.86944f, -10.598988f, -17.777832f, 45.600273f, -2.716633f, -40.787315f,
+		42.254253f, 67.63646f, 43.483974f, 74.67287f, 25.307917f, 29.991928f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 76.86944f, -10.598988f, -17.777832f, 45.600273f, -2.716633f, -40.787315f,
+		38.368176f, 58.648296f, 31.600954f, 67.5867f, 34.800446f, 37.908695f, 89.70663f, 8.752659f, 14.182383f, 89.80542f, -4.442202f, -7.5936007f, 66.33769f, -10.582527f, -25.822166f, 42.465023f, 4.4307346f, -43.406776f,
+		38.368176f, 58.648296f, 31.600954f, 67.5867f, 34.800446f, 37.908695f, 89.70663f, 8.752659f, 14.182383f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 89.80542f, -4.442202f, -7.5936007f, 66.33769f, -10.582527f, -25.822166f, 42.465023f, 4.4307346f, -43.406776f,
+		38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 89.80542f, -4.442202f, -7.5936007f, 76.86944f, -10.598988f, -17.777832f, 58.035633f, -9.381038f, -32.063404f, 42.465023f, 4.4307346f, -43.406776f,
+		38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 89.80542f, -4.442202f, -7.5936007f, 76.86944f, -10.598988f, -17.777832f, 58.035633f, -9.381038f, -32.063404f, 42.465023f, 4.4307346f, -43.406776f,
+		19.977488f, 42.24223f, 13.409475f, 38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 89.80542f, -4.442202f, -7.5936007f, 76.86944f, -10.598988f, -17.777832f, 58.035633f, -9.381038f, -32.063404f, 42.465023f, 4.4307346f, -43.406776f, 20.079138f, 7.212168f, -32.918766f,
+		19.977488f, 42.24223f, 13.409475f, 38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 89.80542f, -4.442202f, -7.5936007f, 76.86944f, -10.598988f, -17.777832f, 58.035633f, -9.381038f, -32.063404f, 42.465023f, 4.4307346f, -43.406776f, 20.079138f, 7.212168f, -32.918766f,
+		// PiYG
+		74.65925f, 31.475344f, -8.966265f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 80.301796f, -35.47067f, 47.821682f,
+		47.116364f, 72.45247f, -15.088247f, 80.303764f, 26.894842f, -9.722739f, 84.87451f, -28.517166f, 40.183666f, 62.693996f, -51.20624f, 55.932426f,
+		47.116364f, 72.45247f, -15.088247f, 80.303764f, 26.894842f, -9.722739f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 84.87451f, -28.517166f, 40.183666f, 62.693996f, -51.20624f, 55.932426f,
+		44.430702f, 68.698654f, -10.807586f, 74.65925f, 31.475344f, -8.966265f, 91.87628f, 12.434505f, -3.636839f, 94.60306f, -11.297137f, 16.16699f, 80.301796f, -35.47067f, 47.821682f, 54.28545f, -41.348217f, 49.491287f,
+		44.430702f, 68.698654f, -10.807586f, 74.65925f, 31.475344f, -8.966265f, 91.87628f, 12.434505f, -3.636839f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 94.60306f, -11.297137f, 16.16699f, 80.301796f, -35.47067f, 47.821682f, 54.28545f, -41.348217f, 49.491287f,
+		44.430702f, 68.698654f, -10.807586f, 63.16282f, 46.6285f, -11.190063f, 80.303764f, 26.894842f, -9.722739f, 91.87628f, 12.434505f, -3.636839f, 94.60306f, -11.297137f, 16.16699f, 84.87451f, -28.517166f, 40.183666f, 70.07711f, -39.564075f, 54.06874f, 54.28545f, -41.348217f, 49.491287f,
+		44.430702f, 68.698654f, -10.807586f, 63.16282f, 46.6285f, -11.190063f, 80.303764f, 26.894842f, -9.722739f, 91.87628f, 12.434505f, -3.636839f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 94.60306f, -11.297137f, 16.16699f, 84.87451f, -28.517166f, 40.183666f, 70.07711f, -39.564075f, 54.06874f, 54.28545f, -41.348217f, 49.491287f,
+		30.359962f, 55.724815f, -5.6963444f, 44.430702f, 68.698654f, -10.807586f, 63.16282f, 46.6285f, -11.190063f, 80.303764f, 26.894842f, -9.722739f, 91.87628f, 12.434505f, -3.636839f, 94.60306f, -11.297137f, 16.16699f, 84.87451f, -28.517166f, 40.183666f, 70.07711f, -39.564075f, 54.06874f, 54.28545f, -41.348217f, 49.491287f, 37.14309f, -34.86384f, 34.918133f,
+		30.359962f, 55.724815f, -5.6963444f, 44.430702f, 68.698654f, -10.807586f, 63.16282f, 46.6285f, -11.190063f, 80.303764f, 26.894842f, -9.722739f, 91.87628f, 12.434505f, -3.636839f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 94.60306f, -11.297137f, 16.16699f, 84.87451f, -28.517166f, 40.183666f, 70.07711f, -39.564075f, 54.06874f, 54.28545f, -41.348217f, 49.491287f, 37.14309f, -34.86384f, 34.918133f,
+		// PRGn
+		63.42902f, 22.889595f, -23.164213f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 71.69203f, -33.96809f, 28.006163f,
+		35.263565f, 47.140793f, -40.153748f, 71.47697f, 18.230835f, -17.426832f, 82.5433f, -28.247082f, 23.639053f, 49.35375f, -49.713654f, 34.253414f,
+		35.263565f, 47.140793f, -40.153748f, 71.47697f, 18.230835f, -17.426832f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 82.5433f, -28.247082f, 23.639053f, 49.35375f, -49.713654f, 34.253414f,
+		32.138832f, 46.063484f, -34.706852f, 63.42902f, 22.889595f, -23.164213f, 86.94914f, 10.058807f, -7.4309583f, 92.47515f, -12.763756f, 11.477834f, 71.69203f, -33.96809f, 28.006163f, 44.14802f, -41.445602f, 28.062141f,
+		32.138832f, 46.063484f, -34.706852f, 63.42902f, 22.889595f, -23.164213f, 86.94914f, 10.058807f, -7.4309583f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 92.47515f, -12.763756f, 11.477834f, 71.69203f, -33.96809f, 28.006163f, 44.14802f, -41.445602f, 28.062141f,
+		32.138832f, 46.063484f, -34.706852f, 53.277847f, 27.126953f, -25.268795f, 71.47697f, 18.230835f, -17.426832f, 86.94914f, 10.058807f, -7.4309583f, 92.47515f, -12.763756f, 11.477834f, 82.5433f, -28.247082f, 23.639053f, 64.40893f, -41.896233f, 31.787798f, 44.14802f, -41.445602f, 28.062141f,
+		32.138832f, 46.063484f, -34.706852f, 53.277847f, 27.126953f, -25.268795f, 71.47697f, 18.230835f, -17.426832f, 86.94914f, 10.058807f, -7.4309583f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 92.47515f, -12.763756f, 11.477834f, 82.5433f, -28.247082f, 23.639053f, 64.40893f, -41.896233f, 31.787798f, 44.14802f, -41.445602f, 28.062141f,
+		13.21912f, 38.54669f, -28.915539f, 32.138832f, 46.063484f, -34.706852f, 53.277847f, 27.126953f, -25.268795f, 71.47697f, 18.230835f, -17.426832f, 86.94914f, 10.058807f, -7.4309583f, 92.47515f, -12.763756f, 11.477834f, 82.5433f, -28.247082f, 23.639053f, 64.40893f, -41.896233f, 31.787798f, 44.14802f, -41.445602f, 28.062141f, 24.363699f, -30.102606f, 19.307764f,
+		13.21912f, 38.54669f, -28.915539f, 32.138832f, 46.063484f, -34.706852f, 53.277847f, 27.126953f, -25.268795f, 71.47697f, 18.230835f, -17.426832f, 86.94914f, 10.058807f, -7.4309583f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 92.47515f, -12.763756f, 11.477834f, 82.5433f, -28.247082f, 23.639053f, 64.40893f, -41.896233f, 31.787798f, 44.14802f, -41.445602f, 28.062141f, 24.363699f, -30.102606f, 19.307764f,
+		// RdYlBu
+		69.80443f, 37.716938f, 45.68794f, 98.64751f, -9.810117f, 30.691656f, 75.072525f, -8.449612f, -18.878584f,
+		45.949047f, 67.97308f, 49.71343f, 77.29438f, 21.492779f, 50.47224f, 84.051315f, -11.314746f, -12.724416f, 49.589195f, -3.4400933f, -37.918785f,
+		45.949047f, 67.97308f, 49.71343f, 77.29438f, 21.492779f, 50.47224f, 98.64751f, -9.810117f, 30.691656f, 84.051315f, -11.314746f, -12.724416f, 49.589195f, -3.4400933f, -37.918785f,
+		47.89537f, 62.932423f, 46.00776f, 69.80443f, 37.716938f, 45.68794f, 90.04414f, -0.10468525f, 42.88801f, 94.6213f, -5.2612185f, -4.536335f, 75.072525f, -8.449612f, -18.878584f, 48.61281f, 3.489866f, -38.2421f,
+		47.89537f, 62.932423f, 46.00776f, 69.80443f, 37.716938f, 45.68794f, 90.04414f, -0.10468525f, 42.88801f, 98.64751f, -9.810117f, 30.691656f, 94.6213f, -5.2612185f, -4.536335f, 75.072525f, -8.449612f, -18.878584f, 48.61281f, 3.489866f, -38.2421f,
+		47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 90.04414f, -0.10468525f, 42.88801f, 94.6213f, -5.2612185f, -4.536335f, 84.051315f, -11.314746f, -12.724416f, 68.1687f, -9.079843f, -24.065657f, 48.61281f, 3.489866f, -38.2421f,
+		47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 90.04414f, -0.10468525f, 42.88801f, 98.64751f, -9.810117f, 30.691656f, 94.6213f, -5.2612185f, -4.536335f, 84.051315f, -11.314746f, -12.724416f, 68.1687f, -9.079843f, -24.065657f, 48.61281f, 3.489866f, -38.2421f,
+		34.276817f, 58.61068f, 29.318445f, 47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 90.04414f, -0.10468525f, 42.88801f, 94.6213f, -5.2612185f, -4.536335f, 84.051315f, -11.314746f, -12.724416f, 68.1687f, -9.079843f, -24.065657f, 48.61281f, 3.489866f, -38.2421f, 28.008451f, 29.511429f, -52.89134f,
+		34.276817f, 58.61068f, 29.318445f, 47.89537f, 62.932423f, 46.00776f, 62.15262f, 49.32137f, 47.92987f, 77.29438f, 21.492779f, 50.47224f, 90.04414f, -0.10468525f, 42.88801f, 98.64751f, -9.810117f, 30.691656f, 94.6213f, -5.2612185f, -4.536335f, 84.051315f, -11.314746f, -12.724416f, 68.1687f, -9.079843f, -24.065657f, 48.61281f, 3.489866f, -38.2421f, 28.008451f, 29.511429f, -52.89134f,
+		// BrBG
+		74.686745f, 3.9066706f, 44.462055f, 96.53749f, -1.6169179e-05f, 6.4676715e-06f, 67.86723f, -28.879261f, -4.201825f,
+		47.92202f, 22.80222f, 48.854378f, 79.47389f, 1.1190647f, 38.425808f, 77.34025f, -26.527573f, -1.5398827f, 49.462414f, -35.735863f, 2.1155522f,
+		47.92202f, 22.80222f, 48.854378f, 79.47389f, 1.1190647f, 38.425808f, 96.53749f, -1.6169179e-05f, 6.4676715e-06f, 77.34025f, -26.527573f, -1.5398827f, 49.462414f, -35.735863f, 2.1155522f,
+		40.38354f, 19.84928f, 46.489544f, 74.686745f, 3.9066706f, 44.462055f, 92.2418f, -1.0306736f, 19.737492f, 90.15712f, -12.330347f, -1.392829f, 67.86723f, -28.879261f, -4.201825f, 38.404465f, -27.104643f, -2.6743016f,
+		40.38354f, 19.84928f, 46.489544f, 74.686745f, 3.9066706f, 44.462055f, 92.2418f, -1.0306736f, 19.737492f, 96.53749f, -1.6169179e-05f, 6.4676715e-06f, 90.15712f, -12.330347f, -1.392829f, 67.86723f, -28.879261f, -4.201825f, 38.404465f, -27.104643f, -2.6743016f,
+		40.38354f, 19.84928f, 46.489544f, 58.945644f, 16.67833f, 52.61527f, 79.47389f, 1.1190647f, 38.425808f, 92.2418f, -1.0306736f, 19.737492f, 90.15712f, -12.330347f, -1.392829f, 77.34025f, -26.527573f, -1.5398827f, 56.94987f, -30.04249f, -4.1636934f, 38.404465f, -27.104643f, -2.6743016f,
+		40.38354f, 19.84928f, 46.489544f, 58.945644f, 16.67833f, 52.61527f, 79.47389f, 1.1190647f, 38.425808f, 92.2418f, -1.0306736f, 19.737492f, 96.53749f, -1.6169179e-05f, 6.4676715e-06f, 90.15712f, -12.330347f, -1.392829f, 77.34025f, -26.527573f, -1.5398827f, 56.94987f, -30.04249f, -4.1636934f, 38.404465f, -27.104643f, -2.6743016f,
+		23.705072f, 12.911256f, 31.317207f, 40.38354f, 19.84928f, 46.489544f, 58.945644f, 16.67833f, 52.61527f, 79.47389f, 1.1190647f, 38.425808f, 92.2418f, -1.0306736f, 19.737492f, 90.15712f, -12.330347f, -1.392829f, 77.34025f, -26.527573f, -1.5398827f, 56.94987f, -30.04249f, -4.1636934f, 38.404465f, -27.104643f, -2.6743016f, 21.743935f, -21.303122f, 2.4222908f,
+		23.705072f, 12.911256f, 31.317207f, 40.38354f, 19.84928f, 46.489544f, 58.945644f, 16.67833f, 52.61527f, 79.47389f, 1.1190647f, 38.425808f, 92.2418f, -1.0306736f, 19.737492f, 96.53749f, -1.6169179e-05f, 6.4676715e-06f, 90.15712f, -12.330347f, -1.392829f, 77.34025f, -26.527573f, -1.5398827f, 56.94987f, -30.04249f, -4.1636934f, 38.404465f, -27.104643f, -2.6743016f, 21.743935f, -21.303122f, 2.4222908f,
+		// RdGy
+		67.5867f, 34.800446f, 37.908695f, 100.00001f, -1.6666667e-05f, 6.6666666e-06f, 63.2226f, -1.1382556e-05f, 4.5530223e-06f,
+		42.254253f, 67.63646f, 43.483974f, 74.67287f, 25.307917f, 29.991928f, 75.51479f, -1.3148677e-05f, 5.2594705e-06f, 27.093414f, -6.191582e-06f, 2.476633e-06f,
+		42.254253f, 67.63646f, 43.483974f, 74.67287f, 25.307917f, 29.991928f, 100.00001f, -1.6666667e-05f, 6.6666666e-06f, 75.51479f, -1.3148677e-05f, 5.2594705e-06f, 27.093414f, -6.191582e-06f, 2.476633e-06f,
+		38.368176f, 58.648296f, 31.600954f, 67.5867f, 34.800446f, 37.908695f, 89.70663f, 8.752659f, 14.182383f, 89.177284f, -1.5111677e-05f, 6.044671e-06f, 63.2226f, -1.1382556e-05f, 4.5530223e-06f, 32.74751f, -7.0039523e-06f, 2.8015809e-06f,
+		38.368176f, 58.648296f, 31.600954f, 67.5867f, 34.800446f, 37.908695f, 89.70663f, 8.752659f, 14.182383f, 100.00001f, -1.6666667e-05f, 6.6666666e-06f, 89.177284f, -1.5111677e-05f, 6.044671e-06f, 63.2226f, -1.1382556e-05f, 4.5530223e-06f, 32.74751f, -7.0039523e-06f, 2.8015809e-06f,
+		38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 89.177284f, -1.5111677e-05f, 6.044671e-06f, 75.51479f, -1.3148677e-05f, 5.2594705e-06f, 56.315468f, -1.0390153e-05f, 4.156061e-06f, 32.74751f, -7.0039523e-06f, 2.8015809e-06f,
+		38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 100.00001f, -1.6666667e-05f, 6.6666666e-06f, 89.177284f, -1.5111677e-05f, 6.044671e-06f, 75.51479f, -1.3148677e-05f, 5.2594705e-06f, 56.315468f, -1.0390153e-05f, 4.156061e-06f, 32.74751f, -7.0039523e-06f, 2.8015809e-06f,
+		19.977488f, 42.24223f, 13.409475f, 38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 89.177284f, -1.5111677e-05f, 6.044671e-06f, 75.51479f, -1.3148677e-05f, 5.2594705e-06f, 56.315468f, -1.0390153e-05f, 4.156061e-06f, 32.74751f, -7.0039523e-06f, 2.8015809e-06f, 9.263235f, -3.629775e-06f, 1.45191e-06f,
+		19.977488f, 42.24223f, 13.409475f, 38.368176f, 58.648296f, 31.600954f, 55.27966f, 45.09177f, 33.42862f, 74.67287f, 25.307917f, 29.991928f, 89.70663f, 8.752659f, 14.182383f, 100.00001f, -1.6666667e-05f, 6.6666666e-06f, 89.177284f, -1.5111677e-05f, 6.044671e-06f, 75.51479f, -1.3148677e-05f, 5.2594705e-06f, 56.315468f, -1.0390153e-05f, 4.156061e-06f, 32.74751f, -7.0039523e-06f, 2.8015809e-06f, 9.263235f, -3.629775e-06f, 1.45191e-06f,
+		// PuOr
+		73.06923f, 20.519213f, 60.594128f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 61.704323f, 15.27078f, -25.9814f,
+		57.44359f, 48.24376f, 66.331085f, 79.65309f, 16.391909f, 52.24433f, 71.72002f, 10.300822f, -18.836626f, 33.797073f, 36.05255f, -45.752747f,
+		57.44359f, 48.24376f, 66.331085f, 79.65309f, 16.391909f, 52.24433f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 71.72002f, 10.300822f, -18.836626f, 33.797073f, 36.05255f, -45.752747f,
+		47.725285f, 32.85251f, 55.333733f, 73.06923f, 20.519213f, 60.594128f, 90.6712f, 4.237914f, 24.389486f, 87.35828f, 2.519015f, -8.537703f, 61.704323f, 15.27078f, -25.9814f, 27.055325f, 40.82253f, -46.259773f,
+		47.725285f, 32.85251f, 55.333733f, 73.06923f, 20.519213f, 60.594128f, 90.6712f, 4.237914f, 24.389486f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 87.35828f, 2.519015f, -8.537703f, 61.704323f, 15.27078f, -25.9814f, 27.055325f, 40.82253f, -46.259773f,
+		47.725285f, 32.85251f, 55.333733f, 63.23315f, 29.555935f, 66.12109f, 79.65309f, 16.391909f, 52.24433f, 90.6712f, 4.237914f, 24.389486f, 87.35828f, 2.519015f, -8.537703f, 71.72002f, 10.300822f, -18.836626f, 51.643257f, 17.634258f, -28.573715f, 27.055325f, 40.82253f, -46.259773f,
+		47.725285f, 32.85251f, 55.333733f, 63.23315f, 29.555935f, 66.12109f, 79.65309f, 16.391909f, 52.24433f, 90.6712f, 4.237914f, 24.389486f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 87.35828f, 2.519015f, -8.537703f, 71.72002f, 10.300822f, -18.836626f, 51.643257f, 17.634258f, -28.573715f, 27.055325f, 40.82253f, -46.259773f,
+		33.261986f, 26.515455f, 40.8968f, 47.725285f, 32.85251f, 55.333733f, 63.23315f, 29.555935f, 66.12109f, 79.65309f, 16.391909f, 52.24433f, 90.6712f, 4.237914f, 24.389486f, 87.35828f, 2.519015f, -8.537703f, 71.72002f, 10.300822f, -18.836626f, 51.643257f, 17.634258f, -28.573715f, 27.055325f, 40.82253f, -46.259773f, 9.528814f, 35.663242f, -35.0892f,
+		33.261986f, 26.515455f, 40.8968f, 47.725285f, 32.85251f, 55.333733f, 63.23315f, 29.555935f, 66.12109f, 79.65309f, 16.391909f, 52.24433f, 90.6712f, 4.237914f, 24.389486f, 97.2321f, -1.626898e-05f, 6.507592e-06f, 87.35828f, 2.519015f, -8.537703f, 71.72002f, 10.300822f, -18.836626f, 51.643257f, 17.634258f, -28.573715f, 27.055325f, 40.82253f, -46.259773f, 9.528814f, 35.663242f, -35.0892f,
+
+		// qualitative
+		// Set2
+		72.31024f, -34.414055f, 6.160233f, 69.91772f, 38.284954f, 41.154533f, 65.83802f, 3.3366241f, -24.185339f,
+		72.31024f, -34.414055f, 6.160233f, 69.91772f, 38.284954f, 41.154533f, 65.83802f, 3.3366241f, -24.185339f, 68.83034f, 43.013504f, -14.394973f,
+		72.31024f, -34.414055f, 6.160233f, 69.91772f, 38.284954f, 41.154533f, 65.83802f, 3.3366241f, -24.185339f, 68.83034f, 43.013504f, -14.394973f, 80.65983f, -36.156357f, 58.232777f,
+		72.31024f, -34.414055f, 6.160233f, 69.91772f, 38.284954f, 41.154533f, 65.83802f, 3.3366241f, -24.185339f, 68.83034f, 43.013504f, -14.394973f, 80.65983f, -36.156357f, 58.232777f, 87.53107f, -2.2206614f, 80.2598f,
+		72.31024f, -34.414055f, 6.160233f, 69.91772f, 38.284954f, 41.154533f, 65.83802f, 3.3366241f, -24.185339f, 68.83034f, 43.013504f, -14.394973f, 80.65983f, -36.156357f, 58.232777f, 87.53107f, -2.2206614f, 80.2598f, 80.89328f, 4.986312f, 28.458746f,
+		72.31024f, -34.414055f, 6.160233f, 69.91772f, 38.284954f, 41.154533f, 65.83802f, 3.3366241f, -24.185339f, 68.83034f, 43.013504f, -14.394973f, 80.65983f, -36.156357f, 58.232777f, 87.53107f, -2.2206614f, 80.2598f, 80.89328f, 4.986312f, 28.458746f, 72.94361f, -1.2779253e-05f, 5.1117013e-06f,
+		// Accent
+		74.708626f, -37.90936f, 29.910757f, 73.527885f, 12.973671f, -17.102194f, 82.00488f, 15.041012f, 37.632988f,
+		74.708626f, -37.90936f, 29.910757f, 73.527885f, 12.973671f, -17.102194f, 82.00488f, 15.041012f, 37.632988f, 98.06617f, -14.228693f, 48.663326f,
+		74.708626f, -37.90936f, 29.910757f, 73.527885f, 12.973671f, -17.102194f, 82.00488f, 15.041012f, 37.632988f, 98.06617f, -14.228693f, 48.663326f, 45.219078f, 5.283728f, -41.322803f,
+		74.708626f, -37.90936f, 29.910757f, 73.527885f, 12.973671f, -17.102194f, 82.00488f, 15.041012f, 37.632988f, 98.06617f, -14.228693f, 48.663326f, 45.219078f, 5.283728f, -41.322803f, 51.957756f, 81.120056f, 0.05816824f,
+		74.708626f, -37.90936f, 29.910757f, 73.527885f, 12.973671f, -17.102194f, 82.00488f, 15.041012f, 37.632988f, 98.06617f, -14.228693f, 48.663326f, 45.219078f, 5.283728f, -41.322803f, 51.957756f, 81.120056f, 0.05816824f, 50.243984f, 36.457676f, 53.35119f,
+		74.708626f, -37.90936f, 29.910757f, 73.527885f, 12.973671f, -17.102194f, 82.00488f, 15.041012f, 37.632988f, 98.06617f, -14.228693f, 48.663326f, 45.219078f, 5.283728f, -41.322803f, 51.957756f, 81.120056f, 0.05816824f, 50.243984f, 36.457676f, 53.35119f, 43.19229f, -8.5046395e-06f, 3.4018556e-06f,
+		// Set1
+		48.663452f, 71.196106f, 52.975925f, 50.911907f, -2.9671383f, -36.966366f, 63.942062f, -49.050484f, 42.583633f,
+		48.663452f, 71.196106f, 52.975925f, 50.911907f, -2.9671383f, -36.966366f, 63.942062f, -49.050484f, 42.583633f, 45.316906f, 44.01088f, -32.986473f,
+		48.663452f, 71.196106f, 52.975925f, 50.911907f, -2.9671383f, -36.966366f, 63.942062f, -49.050484f, 42.583633f, 45.316906f, 44.01088f, -32.986473f, 66.85856f, 43.317474f, 73.90138f,
+		48.663452f, 71.196106f, 52.975925f, 50.911907f, -2.9671383f, -36.966366f, 63.942062f, -49.050484f, 42.583633f, 45.316906f, 44.01088f, -32.986473f, 66.85856f, 43.317474f, 73.90138f, 97.236305f, -20.769848f, 87.54371f,
+		48.663452f, 71.196106f, 52.975925f, 50.911907f, -2.9671383f, -36.966366f, 63.942062f, -49.050484f, 42.583633f, 45.316906f, 44.01088f, -32.986473f, 66.85856f, 43.317474f, 73.90138f, 97.236305f, -20.769848f, 87.54371f, 45.52175f, 29.405455f, 40.35452f,
+		48.663452f, 71.196106f, 52.975925f, 50.911907f, -2.9671383f, -36.966366f, 63.942062f, -49.050484f, 42.583633f, 45.316906f, 44.01088f, -32.986473f, 66.85856f, 43.317474f, 73.90138f, 97.236305f, -20.769848f, 87.54371f, 45.52175f, 29.405455f, 40.35452f, 68.925255f, 52.142693f, -11.813915f,
+		48.663452f, 71.196106f, 52.975925f, 50.911907f, -2.9671383f, -36.966366f, 63.942062f, -49.050484f, 42.583633f, 45.316906f, 44.01088f, -32.986473f, 66.85856f, 43.317474f, 73.90138f, 97.236305f, -20.769848f, 87.54371f, 45.52175f, 29.405455f, 40.35452f, 68.925255f, 52.142693f, -11.813915f, 63.2226f, -1.1382556e-05f, 4.5530223e-06f,
+		// Set3
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f, 78.70117f, 18.417547f, 51.62173f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f, 78.70117f, 18.417547f, 51.62173f, 83.361084f, -32.161194f, 52.196945f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f, 78.70117f, 18.417547f, 51.62173f, 83.361084f, -32.161194f, 52.196945f, 87.005424f, 20.33393f, -5.5561237f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f, 78.70117f, 18.417547f, 51.62173f, 83.361084f, -32.161194f, 52.196945f, 87.005424f, 20.33393f, -5.5561237f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f, 78.70117f, 18.417547f, 51.62173f, 83.361084f, -32.161194f, 52.196945f, 87.005424f, 20.33393f, -5.5561237f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f, 61.485775f, 33.19377f, -22.638689f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f, 78.70117f, 18.417547f, 51.62173f, 83.361084f, -32.161194f, 52.196945f, 87.005424f, 20.33393f, -5.5561237f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f, 61.485775f, 33.19377f, -22.638689f, 89.991165f, -17.052681f, 15.096897f,
+		79.825165f, -24.546347f, -1.0464562f, 98.44656f, -11.322871f, 36.42469f, 76.755615f, 7.6735845f, -15.500153f, 67.40292f, 45.590397f, 29.302155f, 69.98949f, -7.618448f, -22.327765f, 78.70117f, 18.417547f, 51.62173f, 83.361084f, -32.161194f, 52.196945f, 87.005424f, 20.33393f, -5.5561237f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f, 61.485775f, 33.19377f, -22.638689f, 89.991165f, -17.052681f, 15.096897f, 93.0052f, -9.055657f, 62.082577f,
+		// Dark2
+		58.052826f, -43.077385f, 10.984537f, 55.015667f, 44.3303f, 63.667473f, 50.244747f, 17.998692f, -34.885372f,
+		58.052826f, -43.077385f, 10.984537f, 55.015667f, 44.3303f, 63.667473f, 50.244747f, 17.998692f, -34.885372f, 52.30306f, 75.022354f, -6.254554f,
+		58.052826f, -43.077385f, 10.984537f, 55.015667f, 44.3303f, 63.667473f, 50.244747f, 17.998692f, -34.885372f, 52.30306f, 75.022354f, -6.254554f, 61.81787f, -41.285023f, 57.910374f,
+		58.052826f, -43.077385f, 10.984537f, 55.015667f, 44.3303f, 63.667473f, 50.244747f, 17.998692f, -34.885372f, 52.30306f, 75.022354f, -6.254554f, 61.81787f, -41.285023f, 57.910374f, 73.51763f, 10.125164f, 76.41036f,
+		58.052826f, -43.077385f, 10.984537f, 55.015667f, 44.3303f, 63.667473f, 50.244747f, 17.998692f, -34.885372f, 52.30306f, 75.022354f, -6.254554f, 61.81787f, -41.285023f, 57.910374f, 73.51763f, 10.125164f, 76.41036f, 53.11812f, 11.048975f, 52.32953f,
+		58.052826f, -43.077385f, 10.984537f, 55.015667f, 44.3303f, 63.667473f, 50.244747f, 17.998692f, -34.885372f, 52.30306f, 75.022354f, -6.254554f, 61.81787f, -41.285023f, 57.910374f, 73.51763f, 10.125164f, 76.41036f, 53.11812f, 11.048975f, 52.32953f, 43.19229f, -8.5046395e-06f, 3.4018556e-06f,
+		// Paired
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f, 48.45981f, 70.9374f, 52.7311f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f, 48.45981f, 70.9374f, 52.7311f, 81.45415f, 13.597273f, 48.54314f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f, 48.45981f, 70.9374f, 52.7311f, 81.45415f, 13.597273f, 48.54314f, 66.85856f, 43.317474f, 73.90138f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f, 48.45981f, 70.9374f, 52.7311f, 81.45415f, 13.597273f, 48.54314f, 66.85856f, 43.317474f, 73.90138f, 75.60838f, 15.15534f, -14.956442f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f, 48.45981f, 70.9374f, 52.7311f, 81.45415f, 13.597273f, 48.54314f, 66.85856f, 43.317474f, 73.90138f, 75.60838f, 15.15534f, -14.956442f, 35.46854f, 38.668343f, -43.597443f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f, 48.45981f, 70.9374f, 52.7311f, 81.45415f, 13.597273f, 48.54314f, 66.85856f, 43.317474f, 73.90138f, 75.60838f, 15.15534f, -14.956442f, 35.46854f, 38.668343f, -43.597443f, 98.06617f, -14.228693f, 48.663326f,
+		80.623886f, -8.441437f, -14.694889f, 48.2822f, -3.810419f, -38.844723f, 84.004486f, -29.225616f, 36.99073f, 58.0615f, -52.74359f, 48.93999f, 73.496864f, 36.110485f, 16.023472f, 48.45981f, 70.9374f, 52.7311f, 81.45415f, 13.597273f, 48.54314f, 66.85856f, 43.317474f, 73.90138f, 75.60838f, 15.15534f, -14.956442f, 35.46854f, 38.668343f, -43.597443f, 98.06617f, -14.228693f, 48.663326f, 47.81309f, 32.351856f, 43.22123f,
+		// Pastel2
+		86.197266f, -19.34467f, 5.2882514f, 85.76941f, 12.414187f, 22.849247f, 85.05268f, 0.34438112f, -10.480774f,
+		86.197266f, -19.34467f, 5.2882514f, 85.76941f, 12.414187f, 22.849247f, 85.05268f, 0.34438112f, -10.480774f, 85.54303f, 19.015993f, -7.268532f,
+		86.197266f, -19.34467f, 5.2882514f, 85.76941f, 12.414187f, 22.849247f, 85.05268f, 0.34438112f, -10.480774f, 85.54303f, 19.015993f, -7.268532f, 94.45958f, -12.389361f, 19.561737f,
+		86.197266f, -19.34467f, 5.2882514f, 85.76941f, 12.414187f, 22.849247f, 85.05268f, 0.34438112f, -10.480774f, 85.54303f, 19.015993f, -7.268532f, 94.45958f, -12.389361f, 19.561737f, 95.086044f, -5.4919677f, 34.458805f,
+		86.197266f, -19.34467f, 5.2882514f, 85.76941f, 12.414187f, 22.849247f, 85.05268f, 0.34438112f, -10.480774f, 85.54303f, 19.015993f, -7.268532f, 94.45958f, -12.389361f, 19.561737f, 95.086044f, -5.4919677f, 34.458805f, 90.53034f, 1.5589627f, 12.595391f,
+		86.197266f, -19.34467f, 5.2882514f, 85.76941f, 12.414187f, 22.849247f, 85.05268f, 0.34438112f, -10.480774f, 85.54303f, 19.015993f, -7.268532f, 94.45958f, -12.389361f, 19.561737f, 95.086044f, -5.4919677f, 34.458805f, 90.53034f, 1.5589627f, 12.595391f, 82.045784f, -1.4087037e-05f, 5.634815e-06f,
+		// Pastel1
+		79.734055f, 25.019281f, 13.343931f, 81.1765f, -4.0259004f, -13.782567f, 89.991165f, -17.052681f, 15.096897f,
+		79.734055f, 25.019281f, 13.343931f, 81.1765f, -4.0259004f, -13.782567f, 89.991165f, -17.052681f, 15.096897f, 83.884186f, 11.0659f, -9.938118f,
+		79.734055f, 25.019281f, 13.343931f, 81.1765f, -4.0259004f, -13.782567f, 89.991165f, -17.052681f, 15.096897f, 83.884186f, 11.0659f, -9.938118f, 88.66316f, 5.8595257f, 29.923183f,
+		79.734055f, 25.019281f, 13.343931f, 81.1765f, -4.0259004f, -13.782567f, 89.991165f, -17.052681f, 15.096897f, 83.884186f, 11.0659f, -9.938118f, 88.66316f, 5.8595257f, 29.923183f, 98.88367f, -8.0512295f, 24.45245f,
+		79.734055f, 25.019281f, 13.343931f, 81.1765f, -4.0259004f, -13.782567f, 89.991165f, -17.052681f, 15.096897f, 83.884186f, 11.0659f, -9.938118f, 88.66316f, 5.8595257f, 29.923183f, 98.88367f, -8.0512295f, 24.45245f, 86.723946f, 0.108322226f, 14.929479f,
+		79.734055f, 25.019281f, 13.343931f, 81.1765f, -4.0259004f, -13.782567f, 89.991165f, -17.052681f, 15.096897f, 83.884186f, 11.0659f, -9.938118f, 88.66316f, 5.8595257f, 29.923183f, 98.88367f, -8.0512295f, 24.45245f, 86.723946f, 0.108322226f, 14.929479f, 90.35994f, 15.0461645f, -4.294955f,
+		79.734055f, 25.019281f, 13.343931f, 81.1765f, -4.0259004f, -13.782567f, 89.991165f, -17.052681f, 15.096897f, 83.884186f, 11.0659f, -9.938118f, 88.66316f, 5.8595257f, 29.923183f, 98.88367f, -8.0512295f, 24.45245f, 86.723946f, 0.108322226f, 14.929479f, 90.35994f, 15.0461645f, -4.294955f, 95.49356f, -1.6019188e-05f, 6.4076758e-06f,
+
+		// sequential
+		// OrRd
+		92.99522f, 2.5831487f, 18.301302f, 80.79072f, 17.467955f, 37.102f, 53.462955f, 58.045074f, 46.06888f,
+		95.32999f, 1.0128521f, 12.810019f, 84.94895f, 9.178194f, 39.37083f, 69.80443f, 37.716938f, 45.68794f, 47.83473f, 62.738083f, 49.86737f,
+		95.32999f, 1.0128521f, 12.810019f, 84.94895f, 9.178194f, 39.37083f, 69.80443f, 37.716938f, 45.68794f, 53.462955f, 58.045074f, 46.06888f, 37.09074f, 61.411312f, 51.483418f,
+		95.32999f, 1.0128521f, 12.810019f, 87.2129f, 7.133232f, 32.089775f, 80.79072f, 17.467955f, 37.102f, 69.80443f, 37.716938f, 45.68794f, 53.462955f, 58.045074f, 46.06888f, 37.09074f, 61.411312f, 51.483418f,
+		95.32999f, 1.0128521f, 12.810019f, 87.2129f, 7.133232f, 32.089775f, 80.79072f, 17.467955f, 37.102f, 69.80443f, 37.716938f, 45.68794f, 60.007328f, 51.471638f, 42.72215f, 47.83473f, 62.738083f, 49.86737f, 31.288237f, 54.699417f, 45.136066f,
+		97.56683f, 0.81945676f, 6.2282066f, 92.99522f, 2.5831487f, 18.301302f, 87.2129f, 7.133232f, 32.089775f, 80.79072f, 17.467955f, 37.102f, 69.80443f, 37.716938f, 45.68794f, 60.007328f, 51.471638f, 42.72215f, 47.83473f, 62.738083f, 49.86737f, 31.288237f, 54.699417f, 45.136066f,
+		97.56683f, 0.81945676f, 6.2282066f, 92.99522f, 2.5831487f, 18.301302f, 87.2129f, 7.133232f, 32.089775f, 80.79072f, 17.467955f, 37.102f, 69.80443f, 37.716938f, 45.68794f, 60.007328f, 51.471638f, 42.72215f, 47.83473f, 62.738083f, 49.86737f, 37.09074f, 61.411312f, 51.483418f, 25.301403f, 47.774307f, 37.754032f,
+		// PuBu
+		92.307434f, 3.6487784f, -4.7256575f, 75.83248f, -1.2676458f, -17.60425f, 55.056988f, -10.555292f, -33.92422f,
+		94.52729f, 2.4265122f, -3.4976404f, 80.75401f, 0.7723597f, -13.2751465f, 66.96961f, -7.4561973f, -24.798252f, 45.2945f, -2.104776f, -41.27258f,
+		94.52729f, 2.4265122f, -3.4976404f, 80.75401f, 0.7723597f, -13.2751465f, 66.96961f, -7.4561973f, -24.798252f, 55.056988f, -10.555292f, -33.92422f, 36.480297f, -2.506824f, -34.438477f,
+		94.52729f, 2.4265122f, -3.4976404f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.96961f, -7.4561973f, -24.798252f, 55.056988f, -10.555292f, -33.92422f, 36.480297f, -2.506824f, -34.438477f,
+		94.52729f, 2.4265122f, -3.4976404f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.96961f, -7.4561973f, -24.798252f, 56.618702f, -10.715103f, -32.602737f, 45.2945f, -2.104776f, -41.27258f, 31.572062f, -2.3203375f, -31.159342f,
+		97.9322f, 3.3518298f, -0.9667927f, 92.307434f, 3.6487784f, -4.7256575f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.96961f, -7.4561973f, -24.798252f, 56.618702f, -10.715103f, -32.602737f, 45.2945f, -2.104776f, -41.27258f, 31.572062f, -2.3203375f, -31.159342f,
+		97.9322f, 3.3518298f, -0.9667927f, 92.307434f, 3.6487784f, -4.7256575f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.96961f, -7.4561973f, -24.798252f, 56.618702f, -10.715103f, -32.602737f, 45.2945f, -2.104776f, -41.27258f, 36.480297f, -2.506824f, -34.438477f, 22.107746f, -2.807298f, -23.762686f,
+		// BuPu
+		92.73749f, -2.4628372f, -5.234174f, 75.01114f, -3.3579643f, -18.354097f, 45.19306f, 35.86997f, -35.68522f,
+		96.862656f, -3.0574203f, -2.6889262f, 81.1765f, -4.0259004f, -13.782567f, 62.897724f, 7.439295f, -25.915401f, 40.32804f, 45.020737f, -37.424545f,
+		96.862656f, -3.0574203f, -2.6889262f, 81.1765f, -4.0259004f, -13.782567f, 62.897724f, 7.439295f, -25.915401f, 45.19306f, 35.86997f, -35.68522f, 30.556757f, 56.025757f, -32.72392f,
+		96.862656f, -3.0574203f, -2.6889262f, 83.64023f, -2.8186588f, -11.613592f, 75.01114f, -3.3579643f, -18.354097f, 62.897724f, 7.439295f, -25.915401f, 45.19306f, 35.86997f, -35.68522f, 30.556757f, 56.025757f, -32.72392f,
+		96.862656f, -3.0574203f, -2.6889262f, 83.64023f, -2.8186588f, -11.613592f, 75.01114f, -3.3579643f, -18.354097f, 62.897724f, 7.439295f, -25.915401f, 50.99613f, 27.284248f, -32.398f, 40.32804f, 45.020737f, -37.424545f, 24.948967f, 52.192116f, -31.005365f,
+		98.62521f, -1.4642239f, -1.0523812f, 92.73749f, -2.4628372f, -5.234174f, 83.64023f, -2.8186588f, -11.613592f, 75.01114f, -3.3579643f, -18.354097f, 62.897724f, 7.439295f, -25.915401f, 50.99613f, 27.284248f, -32.398f, 40.32804f, 45.020737f, -37.424545f, 24.948967f, 52.192116f, -31.005365f,
+		98.62521f, -1.4642239f, -1.0523812f, 92.73749f, -2.4628372f, -5.234174f, 83.64023f, -2.8186588f, -11.613592f, 75.01114f, -3.3579643f, -18.354097f, 62.897724f, 7.439295f, -25.915401f, 50.99613f, 27.284248f, -32.398f, 40.32804f, 45.020737f, -37.424545f, 30.556757f, 56.025757f, -32.72392f, 15.932985f, 40.93999f, -24.408878f,
+		// Oranges
+		92.62894f, 4.4667215f, 14.676286f, 77.412834f, 22.190409f, 45.657124f, 55.435497f, 53.71274f, 62.790928f,
+		94.70197f, 3.310663f, 9.328651f, 81.51487f, 15.9920225f, 37.51762f, 69.65745f, 36.69685f, 59.39276f, 50.99597f, 54.945f, 61.69356f,
+		94.70197f, 3.310663f, 9.328651f, 81.51487f, 15.9920225f, 37.51762f, 69.65745f, 36.69685f, 59.39276f, 55.435497f, 53.71274f, 62.790928f, 39.16387f, 44.28823f, 49.83088f,
+		94.70197f, 3.310663f, 9.328651f, 86.30871f, 9.658359f, 28.808826f, 77.412834f, 22.190409f, 45.657124f, 69.65745f, 36.69685f, 59.39276f, 55.435497f, 53.71274f, 62.790928f, 39.16387f, 44.28823f, 49.83088f,
+		94.70197f, 3.310663f, 9.328651f, 86.30871f, 9.658359f, 28.808826f, 77.412834f, 22.190409f, 45.657124f, 69.65745f, 36.69685f, 59.39276f, 60.654915f, 48.757153f, 65.65971f, 51.144302f, 54.543407f, 61.769165f, 32.838017f, 38.76007f, 43.240864f,
+		97.05031f, 1.6686747f, 5.9980793f, 92.62894f, 4.4667215f, 14.676286f, 86.30871f, 9.658359f, 28.808826f, 77.412834f, 22.190409f, 45.657124f, 69.65745f, 36.69685f, 59.39276f, 60.654915f, 48.757153f, 65.65971f, 51.144302f, 54.543407f, 61.769165f, 32.838017f, 38.76007f, 43.240864f,
+		97.05031f, 1.6686747f, 5.9980793f, 92.62894f, 4.4667215f, 14.676286f, 86.30871f, 9.658359f, 28.808826f, 77.412834f, 22.190409f, 45.657124f, 69.65745f, 36.69685f, 59.39276f, 60.654915f, 48.757153f, 65.65971f, 51.144302f, 54.543407f, 61.769165f, 39.16387f, 44.28823f, 49.83088f, 29.344944f, 36.59674f, 39.616436f,
+		// BuGn
+		95.497345f, -4.487514f, -3.7258365f, 81.891785f, -23.13508f, 0.97838324f, 59.15948f, -47.75295f, 25.766312f,
+		96.862656f, -3.0574203f, -2.6889262f, 86.675285f, -15.370804f, -5.082615f, 72.28604f, -34.641594f, 6.6684303f, 50.97955f, -45.04989f, 29.125023f,
+		96.862656f, -3.0574203f, -2.6889262f, 86.675285f, -15.370804f, -5.082615f, 72.28604f, -34.641594f, 6.6684303f, 59.15948f, -47.75295f, 25.766312f, 39.779064f, -42.19912f, 28.507536f,
+		96.862656f, -3.0574203f, -2.6889262f, 91.02569f, -11.561489f, -0.60654426f, 81.891785f, -23.13508f, 0.97838324f, 72.28604f, -34.641594f, 6.6684303f, 59.15948f, -47.75295f, 25.766312f, 39.779064f, -42.19912f, 28.507536f,
+		96.862656f, -3.0574203f, -2.6889262f, 91.02569f, -11.561489f, -0.60654426f, 81.891785f, -23.13508f, 0.97838324f, 72.28604f, -34.641594f, 6.6684303f, 63.918755f, -44.214386f, 19.78912f, 50.97955f, -45.04989f, 29.125023f, 32.047714f, -36.015656f, 23.530144f,
+		98.62521f, -1.4642239f, -1.0523812f, 95.497345f, -4.487514f, -3.7258365f, 91.02569f, -11.561489f, -0.60654426f, 81.891785f, -23.13508f, 0.97838324f, 72.28604f, -34.641594f, 6.6684303f, 63.918755f, -44.214386f, 19.78912f, 50.97955f, -45.04989f, 29.125023f, 32.047714f, -36.015656f, 23.530144f,
+		98.62521f, -1.4642239f, -1.0523812f, 95.497345f, -4.487514f, -3.7258365f, 91.02569f, -11.561489f, -0.60654426f, 81.891785f, -23.13508f, 0.97838324f, 72.28604f, -34.641594f, 6.6684303f, 63.918755f, -44.214386f, 19.78912f, 50.97955f, -45.04989f, 29.125023f, 39.779064f, -42.19912f, 28.507536f, 24.363699f, -30.102606f, 19.307764f,
+		// YlOrBr
+		96.58024f, -6.238406f, 29.401644f, 82.44299f, 9.373904f, 64.35258f, 55.043835f, 44.45248f, 61.269493f,
+		99.038666f, -6.907814f, 20.606438f, 88.281845f, 3.2663167f, 41.638214f, 72.24122f, 30.335508f, 69.00528f, 49.51392f, 48.31472f, 59.43465f,
+		99.038666f, -6.907814f, 20.606438f, 88.281845f, 3.2663167f, 41.638214f, 72.24122f, 30.335508f, 69.00528f, 55.043835f, 44.45248f, 61.269493f, 36.440834f, 40.44044f, 46.654747f,
+		99.038666f, -6.907814f, 20.606438f, 90.805534f, -1.5255516f, 43.361176f, 82.44299f, 9.373904f, 64.35258f, 72.24122f, 30.335508f, 69.00528f, 55.043835f, 44.45248f, 61.269493f, 36.440834f, 40.44044f, 46.654747f,
+		99.038666f, -6.907814f, 20.606438f, 90.805534f, -1.5255516f, 43.361176f, 82.44299f, 9.373904f, 64.35258f, 72.24122f, 30.335508f, 69.00528f, 61.200348f, 43.541077f, 65.43283f, 49.51392f, 48.31472f, 59.43465f, 32.838017f, 38.76007f, 43.240864f,
+		99.39274f, -4.3273687f, 12.43644f, 96.58024f, -6.238406f, 29.401644f, 90.805534f, -1.5255516f, 43.361176f, 82.44299f, 9.373904f, 64.35258f, 72.24122f, 30.335508f, 69.00528f, 61.200348f, 43.541077f, 65.43283f, 49.51392f, 48.31472f, 59.43465f, 32.838017f, 38.76007f, 43.240864f,
+		99.39274f, -4.3273687f, 12.43644f, 96.58024f, -6.238406f, 29.401644f, 90.805534f, -1.5255516f, 43.361176f, 82.44299f, 9.373904f, 64.35258f, 72.24122f, 30.335508f, 69.00528f, 61.200348f, 43.541077f, 65.43283f, 49.51392f, 48.31472f, 59.43465f, 36.440834f, 40.44044f, 46.654747f, 24.199743f, 27.7243f, 32.419846f,
+		// YlGn
+		97.18646f, -12.03073f, 31.632784f, 83.204544f, -29.51252f, 33.86689f, 59.421227f, -49.228466f, 31.935156f,
+		98.88367f, -8.0512295f, 24.45245f, 87.17422f, -24.818012f, 33.761574f, 73.38947f, -39.690144f, 31.22198f, 48.590942f, -42.70765f, 27.191467f,
+		98.88367f, -8.0512295f, 24.45245f, 87.17422f, -24.818012f, 33.761574f, 73.38947f, -39.690144f, 31.22198f, 59.421227f, -49.228466f, 31.935156f, 38.155952f, -38.416523f, 20.437172f,
+		98.88367f, -8.0512295f, 24.45245f, 91.55738f, -19.984898f, 34.796024f, 83.204544f, -29.51252f, 33.86689f, 73.38947f, -39.690144f, 31.22198f, 59.421227f, -49.228466f, 31.935156f, 38.155952f, -38.416523f, 20.437172f,
+		98.88367f, -8.0512295f, 24.45245f, 91.55738f, -19.984898f, 34.796024f, 83.204544f, -29.51252f, 33.86689f, 73.38947f, -39.690144f, 31.22198f, 62.539795f, -47.637222f, 31.303629f, 48.590942f, -42.70765f, 27.191467f, 33.01035f, -34.042107f, 16.658829f,
+		99.39274f, -4.3273687f, 12.43644f, 97.18646f, -12.03073f, 31.632784f, 91.55738f, -19.984898f, 34.796024f, 83.204544f, -29.51252f, 33.86689f, 73.38947f, -39.690144f, 31.22198f, 62.539795f, -47.637222f, 31.303629f, 48.590942f, -42.70765f, 27.191467f, 33.01035f, -34.042107f, 16.658829f,
+		99.39274f, -4.3273687f, 12.43644f, 97.18646f, -12.03073f, 31.632784f, 91.55738f, -19.984898f, 34.796024f, 83.204544f, -29.51252f, 33.86689f, 73.38947f, -39.690144f, 31.22198f, 62.539795f, -47.637222f, 31.303629f, 48.590942f, -42.70765f, 27.191467f, 38.155952f, -38.416523f, 20.437172f, 25.001617f, -27.478893f, 11.543422f,
+		// Reds
+		91.25118f, 8.140328f, 10.636231f, 71.196106f, 36.897808f, 34.239098f, 48.947495f, 65.76174f, 47.983967f,
+		92.62822f, 6.6295633f, 8.954331f, 77.88459f, 25.180988f, 26.403713f, 62.775066f, 53.522514f, 45.312298f, 43.422947f, 64.994f, 46.135864f,
+		92.62822f, 6.6295633f, 8.954331f, 77.88459f, 25.180988f, 26.403713f, 62.775066f, 53.522514f, 45.312298f, 48.947495f, 65.76174f, 47.983967f, 34.798035f, 56.11162f, 39.669758f,
+		92.62822f, 6.6295633f, 8.954331f, 81.188774f, 20.126228f, 22.356298f, 71.196106f, 36.897808f, 34.239098f, 62.775066f, 53.522514f, 45.312298f, 48.947495f, 65.76174f, 47.983967f, 34.798035f, 56.11162f, 39.669758f,
+		92.62822f, 6.6295633f, 8.954331f, 81.188774f, 20.126228f, 22.356298f, 71.196106f, 36.897808f, 34.239098f, 62.775066f, 53.522514f, 45.312298f, 53.671375f, 66.80218f, 50.54917f, 43.422947f, 64.994f, 46.135864f, 31.355728f, 54.88395f, 39.787384f,
+		97.16947f, 2.4945638f, 3.5923293f, 91.25118f, 8.140328f, 10.636231f, 81.188774f, 20.126228f, 22.356298f, 71.196106f, 36.897808f, 34.239098f, 62.775066f, 53.522514f, 45.312298f, 53.671375f, 66.80218f, 50.54917f, 43.422947f, 64.994f, 46.135864f, 31.355728f, 54.88395f, 39.787384f,
+		97.16947f, 2.4945638f, 3.5923293f, 91.25118f, 8.140328f, 10.636231f, 81.188774f, 20.126228f, 22.356298f, 71.196106f, 36.897808f, 34.239098f, 62.775066f, 53.522514f, 45.312298f, 53.671375f, 66.80218f, 50.54917f, 43.422947f, 64.994f, 46.135864f, 34.798035f, 56.11162f, 39.669758f, 19.694508f, 41.475964f, 24.734545f,
+		// RdPu
+		91.42228f, 9.478959f, 5.120003f, 75.11453f, 36.57493f, 2.9048696f, 44.93117f, 70.0855f, -18.003222f,
+		94.30373f, 4.963905f, 6.6827073f, 79.986946f, 26.46987f, 7.7643905f, 63.55162f, 60.0418f, -2.804843f, 38.776104f, 67.28311f, -20.464151f,
+		94.30373f, 4.963905f, 6.6827073f, 79.986946f, 26.46987f, 7.7643905f, 63.55162f, 60.0418f, -2.804843f, 44.93117f, 70.0855f, -18.003222f, 28.093248f, 56.28248f, -33.56109f,
+		94.30373f, 4.963905f, 6.6827073f, 84.192696f, 18.863665f, 10.0360775f, 75.11453f, 36.57493f, 2.9048696f, 63.55162f, 60.0418f, -2.804843f, 44.93117f, 70.0855f, -18.003222f, 28.093248f, 56.28248f, -33.56109f,
+		94.30373f, 4.963905f, 6.6827073f, 84.192696f, 18.863665f, 10.0360775f, 75.11453f, 36.57493f, 2.9048696f, 63.55162f, 60.0418f, -2.804843f, 51.912693f, 71.1502f, -14.786446f, 38.776104f, 67.28311f, -20.464151f, 28.093248f, 56.28248f, -33.56109f,
+		97.733925f, 1.9827917f, 2.8653178f, 91.42228f, 9.478959f, 5.120003f, 84.192696f, 18.863665f, 10.0360775f, 75.11453f, 36.57493f, 2.9048696f, 63.55162f, 60.0418f, -2.804843f, 51.912693f, 71.1502f, -14.786446f, 38.776104f, 67.28311f, -20.464151f, 28.093248f, 56.28248f, -33.56109f,
+		97.733925f, 1.9827917f, 2.8653178f, 91.42228f, 9.478959f, 5.120003f, 84.192696f, 18.863665f, 10.0360775f, 75.11453f, 36.57493f, 2.9048696f, 63.55162f, 60.0418f, -2.804843f, 51.912693f, 71.1502f, -14.786446f, 38.776104f, 67.28311f, -20.464151f, 28.093248f, 56.28248f, -33.56109f, 17.72393f, 46.242508f, -42.37917f,
+		// Greens
+		94.88409f, -8.99661f, 8.308742f, 81.6027f, -29.779016f, 24.911642f, 59.421227f, -49.228466f, 31.935156f,
+		96.419174f, -6.2717543f, 5.9478865f, 86.59277f, -22.724916f, 19.523075f, 72.56081f, -40.499146f, 31.654758f, 50.97955f, -45.04989f, 29.125023f,
+		96.419174f, -6.2717543f, 5.9478865f, 86.59277f, -22.724916f, 19.523075f, 72.56081f, -40.499146f, 31.654758f, 59.421227f, -49.228466f, 31.935156f, 39.779064f, -42.19912f, 28.507536f,
+		96.419174f, -6.2717543f, 5.9478865f, 89.02856f, -18.601267f, 16.291798f, 81.6027f, -29.779016f, 24.911642f, 72.56081f, -40.499146f, 31.654758f, 59.421227f, -49.228466f, 31.935156f, 39.779064f, -42.19912f, 28.507536f,
+		96.419174f, -6.2717543f, 5.9478865f, 89.02856f, -18.601267f, 16.291798f, 81.6027f, -29.779016f, 24.911642f, 72.56081f, -40.499146f, 31.654758f, 62.539795f, -47.637222f, 31.303629f, 50.97955f, -45.04989f, 29.125023f, 33.01035f, -34.042107f, 16.658829f,
+		98.42722f, -2.8753402f, 2.7700796f, 94.88409f, -8.99661f, 8.308742f, 89.02856f, -18.601267f, 16.291798f, 81.6027f, -29.779016f, 24.911642f, 72.56081f, -40.499146f, 31.654758f, 62.539795f, -47.637222f, 31.303629f, 50.97955f, -45.04989f, 29.125023f, 33.01035f, -34.042107f, 16.658829f,
+		98.42722f, -2.8753402f, 2.7700796f, 94.88409f, -8.99661f, 8.308742f, 89.02856f, -18.601267f, 16.291798f, 81.6027f, -29.779016f, 24.911642f, 72.56081f, -40.499146f, 31.654758f, 62.539795f, -47.637222f, 31.303629f, 50.97955f, -45.04989f, 29.125023f, 39.779064f, -42.19912f, 28.507536f, 24.363699f, -30.102606f, 19.307764f,
+		// YlGnBu
+		95.2931f, -14.759625f, 32.98432f, 77.137054f, -28.168861f, 1.3863069f, 50.888855f, -5.0822377f, -37.024754f,
+		98.88367f, -8.0512295f, 24.45245f, 82.38587f, -25.890882f, 12.881739f, 68.4328f, -27.84104f, -16.678514f, 39.867405f, 8.112826f, -45.196644f,
+		98.88367f, -8.0512295f, 24.45245f, 82.38587f, -25.890882f, 12.881739f, 68.4328f, -27.84104f, -16.678514f, 50.888855f, -5.0822377f, -37.024754f, 26.696688f, 28.831455f, -54.45104f,
+		98.88367f, -8.0512295f, 24.45245f, 88.78731f, -20.549662f, 22.173018f, 77.137054f, -28.168861f, 1.3863069f, 68.4328f, -27.84104f, -16.678514f, 50.888855f, -5.0822377f, -37.024754f, 26.696688f, 28.831455f, -54.45104f,
+		98.88367f, -8.0512295f, 24.45245f, 88.78731f, -20.549662f, 22.173018f, 77.137054f, -28.168861f, 1.3863069f, 68.4328f, -27.84104f, -16.678514f, 56.402004f, -13.977236f, -32.979446f, 39.867405f, 8.112826f, -45.196644f, 22.105577f, 25.754961f, -52.075783f,
+		99.1393f, -6.1699395f, 18.20228f, 95.2931f, -14.759625f, 32.98432f, 88.78731f, -20.549662f, 22.173018f, 77.137054f, -28.168861f, 1.3863069f, 68.4328f, -27.84104f, -16.678514f, 56.402004f, -13.977236f, -32.979446f, 39.867405f, 8.112826f, -45.196644f, 22.105577f, 25.754961f, -52.075783f,
+		99.1393f, -6.1699395f, 18.20228f, 95.2931f, -14.759625f, 32.98432f, 88.78731f, -20.549662f, 22.173018f, 77.137054f, -28.168861f, 1.3863069f, 68.4328f, -27.84104f, -16.678514f, 56.402004f, -13.977236f, -32.979446f, 39.867405f, 8.112826f, -45.196644f, 26.696688f, 28.831455f, -54.45104f, 13.439664f, 17.73342f, -37.713238f,
+		// Purples
+		94.10314f, 2.0988624f, -3.6191137f, 77.43206f, 5.826191f, -15.57948f, 48.848244f, 20.468933f, -35.91843f,
+		95.124214f, 1.912995f, -3.130657f, 81.81669f, 5.475518f, -12.113499f, 65.39675f, 11.179904f, -23.081202f, 40.561996f, 29.34261f, -40.858284f,
+		95.124214f, 1.912995f, -3.130657f, 81.81669f, 5.475518f, -12.113499f, 65.39675f, 11.179904f, -23.081202f, 48.848244f, 20.468933f, -35.91843f, 27.624617f, 42.680267f, -49.680294f,
+		95.124214f, 1.912995f, -3.130657f, 87.507385f, 3.1711583f, -8.300187f, 77.43206f, 5.826191f, -15.57948f, 65.39675f, 11.179904f, -23.081202f, 48.848244f, 20.468933f, -35.91843f, 27.624617f, 42.680267f, -49.680294f,
+		95.124214f, 1.912995f, -3.130657f, 87.507385f, 3.1711583f, -8.300187f, 77.43206f, 5.826191f, -15.57948f, 65.39675f, 11.179904f, -23.081202f, 54.866726f, 15.30993f, -31.62465f, 40.561996f, 29.34261f, -40.858284f, 22.574415f, 47.002953f, -52.380123f,
+		98.74199f, 0.68124187f, -0.8382435f, 94.10314f, 2.0988624f, -3.6191137f, 87.507385f, 3.1711583f, -8.300187f, 77.43206f, 5.826191f, -15.57948f, 65.39675f, 11.179904f, -23.081202f, 54.866726f, 15.30993f, -31.62465f, 40.561996f, 29.34261f, -40.858284f, 22.574415f, 47.002953f, -52.380123f,
+		98.74199f, 0.68124187f, -0.8382435f, 94.10314f, 2.0988624f, -3.6191137f, 87.507385f, 3.1711583f, -8.300187f, 77.43206f, 5.826191f, -15.57948f, 65.39675f, 11.179904f, -23.081202f, 54.866726f, 15.30993f, -31.62465f, 40.561996f, 29.34261f, -40.858284f, 27.624617f, 42.680267f, -49.680294f, 18.086372f, 49.364155f, -54.12759f,
+		// GnBu
+		93.909966f, -10.534428f, 9.450443f, 83.63781f, -24.92522f, 14.179677f, 62.756233f, -15.343709f, -28.673903f,
+		96.86224f, -5.938352f, 7.129086f, 86.77832f, -21.195662f, 15.091044f, 76.90825f, -26.644547f, -3.8164108f, 55.056988f, -10.555292f, -33.92422f,
+		96.86224f, -5.938352f, 7.129086f, 86.77832f, -21.195662f, 15.091044f, 76.90825f, -26.644547f, -3.8164108f, 62.756233f, -15.343709f, -28.673903f, 42.656277f, 1.3994838f, -43.126003f,
+		96.86224f, -5.938352f, 7.129086f, 89.991165f, -17.052681f, 15.096897f, 83.63781f, -24.92522f, 14.179677f, 76.90825f, -26.644547f, -3.8164108f, 62.756233f, -15.343709f, -28.673903f, 42.656277f, 1.3994838f, -43.126003f,
+		96.86224f, -5.938352f, 7.129086f, 89.991165f, -17.052681f, 15.096897f, 83.63781f, -24.92522f, 14.179677f, 76.90825f, -26.644547f, -3.8164108f, 68.431206f, -19.697834f, -24.898727f, 55.056988f, -10.555292f, -33.92422f, 36.926678f, 5.999285f, -43.979855f,
+		98.30741f, -3.735666f, 5.165082f, 93.909966f, -10.534428f, 9.450443f, 89.991165f, -17.052681f, 15.096897f, 83.63781f, -24.92522f, 14.179677f, 76.90825f, -26.644547f, -3.8164108f, 68.431206f, -19.697834f, -24.898727f, 55.056988f, -10.555292f, -33.92422f, 36.926678f, 5.999285f, -43.979855f,
+		98.30741f, -3.735666f, 5.165082f, 93.909966f, -10.534428f, 9.450443f, 89.991165f, -17.052681f, 15.096897f, 83.63781f, -24.92522f, 14.179677f, 76.90825f, -26.644547f, -3.8164108f, 68.431206f, -19.697834f, -24.898727f, 55.056988f, -10.555292f, -33.92422f, 42.656277f, 1.3994838f, -43.126003f, 27.58009f, 10.067147f, -41.28458f,
+		// Greys
+		94.79625f, -1.5919e-05f, 6.3676002e-06f, 76.6112f, -1.3306206e-05f, 5.322482e-06f, 41.964687f, -8.328259e-06f, 3.3313038e-06f,
+		97.2321f, -1.626898e-05f, 6.507592e-06f, 82.045784f, -1.4087037e-05f, 5.634815e-06f, 62.08218f, -1.1218704e-05f, 4.4874814e-06f, 34.878155f, -7.310079e-06f, 2.9240316e-06f,
+		97.2321f, -1.626898e-05f, 6.507592e-06f, 82.045784f, -1.4087037e-05f, 5.634815e-06f, 62.08218f, -1.1218704e-05f, 4.4874814e-06f, 41.964687f, -8.328259e-06f, 3.3313038e-06f, 14.679643f, -4.4079943e-06f, 1.7631978e-06f,
+		97.2321f, -1.626898e-05f, 6.507592e-06f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f, 76.6112f, -1.3306206e-05f, 5.322482e-06f, 62.08218f, -1.1218704e-05f, 4.4874814e-06f, 41.964687f, -8.328259e-06f, 3.3313038e-06f, 14.679643f, -4.4079943e-06f, 1.7631978e-06f,
+		97.2321f, -1.626898e-05f, 6.507592e-06f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f, 76.6112f, -1.3306206e-05f, 5.322482e-06f, 62.08218f, -1.1218704e-05f, 4.4874814e-06f, 48.441105f, -9.258779e-06f, 3.7035115e-06f, 34.878155f, -7.310079e-06f, 2.9240316e-06f, 14.679643f, -4.4079943e-06f, 1.7631978e-06f,
+		100.00001f, -1.6666667e-05f, 6.6666666e-06f, 94.79625f, -1.5919e-05f, 6.3676002e-06f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f, 76.6112f, -1.3306206e-05f, 5.322482e-06f, 62.08218f, -1.1218704e-05f, 4.4874814e-06f, 48.441105f, -9.258779e-06f, 3.7035115e-06f, 34.878155f, -7.310079e-06f, 2.9240316e-06f, 14.679643f, -4.4079943e-06f, 1.7631978e-06f,
+		100.00001f, -1.6666667e-05f, 6.6666666e-06f, 94.79625f, -1.5919e-05f, 6.3676002e-06f, 86.69542f, -1.4755088e-05f, 5.9020354e-06f, 76.6112f, -1.3306206e-05f, 5.322482e-06f, 62.08218f, -1.1218704e-05f, 4.4874814e-06f, 48.441105f, -9.258779e-06f, 3.7035115e-06f, 34.878155f, -7.310079e-06f, 2.9240316e-06f, 14.679643f, -4.4079943e-06f, 1.7631978e-06f, 0.0f, 0.0f, 0.0f,
+		// YlOrRd
+		93.61045f, -4.59943f, 39.531174f, 78.13309f, 18.600758f, 61.135746f, 53.77526f, 66.82473f, 56.238228f,
+		98.43055f, -11.4440775f, 36.900726f, 84.500916f, 5.965385f, 60.96169f, 69.65745f, 36.69685f, 59.39276f, 48.45981f, 70.9374f, 52.7311f,
+		98.43055f, -11.4440775f, 36.900726f, 84.500916f, 5.965385f, 60.96169f, 69.65745f, 36.69685f, 59.39276f, 53.77526f, 66.82473f, 56.238228f, 39.5171f, 64.59068f, 36.505367f,
+		98.43055f, -11.4440775f, 36.900726f, 87.97244f, 1.1262114f, 52.990635f, 78.13309f, 18.600758f, 61.135746f, 69.65745f, 36.69685f, 59.39276f, 53.77526f, 66.82473f, 56.238228f, 39.5171f, 64.59068f, 36.505367f,
+		98.43055f, -11.4440775f, 36.900726f, 87.97244f, 1.1262114f, 52.990635f, 78.13309f, 18.600758f, 61.135746f, 69.65745f, 36.69685f, 59.39276f, 58.337734f, 64.28353f, 56.594578f, 48.45981f, 70.9374f, 52.7311f, 36.91148f, 61.614235f, 32.96292f,
+		98.88367f, -8.0512295f, 24.45245f, 93.61045f, -4.59943f, 39.531174f, 87.97244f, 1.1262114f, 52.990635f, 78.13309f, 18.600758f, 61.135746f, 69.65745f, 36.69685f, 59.39276f, 58.337734f, 64.28353f, 56.594578f, 48.45981f, 70.9374f, 52.7311f, 36.91148f, 61.614235f, 32.96292f,
+		98.88367f, -8.0512295f, 24.45245f, 93.61045f, -4.59943f, 39.531174f, 87.97244f, 1.1262114f, 52.990635f, 78.13309f, 18.600758f, 61.135746f, 69.65745f, 36.69685f, 59.39276f, 58.337734f, 64.28353f, 56.594578f, 48.45981f, 70.9374f, 52.7311f, 39.5171f, 64.59068f, 36.505367f, 25.953215f, 49.179943f, 17.375015f,
+		// PuRd
+		90.35448f, 4.5510564f, -6.0805063f, 67.81541f, 28.381605f, -18.481567f, 48.93252f, 73.540375f, 0.05914417f,
+		94.52729f, 2.4265122f, -3.4976404f, 77.55135f, 18.263453f, -13.00949f, 60.009243f, 55.98072f, -17.076471f, 44.561764f, 69.06605f, 13.855339f,
+		94.52729f, 2.4265122f, -3.4976404f, 77.55135f, 18.263453f, -13.00949f, 60.009243f, 55.98072f, -17.076471f, 48.93252f, 73.540375f, 0.05914417f, 31.99466f, 56.95471f, 6.8923697f,
+		94.52729f, 2.4265122f, -3.4976404f, 78.32021f, 15.472087f, -12.967464f, 67.81541f, 28.381605f, -18.481567f, 60.009243f, 55.98072f, -17.076471f, 48.93252f, 73.540375f, 0.05914417f, 31.99466f, 56.95471f, 6.8923697f,
+		94.52729f, 2.4265122f, -3.4976404f, 78.32021f, 15.472087f, -12.967464f, 67.81541f, 28.381605f, -18.481567f, 60.009243f, 55.98072f, -17.076471f, 52.30306f, 75.022354f, -6.254554f, 44.561764f, 69.06605f, 13.855339f, 30.352982f, 54.98313f, 7.027532f,
+		96.539665f, 1.8784109f, -2.0452557f, 90.35448f, 4.5510564f, -6.0805063f, 78.32021f, 15.472087f, -12.967464f, 67.81541f, 28.381605f, -18.481567f, 60.009243f, 55.98072f, -17.076471f, 52.30306f, 75.022354f, -6.254554f, 44.561764f, 69.06605f, 13.855339f, 30.352982f, 54.98313f, 7.027532f,
+		96.539665f, 1.8784109f, -2.0452557f, 90.35448f, 4.5510564f, -6.0805063f, 78.32021f, 15.472087f, -12.967464f, 67.81541f, 28.381605f, -18.481567f, 60.009243f, 55.98072f, -17.076471f, 52.30306f, 75.022354f, -6.254554f, 44.561764f, 69.06605f, 13.855339f, 31.99466f, 56.95471f, 6.8923697f, 19.977488f, 42.24223f, 13.409475f,
+		// Blues
+		92.42489f, -2.0131032f, -7.274141f, 79.00911f, -9.129416f, -16.098515f, 52.163788f, -4.403781f, -37.87881f,
+		95.860306f, 0.87278795f, -6.214148f, 84.58035f, -5.3178973f, -10.756622f, 68.2047f, -10.352687f, -26.799732f, 46.268574f, 1.0172505f, -42.612083f,
+		95.860306f, 0.87278795f, -6.214148f, 84.58035f, -5.3178973f, -10.756622f, 68.2047f, -10.352687f, -26.799732f, 52.163788f, -4.403781f, -37.87881f, 34.672215f, 9.828025f, -46.40248f,
+		95.860306f, 0.87278795f, -6.214148f, 86.45419f, -2.920066f, -12.131034f, 79.00911f, -9.129416f, -16.098515f, 68.2047f, -10.352687f, -26.799732f, 52.163788f, -4.403781f, -37.87881f, 34.672215f, 9.828025f, -46.40248f,
+		95.860306f, 0.87278795f, -6.214148f, 86.45419f, -2.920066f, -12.131034f, 79.00911f, -9.129416f, -16.098515f, 68.2047f, -10.352687f, -26.799732f, 57.83799f, -7.9827013f, -34.06664f, 46.268574f, 1.0172505f, -42.612083f, 30.508446f, 14.671656f, -48.279408f,
+		98.42754f, -0.59945613f, -2.3700984f, 92.42489f, -2.0131032f, -7.274141f, 86.45419f, -2.920066f, -12.131034f, 79.00911f, -9.129416f, -16.098515f, 68.2047f, -10.352687f, -26.799732f, 57.83799f, -7.9827013f, -34.06664f, 46.268574f, 1.0172505f, -42.612083f, 30.508446f, 14.671656f, -48.279408f,
+		98.42754f, -0.59945613f, -2.3700984f, 92.42489f, -2.0131032f, -7.274141f, 86.45419f, -2.920066f, -12.131034f, 79.00911f, -9.129416f, -16.098515f, 68.2047f, -10.352687f, -26.799732f, 57.83799f, -7.9827013f, -34.06664f, 46.268574f, 1.0172505f, -42.612083f, 34.672215f, 9.828025f, -46.40248f, 20.929369f, 11.940309f, -38.05869f,
+		// PuBuGn
+		91.01537f, 5.8707786f, -5.58525f, 75.83248f, -1.2676458f, -17.60425f, 54.544403f, -26.8518f, -13.548404f,
+		95.17841f, 3.7456198f, -3.0160353f, 80.75401f, 0.7723597f, -13.2751465f, 66.33769f, -10.582527f, -25.822166f, 48.941647f, -25.918863f, -13.324328f,
+		95.17841f, 3.7456198f, -3.0160353f, 80.75401f, 0.7723597f, -13.2751465f, 66.33769f, -10.582527f, -25.822166f, 54.544403f, -26.8518f, -13.548404f, 40.331364f, -31.46991f, 3.1872663f,
+		95.17841f, 3.7456198f, -3.0160353f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.33769f, -10.582527f, -25.822166f, 54.544403f, -26.8518f, -13.548404f, 40.331364f, -31.46991f, 3.1872663f,
+		95.17841f, 3.7456198f, -3.0160353f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.33769f, -10.582527f, -25.822166f, 56.618702f, -10.715103f, -32.602737f, 48.941647f, -25.918863f, -13.324328f, 37.29702f, -30.456211f, 4.311591f,
+		97.9322f, 3.3518298f, -0.9667927f, 91.01537f, 5.8707786f, -5.58525f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.33769f, -10.582527f, -25.822166f, 56.618702f, -10.715103f, -32.602737f, 48.941647f, -25.918863f, -13.324328f, 37.29702f, -30.456211f, 4.311591f,
+		97.9322f, 3.3518298f, -0.9667927f, 91.01537f, 5.8707786f, -5.58525f, 84.34109f, 3.660202f, -10.439874f, 75.83248f, -1.2676458f, -17.60425f, 66.33769f, -10.582527f, -25.822166f, 56.618702f, -10.715103f, -32.602737f, 48.941647f, -25.918863f, -13.324328f, 40.331364f, -31.46991f, 3.1872663f, 25.721565f, -24.16917f, 4.1639957f
+	};
+
+
+	constexpr float oklabTable[5067] =
+	{
+		// diverging
+		// Spectral
+		0.7538001f, 0.10663972f, 0.106082395f, 0.9848672f, -0.02484855f, 0.07737811f, 0.8155188f, -0.08639102f, 0.06591684f,
+		0.5603788f, 0.19316536f, 0.10131627f, 0.8122058f, 0.05890702f, 0.11747913f, 0.8479244f, -0.07322574f, 0.05810141f, 0.584056f, -0.056894146f, -0.102392174f,
+		0.5603788f, 0.19316536f, 0.10131627f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9848672f, -0.02484855f, 0.07737811f, 0.8479244f, -0.07322574f, 0.05810141f, 0.584056f, -0.056894146f, -0.102392174f,
+		0.5894137f, 0.17667021f, 0.060552876f, 0.7538001f, 0.10663972f, 0.106082395f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9383669f, -0.051950984f, 0.10557146f, 0.8155188f, -0.08639102f, 0.06591684f, 0.5994538f, -0.057148788f, -0.09892973f,
+		0.5894137f, 0.17667021f, 0.060552876f, 0.7538001f, 0.10663972f, 0.106082395f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9848672f, -0.02484855f, 0.07737811f, 0.9383669f, -0.051950984f, 0.10557146f, 0.8155188f, -0.08639102f, 0.06591684f, 0.5994538f, -0.057148788f, -0.09892973f,
+		0.5894137f, 0.17667021f, 0.060552876f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9383669f, -0.051950984f, 0.10557146f, 0.8479244f, -0.07322574f, 0.05810141f, 0.74887574f, -0.09743241f, 0.015739338f, 0.5994538f, -0.057148788f, -0.09892973f,
+		0.5894137f, 0.17667021f, 0.060552876f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9848672f, -0.02484855f, 0.07737811f, 0.9383669f, -0.051950984f, 0.10557146f, 0.8479244f, -0.07322574f, 0.05810141f, 0.74887574f, -0.09743241f, 0.015739338f, 0.5994538f, -0.057148788f, -0.09892973f,
+		0.4484763f, 0.17743309f, 0.02427842f, 0.5894137f, 0.17667021f, 0.060552876f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9383669f, -0.051950984f, 0.10557146f, 0.8479244f, -0.07322574f, 0.05810141f, 0.74887574f, -0.09743241f, 0.015739338f, 0.5994538f, -0.057148788f, -0.09892973f, 0.48397264f, 0.041924197f, -0.12206217f,
+		0.4484763f, 0.17743309f, 0.02427842f, 0.5894137f, 0.17667021f, 0.060552876f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9848672f, -0.02484855f, 0.07737811f, 0.9383669f, -0.051950984f, 0.10557146f, 0.8479244f, -0.07322574f, 0.05810141f, 0.74887574f, -0.09743241f, 0.015739338f, 0.5994538f, -0.057148788f, -0.09892973f, 0.48397264f, 0.041924197f, -0.12206217f,
+		// RdYlGn
+		0.7538001f, 0.10663972f, 0.106082395f, 0.9848672f, -0.02484855f, 0.07737811f, 0.78826016f, -0.10724788f, 0.114578925f,
+		0.5603788f, 0.19316536f, 0.10131627f, 0.8122058f, 0.05890702f, 0.11747913f, 0.82572603f, -0.09629872f, 0.116448015f, 0.5904828f, -0.13670076f, 0.08462311f,
+		0.5603788f, 0.19316536f, 0.10131627f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9848672f, -0.02484855f, 0.07737811f, 0.82572603f, -0.09629872f, 0.116448015f, 0.5904828f, -0.13670076f, 0.08462311f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.7538001f, 0.10663972f, 0.106082395f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9140604f, -0.06205805f, 0.11128637f, 0.78826016f, -0.10724788f, 0.114578925f, 0.5983645f, -0.1320487f, 0.070498854f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.7538001f, 0.10663972f, 0.106082395f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9848672f, -0.02484855f, 0.07737811f, 0.9140604f, -0.06205805f, 0.11128637f, 0.78826016f, -0.10724788f, 0.114578925f, 0.5983645f, -0.1320487f, 0.070498854f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9140604f, -0.06205805f, 0.11128637f, 0.82572603f, -0.09629872f, 0.116448015f, 0.72233844f, -0.12115861f, 0.09076507f, 0.5983645f, -0.1320487f, 0.070498854f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9848672f, -0.02484855f, 0.07737811f, 0.9140604f, -0.06205805f, 0.11128637f, 0.82572603f, -0.09629872f, 0.116448015f, 0.72233844f, -0.12115861f, 0.09076507f, 0.5983645f, -0.1320487f, 0.070498854f,
+		0.45638657f, 0.17151959f, 0.065200604f, 0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9140604f, -0.06205805f, 0.11128637f, 0.82572603f, -0.09629872f, 0.116448015f, 0.72233844f, -0.12115861f, 0.09076507f, 0.5983645f, -0.1320487f, 0.070498854f, 0.45391306f, -0.102978714f, 0.050393034f,
+		0.45638657f, 0.17151959f, 0.065200604f, 0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9134586f, -0.0012686248f, 0.10959309f, 0.9848672f, -0.02484855f, 0.07737811f, 0.9140604f, -0.06205805f, 0.11128637f, 0.82572603f, -0.09629872f, 0.116448015f, 0.72233844f, -0.12115861f, 0.09076507f, 0.5983645f, -0.1320487f, 0.070498854f, 0.45391306f, -0.102978714f, 0.050393034f,
+		// RdBu
+		0.7336255f, 0.10026577f, 0.090319715f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.7053337f, -0.04999039f, -0.071779095f,
+		0.52854633f, 0.19419105f, 0.09057586f, 0.79115057f, 0.07507552f, 0.07420368f, 0.79636294f, -0.041393135f, -0.048769265f, 0.52877736f, -0.056304418f, -0.11637011f,
+		0.52854633f, 0.19419105f, 0.09057586f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.79636294f, -0.041393135f, -0.048769265f, 0.52877736f, -0.056304418f, -0.11637011f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.7336255f, 0.10026577f, 0.090319715f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9103817f, -0.01619798f, -0.020464253f, 0.7053337f, -0.04999039f, -0.071779095f, 0.5046411f, -0.03945315f, -0.12409646f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.7336255f, 0.10026577f, 0.090319715f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.9103817f, -0.01619798f, -0.020464253f, 0.7053337f, -0.04999039f, -0.071779095f, 0.5046411f, -0.03945315f, -0.12409646f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9103817f, -0.01619798f, -0.020464253f, 0.79636294f, -0.041393135f, -0.048769265f, 0.6339338f, -0.056201108f, -0.09011002f, 0.5046411f, -0.03945315f, -0.12409646f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.9103817f, -0.01619798f, -0.020464253f, 0.79636294f, -0.041393135f, -0.048769265f, 0.6339338f, -0.056201108f, -0.09011002f, 0.5046411f, -0.03945315f, -0.12409646f,
+		0.3268716f, 0.1266581f, 0.032032344f, 0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9103817f, -0.01619798f, -0.020464253f, 0.79636294f, -0.041393135f, -0.048769265f, 0.6339338f, -0.056201108f, -0.09011002f, 0.5046411f, -0.03945315f, -0.12409646f, 0.3130149f, -0.024547698f, -0.09472482f,
+		0.3268716f, 0.1266581f, 0.032032344f, 0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.9103817f, -0.01619798f, -0.020464253f, 0.79636294f, -0.041393135f, -0.048769265f, 0.6339338f, -0.056201108f, -0.09011002f, 0.5046411f, -0.03945315f, -0.12409646f, 0.3130149f, -0.024547698f, -0.09472482f,
+		// PiYG
+		0.79379684f, 0.092596814f, -0.023511484f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.8179677f, -0.098554716f, 0.11406137f,
+		0.57416546f, 0.22248939f, -0.039413247f, 0.84061676f, 0.07811171f, -0.025641976f, 0.85964316f, -0.07840378f, 0.0983532f, 0.661452f, -0.14137247f, 0.12476267f,
+		0.57416546f, 0.22248939f, -0.039413247f, 0.84061676f, 0.07811171f, -0.025641976f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.85964316f, -0.07840378f, 0.0983532f, 0.661452f, -0.14137247f, 0.12476267f,
+		0.5492665f, 0.21148565f, -0.027822884f, 0.79379684f, 0.092596814f, -0.023511484f, 0.934693f, 0.03604867f, -0.009492004f, 0.94938844f, -0.029609721f, 0.041738313f, 0.8179677f, -0.098554716f, 0.11406137f, 0.5921328f, -0.115149744f, 0.11056289f,
+		0.5492665f, 0.21148565f, -0.027822884f, 0.79379684f, 0.092596814f, -0.023511484f, 0.934693f, 0.03604867f, -0.009492004f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.94938844f, -0.029609721f, 0.041738313f, 0.8179677f, -0.098554716f, 0.11406137f, 0.5921328f, -0.115149744f, 0.11056289f,
+		0.5492665f, 0.21148565f, -0.027822884f, 0.7009735f, 0.13956721f, -0.029275447f, 0.84061676f, 0.07811171f, -0.025641976f, 0.934693f, 0.03604867f, -0.009492004f, 0.94938844f, -0.029609721f, 0.041738313f, 0.85964316f, -0.07840378f, 0.0983532f, 0.72863925f, -0.11112788f, 0.12386655f, 0.5921328f, -0.115149744f, 0.11056289f,
+		0.5492665f, 0.21148565f, -0.027822884f, 0.7009735f, 0.13956721f, -0.029275447f, 0.84061676f, 0.07811171f, -0.025641976f, 0.934693f, 0.03604867f, -0.009492004f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.94938844f, -0.029609721f, 0.041738313f, 0.85964316f, -0.07840378f, 0.0983532f, 0.72863925f, -0.11112788f, 0.12386655f, 0.5921328f, -0.115149744f, 0.11056289f,
+		0.42257702f, 0.17213798f, -0.01431781f, 0.5492665f, 0.21148565f, -0.027822884f, 0.7009735f, 0.13956721f, -0.029275447f, 0.84061676f, 0.07811171f, -0.025641976f, 0.934693f, 0.03604867f, -0.009492004f, 0.94938844f, -0.029609721f, 0.041738313f, 0.85964316f, -0.07840378f, 0.0983532f, 0.72863925f, -0.11112788f, 0.12386655f, 0.5921328f, -0.115149744f, 0.11056289f, 0.44656494f, -0.09557868f, 0.079421915f,
+		0.42257702f, 0.17213798f, -0.01431781f, 0.5492665f, 0.21148565f, -0.027822884f, 0.7009735f, 0.13956721f, -0.029275447f, 0.84061676f, 0.07811171f, -0.025641976f, 0.934693f, 0.03604867f, -0.009492004f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.94938844f, -0.029609721f, 0.041738313f, 0.85964316f, -0.07840378f, 0.0983532f, 0.72863925f, -0.11112788f, 0.12386655f, 0.5921328f, -0.115149744f, 0.11056289f, 0.44656494f, -0.09557868f, 0.079421915f,
+		// PRGn
+		0.69368756f, 0.05827397f, -0.0631934f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.7440985f, -0.09262109f, 0.06988255f,
+		0.46234885f, 0.11814527f, -0.11263514f, 0.761141f, 0.047641087f, -0.04708609f, 0.8394817f, -0.07700722f, 0.05993766f, 0.54694057f, -0.1331298f, 0.081375286f,
+		0.46234885f, 0.11814527f, -0.11263514f, 0.761141f, 0.047641087f, -0.04708609f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.8394817f, -0.07700722f, 0.05993766f, 0.54694057f, -0.1331298f, 0.081375286f,
+		0.43489295f, 0.12175324f, -0.096818864f, 0.69368756f, 0.05827397f, -0.0631934f, 0.8913011f, 0.027526906f, -0.019745583f, 0.93047667f, -0.03454273f, 0.02979691f, 0.7440985f, -0.09262109f, 0.06988255f, 0.50463074f, -0.11145171f, 0.067699015f,
+		0.43489295f, 0.12175324f, -0.096818864f, 0.69368756f, 0.05827397f, -0.0631934f, 0.8913011f, 0.027526906f, -0.019745583f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.93047667f, -0.03454273f, 0.02979691f, 0.7440985f, -0.09262109f, 0.06988255f, 0.50463074f, -0.11145171f, 0.067699015f,
+		0.43489295f, 0.12175324f, -0.096818864f, 0.6080199f, 0.06978641f, -0.06929689f, 0.761141f, 0.047641087f, -0.04708609f, 0.8913011f, 0.027526906f, -0.019745583f, 0.93047667f, -0.03454273f, 0.02979691f, 0.8394817f, -0.07700722f, 0.05993766f, 0.6788184f, -0.11382259f, 0.0779986f, 0.50463074f, -0.11145171f, 0.067699015f,
+		0.43489295f, 0.12175324f, -0.096818864f, 0.6080199f, 0.06978641f, -0.06929689f, 0.761141f, 0.047641087f, -0.04708609f, 0.8913011f, 0.027526906f, -0.019745583f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.93047667f, -0.03454273f, 0.02979691f, 0.8394817f, -0.07700722f, 0.05993766f, 0.6788184f, -0.11382259f, 0.0779986f, 0.50463074f, -0.11145171f, 0.067699015f,
+		0.26944056f, 0.09979742f, -0.08134271f, 0.43489295f, 0.12175324f, -0.096818864f, 0.6080199f, 0.06978641f, -0.06929689f, 0.761141f, 0.047641087f, -0.04708609f, 0.8913011f, 0.027526906f, -0.019745583f, 0.93047667f, -0.03454273f, 0.02979691f, 0.8394817f, -0.07700722f, 0.05993766f, 0.6788184f, -0.11382259f, 0.0779986f, 0.50463074f, -0.11145171f, 0.067699015f, 0.3379472f, -0.080563754f, 0.04645098f,
+		0.26944056f, 0.09979742f, -0.08134271f, 0.43489295f, 0.12175324f, -0.096818864f, 0.6080199f, 0.06978641f, -0.06929689f, 0.761141f, 0.047641087f, -0.04708609f, 0.8913011f, 0.027526906f, -0.019745583f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.93047667f, -0.03454273f, 0.02979691f, 0.8394817f, -0.07700722f, 0.05993766f, 0.6788184f, -0.11382259f, 0.0779986f, 0.50463074f, -0.11145171f, 0.067699015f, 0.3379472f, -0.080563754f, 0.04645098f,
+		// RdYlBu
+		0.7538001f, 0.10663972f, 0.106082395f, 0.9848672f, -0.02484855f, 0.07737811f, 0.7816704f, -0.03580382f, -0.051822077f,
+		0.5603788f, 0.19316536f, 0.10131627f, 0.8122058f, 0.05890702f, 0.11747913f, 0.858108f, -0.039716538f, -0.03467532f, 0.56314135f, -0.050055843f, -0.10757274f,
+		0.5603788f, 0.19316536f, 0.10131627f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9848672f, -0.02484855f, 0.07737811f, 0.858108f, -0.039716538f, -0.03467532f, 0.56314135f, -0.050055843f, -0.10757274f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.7538001f, 0.10663972f, 0.106082395f, 0.9142295f, 0.0006005883f, 0.10446306f, 0.95161843f, -0.017273767f, -0.012211041f, 0.7816704f, -0.03580382f, -0.051822077f, 0.5576472f, -0.027344517f, -0.10827602f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.7538001f, 0.10663972f, 0.106082395f, 0.9142295f, 0.0006005883f, 0.10446306f, 0.9848672f, -0.02484855f, 0.07737811f, 0.95161843f, -0.017273767f, -0.012211041f, 0.7816704f, -0.03580382f, -0.051822077f, 0.5576472f, -0.027344517f, -0.10827602f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9142295f, 0.0006005883f, 0.10446306f, 0.95161843f, -0.017273767f, -0.012211041f, 0.858108f, -0.039716538f, -0.03467532f, 0.7217668f, -0.043129534f, -0.06665735f, 0.5576472f, -0.027344517f, -0.10827602f,
+		0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9142295f, 0.0006005883f, 0.10446306f, 0.9848672f, -0.02484855f, 0.07737811f, 0.95161843f, -0.017273767f, -0.012211041f, 0.858108f, -0.039716538f, -0.03467532f, 0.7217668f, -0.043129534f, -0.06665735f, 0.5576472f, -0.027344517f, -0.10827602f,
+		0.45638657f, 0.17151959f, 0.065200604f, 0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9142295f, 0.0006005883f, 0.10446306f, 0.95161843f, -0.017273767f, -0.012211041f, 0.858108f, -0.039716538f, -0.03467532f, 0.7217668f, -0.043129534f, -0.06665735f, 0.5576472f, -0.027344517f, -0.10827602f, 0.39131975f, 0.012054359f, -0.15248466f,
+		0.45638657f, 0.17151959f, 0.065200604f, 0.5750744f, 0.17927359f, 0.09768259f, 0.6923493f, 0.13918993f, 0.107558906f, 0.8122058f, 0.05890702f, 0.11747913f, 0.9142295f, 0.0006005883f, 0.10446306f, 0.9848672f, -0.02484855f, 0.07737811f, 0.95161843f, -0.017273767f, -0.012211041f, 0.858108f, -0.039716538f, -0.03467532f, 0.7217668f, -0.043129534f, -0.06665735f, 0.5576472f, -0.027344517f, -0.10827602f, 0.39131975f, 0.012054359f, -0.15248466f,
+		// BrBG
+		0.78327614f, 0.010056943f, 0.10557917f, 0.97015077f, 7.8536455e-11f, 3.616131e-08f, 0.7122922f, -0.0865427f, -0.011794298f,
+		0.5594602f, 0.059041057f, 0.104233615f, 0.82354003f, 0.004016331f, 0.09362751f, 0.79484695f, -0.07837945f, -0.0045510763f, 0.5515236f, -0.10183199f, 0.005052171f,
+		0.5594602f, 0.059041057f, 0.104233615f, 0.82354003f, 0.004016331f, 0.09362751f, 0.97015077f, 7.8536455e-11f, 3.616131e-08f, 0.79484695f, -0.07837945f, -0.0045510763f, 0.5515236f, -0.10183199f, 0.005052171f,
+		0.49337056f, 0.05023849f, 0.096648976f, 0.78327614f, 0.010056943f, 0.10557917f, 0.9328069f, 0.0002126425f, 0.05066788f, 0.9105261f, -0.036932193f, -0.0039065536f, 0.7122922f, -0.0865427f, -0.011794298f, 0.45909536f, -0.08007924f, -0.007681032f,
+		0.49337056f, 0.05023849f, 0.096648976f, 0.78327614f, 0.010056943f, 0.10557917f, 0.9328069f, 0.0002126425f, 0.05066788f, 0.97015077f, 7.8536455e-11f, 3.616131e-08f, 0.9105261f, -0.036932193f, -0.0039065536f, 0.7122922f, -0.0865427f, -0.011794298f, 0.45909536f, -0.08007924f, -0.007681032f,
+		0.49337056f, 0.05023849f, 0.096648976f, 0.6522064f, 0.041807406f, 0.11559688f, 0.82354003f, 0.004016331f, 0.09362751f, 0.9328069f, 0.0002126425f, 0.05066788f, 0.9105261f, -0.036932193f, -0.0039065536f, 0.79484695f, -0.07837945f, -0.0045510763f, 0.61779433f, -0.08978303f, -0.011742954f, 0.45909536f, -0.08007924f, -0.007681032f,
+		0.49337056f, 0.05023849f, 0.096648976f, 0.6522064f, 0.041807406f, 0.11559688f, 0.82354003f, 0.004016331f, 0.09362751f, 0.9328069f, 0.0002126425f, 0.05066788f, 0.97015077f, 7.8536455e-11f, 3.616131e-08f, 0.9105261f, -0.036932193f, -0.0039065536f, 0.79484695f, -0.07837945f, -0.0045510763f, 0.61779433f, -0.08978303f, -0.011742954f, 0.45909536f, -0.08007924f, -0.007681032f,
+		0.34703258f, 0.032578588f, 0.066922344f, 0.49337056f, 0.05023849f, 0.096648976f, 0.6522064f, 0.041807406f, 0.11559688f, 0.82354003f, 0.004016331f, 0.09362751f, 0.9328069f, 0.0002126425f, 0.05066788f, 0.9105261f, -0.036932193f, -0.0039065536f, 0.79484695f, -0.07837945f, -0.0045510763f, 0.61779433f, -0.08978303f, -0.011742954f, 0.45909536f, -0.08007924f, -0.007681032f, 0.3177981f, -0.0600316f, 0.006081504f,
+		0.34703258f, 0.032578588f, 0.066922344f, 0.49337056f, 0.05023849f, 0.096648976f, 0.6522064f, 0.041807406f, 0.11559688f, 0.82354003f, 0.004016331f, 0.09362751f, 0.9328069f, 0.0002126425f, 0.05066788f, 0.97015077f, 7.8536455e-11f, 3.616131e-08f, 0.9105261f, -0.036932193f, -0.0039065536f, 0.79484695f, -0.07837945f, -0.0045510763f, 0.61779433f, -0.08978303f, -0.011742954f, 0.45909536f, -0.08007924f, -0.007681032f, 0.3177981f, -0.0600316f, 0.006081504f,
+		// RdGy
+		0.7336255f, 0.10026577f, 0.090319715f, 1.0f, 8.0952856e-11f, 3.7273907e-08f, 0.6829534f, 5.5286997e-11f, 2.5456341e-08f,
+		0.52854633f, 0.19419105f, 0.09057586f, 0.79115057f, 0.07507552f, 0.07420368f, 0.78892064f, 6.3865246e-11f, 2.9406154e-08f, 0.37149495f, 3.0073527e-11f, 1.3847068e-08f,
+		0.52854633f, 0.19419105f, 0.09057586f, 0.79115057f, 0.07507552f, 0.07420368f, 1.0f, 8.0952856e-11f, 3.7273907e-08f, 0.78892064f, 6.3865246e-11f, 2.9406154e-08f, 0.37149495f, 3.0073527e-11f, 1.3847068e-08f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.7336255f, 0.10026577f, 0.090319715f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9067007f, 7.340012e-11f, 3.3796276e-08f, 0.6829534f, 5.5286997e-11f, 2.5456341e-08f, 0.42023715f, 3.4019287e-11f, 1.566388e-08f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.7336255f, 0.10026577f, 0.090319715f, 0.9145828f, 0.02839982f, 0.036810976f, 1.0f, 8.0952856e-11f, 3.7273907e-08f, 0.9067007f, 7.340012e-11f, 3.3796276e-08f, 0.6829534f, 5.5286997e-11f, 2.5456341e-08f, 0.42023715f, 3.4019287e-11f, 1.566388e-08f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9067007f, 7.340012e-11f, 3.3796276e-08f, 0.78892064f, 6.3865246e-11f, 2.9406154e-08f, 0.62340915f, 5.046652e-11f, 2.3236897e-08f, 0.42023715f, 3.4019287e-11f, 1.566388e-08f,
+		0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 1.0f, 8.0952856e-11f, 3.7273907e-08f, 0.9067007f, 7.340012e-11f, 3.3796276e-08f, 0.78892064f, 6.3865246e-11f, 2.9406154e-08f, 0.62340915f, 5.046652e-11f, 2.3236897e-08f, 0.42023715f, 3.4019287e-11f, 1.566388e-08f,
+		0.3268716f, 0.1266581f, 0.032032344f, 0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 0.9067007f, 7.340012e-11f, 3.3796276e-08f, 0.78892064f, 6.3865246e-11f, 2.9406154e-08f, 0.62340915f, 5.046652e-11f, 2.3236897e-08f, 0.42023715f, 3.4019287e-11f, 1.566388e-08f, 0.2177865f, 1.7630564e-11f, 8.117754e-09f,
+		0.3268716f, 0.1266581f, 0.032032344f, 0.49154305f, 0.17100261f, 0.070582405f, 0.6316191f, 0.13090064f, 0.07881688f, 0.79115057f, 0.07507552f, 0.07420368f, 0.9145828f, 0.02839982f, 0.036810976f, 1.0f, 8.0952856e-11f, 3.7273907e-08f, 0.9067007f, 7.340012e-11f, 3.3796276e-08f, 0.78892064f, 6.3865246e-11f, 2.9406154e-08f, 0.62340915f, 5.046652e-11f, 2.3236897e-08f, 0.42023715f, 3.4019287e-11f, 1.566388e-08f, 0.2177865f, 1.7630564e-11f, 8.117754e-09f,
+		// PuOr
+		0.7753788f, 0.05230621f, 0.13422313f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.6757142f, 0.031419907f, -0.071500935f,
+		0.65122396f, 0.12922944f, 0.13146393f, 0.83064663f, 0.04404369f, 0.12156214f, 0.76008266f, 0.022018239f, -0.051234186f, 0.44461402f, 0.06599495f, -0.13005811f,
+		0.65122396f, 0.12922944f, 0.13146393f, 0.83064663f, 0.04404369f, 0.12156214f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.76008266f, 0.022018239f, -0.051234186f, 0.44461402f, 0.06599495f, -0.13005811f,
+		0.5615629f, 0.08624162f, 0.112112574f, 0.7753788f, 0.05230621f, 0.13422313f, 0.92121476f, 0.015367767f, 0.06200258f, 0.8919263f, 0.0042679734f, -0.022894826f, 0.6757142f, 0.031419907f, -0.071500935f, 0.38920456f, 0.07805637f, -0.1318413f,
+		0.5615629f, 0.08624162f, 0.112112574f, 0.7753788f, 0.05230621f, 0.13422313f, 0.92121476f, 0.015367767f, 0.06200258f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.8919263f, 0.0042679734f, -0.022894826f, 0.6757142f, 0.031419907f, -0.071500935f, 0.38920456f, 0.07805637f, -0.1318413f,
+		0.5615629f, 0.08624162f, 0.112112574f, 0.69393337f, 0.075160675f, 0.13675193f, 0.83064663f, 0.04404369f, 0.12156214f, 0.92121476f, 0.015367767f, 0.06200258f, 0.8919263f, 0.0042679734f, -0.022894826f, 0.76008266f, 0.022018239f, -0.051234186f, 0.58998084f, 0.035349425f, -0.07921213f, 0.38920456f, 0.07805637f, -0.1318413f,
+		0.5615629f, 0.08624162f, 0.112112574f, 0.69393337f, 0.075160675f, 0.13675193f, 0.83064663f, 0.04404369f, 0.12156214f, 0.92121476f, 0.015367767f, 0.06200258f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.8919263f, 0.0042679734f, -0.022894826f, 0.76008266f, 0.022018239f, -0.051234186f, 0.58998084f, 0.035349425f, -0.07921213f, 0.38920456f, 0.07805637f, -0.1318413f,
+		0.4345489f, 0.07053476f, 0.084254704f, 0.5615629f, 0.08624162f, 0.112112574f, 0.69393337f, 0.075160675f, 0.13675193f, 0.83064663f, 0.04404369f, 0.12156214f, 0.92121476f, 0.015367767f, 0.06200258f, 0.8919263f, 0.0042679734f, -0.022894826f, 0.76008266f, 0.022018239f, -0.051234186f, 0.58998084f, 0.035349425f, -0.07921213f, 0.38920456f, 0.07805637f, -0.1318413f, 0.23694353f, 0.07108042f, -0.10018105f,
+		0.4345489f, 0.07053476f, 0.084254704f, 0.5615629f, 0.08624162f, 0.112112574f, 0.69393337f, 0.075160675f, 0.13675193f, 0.83064663f, 0.04404369f, 0.12156214f, 0.92121476f, 0.015367767f, 0.06200258f, 0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.8919263f, 0.0042679734f, -0.022894826f, 0.76008266f, 0.022018239f, -0.051234186f, 0.58998084f, 0.035349425f, -0.07921213f, 0.38920456f, 0.07805637f, -0.1318413f, 0.23694353f, 0.07108042f, -0.10018105f,
+
+		// qualitative
+		// Set2
+		0.74887574f, -0.09743241f, 0.015739338f, 0.755034f, 0.109790765f, 0.097210765f, 0.7065586f, -0.004510863f, -0.066660374f,
+		0.74887574f, -0.09743241f, 0.015739338f, 0.755034f, 0.109790765f, 0.097210765f, 0.7065586f, -0.004510863f, -0.066660374f, 0.7483438f, 0.12686391f, -0.03810158f,
+		0.74887574f, -0.09743241f, 0.015739338f, 0.755034f, 0.109790765f, 0.097210765f, 0.7065586f, -0.004510863f, -0.066660374f, 0.7483438f, 0.12686391f, -0.03810158f, 0.8209136f, -0.10250421f, 0.13439079f,
+		0.74887574f, -0.09743241f, 0.015739338f, 0.755034f, 0.109790765f, 0.097210765f, 0.7065586f, -0.004510863f, -0.066660374f, 0.7483438f, 0.12686391f, -0.03810158f, 0.8209136f, -0.10250421f, 0.13439079f, 0.89183724f, -0.015698057f, 0.17232603f,
+		0.74887574f, -0.09743241f, 0.015739338f, 0.755034f, 0.109790765f, 0.097210765f, 0.7065586f, -0.004510863f, -0.066660374f, 0.7483438f, 0.12686391f, -0.03810158f, 0.8209136f, -0.10250421f, 0.13439079f, 0.89183724f, -0.015698057f, 0.17232603f, 0.83719003f, 0.016736971f, 0.07126333f,
+		0.74887574f, -0.09743241f, 0.015739338f, 0.755034f, 0.109790765f, 0.097210765f, 0.7065586f, -0.004510863f, -0.066660374f, 0.7483438f, 0.12686391f, -0.03810158f, 0.8209136f, -0.10250421f, 0.13439079f, 0.89183724f, -0.015698057f, 0.17232603f, 0.83719003f, 0.016736971f, 0.07126333f, 0.7667552f, 6.207107e-11f, 2.8579963e-08f,
+		// Accent
+		0.76877385f, -0.103309594f, 0.07447348f, 0.7767296f, 0.031510785f, -0.046297517f, 0.8504711f, 0.0442435f, 0.091963656f,
+		0.76877385f, -0.103309594f, 0.07447348f, 0.7767296f, 0.031510785f, -0.046297517f, 0.8504711f, 0.0442435f, 0.091963656f, 0.9783526f, -0.039475273f, 0.118012846f,
+		0.76877385f, -0.103309594f, 0.07447348f, 0.7767296f, 0.031510785f, -0.046297517f, 0.8504711f, 0.0442435f, 0.091963656f, 0.9783526f, -0.039475273f, 0.118012846f, 0.52896065f, -0.029331567f, -0.11759124f,
+		0.76877385f, -0.103309594f, 0.07447348f, 0.7767296f, 0.031510785f, -0.046297517f, 0.8504711f, 0.0442435f, 0.091963656f, 0.9783526f, -0.039475273f, 0.118012846f, 0.52896065f, -0.029331567f, -0.11759124f, 0.6188289f, 0.2501572f, 0.0009934332f,
+		0.76877385f, -0.103309594f, 0.07447348f, 0.7767296f, 0.031510785f, -0.046297517f, 0.8504711f, 0.0442435f, 0.091963656f, 0.9783526f, -0.039475273f, 0.118012846f, 0.52896065f, -0.029331567f, -0.11759124f, 0.6188289f, 0.2501572f, 0.0009934332f, 0.58466876f, 0.09773539f, 0.11108927f,
+		0.76877385f, -0.103309594f, 0.07447348f, 0.7767296f, 0.031510785f, -0.046297517f, 0.8504711f, 0.0442435f, 0.091963656f, 0.9783526f, -0.039475273f, 0.118012846f, 0.52896065f, -0.029331567f, -0.11759124f, 0.6188289f, 0.2501572f, 0.0009934332f, 0.58466876f, 0.09773539f, 0.11108927f, 0.51027834f, 4.1308457e-11f, 1.9020069e-08f,
+		// Set1
+		0.5850235f, 0.20200258f, 0.10712331f, 0.5748218f, -0.045921702f, -0.10464368f, 0.6726781f, -0.1334466f, 0.10077617f,
+		0.5850235f, 0.20200258f, 0.10712331f, 0.5748218f, -0.045921702f, -0.10464368f, 0.6726781f, -0.1334466f, 0.10077617f, 0.5469345f, 0.11798543f, -0.09119296f,
+		0.5850235f, 0.20200258f, 0.10712331f, 0.5748218f, -0.045921702f, -0.10464368f, 0.6726781f, -0.1334466f, 0.10077617f, 0.5469345f, 0.11798543f, -0.09119296f, 0.7303931f, 0.1133142f, 0.14803626f,
+		0.5850235f, 0.20200258f, 0.10712331f, 0.5748218f, -0.045921702f, -0.10464368f, 0.6726781f, -0.1334466f, 0.10077617f, 0.5469345f, 0.11798543f, -0.09119296f, 0.7303931f, 0.1133142f, 0.14803626f, 0.96906567f, -0.067340314f, 0.18887573f,
+		0.5850235f, 0.20200258f, 0.10712331f, 0.5748218f, -0.045921702f, -0.10464368f, 0.6726781f, -0.1334466f, 0.10077617f, 0.5469345f, 0.11798543f, -0.09119296f, 0.7303931f, 0.1133142f, 0.14803626f, 0.96906567f, -0.067340314f, 0.18887573f, 0.54132736f, 0.080805056f, 0.089567155f,
+		0.5850235f, 0.20200258f, 0.10712331f, 0.5748218f, -0.045921702f, -0.10464368f, 0.6726781f, -0.1334466f, 0.10077617f, 0.5469345f, 0.11798543f, -0.09119296f, 0.7303931f, 0.1133142f, 0.14803626f, 0.96906567f, -0.067340314f, 0.18887573f, 0.54132736f, 0.080805056f, 0.089567155f, 0.75287116f, 0.15645598f, -0.030843463f,
+		0.5850235f, 0.20200258f, 0.10712331f, 0.5748218f, -0.045921702f, -0.10464368f, 0.6726781f, -0.1334466f, 0.10077617f, 0.5469345f, 0.11798543f, -0.09119296f, 0.7303931f, 0.1133142f, 0.14803626f, 0.96906567f, -0.067340314f, 0.18887573f, 0.54132736f, 0.080805056f, 0.089567155f, 0.75287116f, 0.15645598f, -0.030843463f, 0.6829534f, 5.5286997e-11f, 2.5456341e-08f,
+		// Set3
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f, 0.8231893f, 0.049907062f, 0.12009288f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f, 0.8231893f, 0.049907062f, 0.12009288f, 0.8454664f, -0.09035437f, 0.12336579f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f, 0.8231893f, 0.049907062f, 0.12009288f, 0.8454664f, -0.09035437f, 0.12336579f, 0.89577115f, 0.059375636f, -0.014503376f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f, 0.8231893f, 0.049907062f, 0.12009288f, 0.8454664f, -0.09035437f, 0.12336579f, 0.89577115f, 0.059375636f, -0.014503376f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f, 0.8231893f, 0.049907062f, 0.12009288f, 0.8454664f, -0.09035437f, 0.12336579f, 0.89577115f, 0.059375636f, -0.014503376f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f, 0.68118745f, 0.091579735f, -0.061423592f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f, 0.8231893f, 0.049907062f, 0.12009288f, 0.8454664f, -0.09035437f, 0.12336579f, 0.89577115f, 0.059375636f, -0.014503376f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f, 0.68118745f, 0.091579735f, -0.061423592f, 0.9075425f, -0.046276104f, 0.03895616f,
+		0.8169909f, -0.07243121f, -0.0031916245f, 0.98261553f, -0.029558927f, 0.090783276f, 0.80247563f, 0.016173767f, -0.04194961f, 0.73633945f, 0.13474147f, 0.07173475f, 0.7380837f, -0.03665949f, -0.061625674f, 0.8231893f, 0.049907062f, 0.12009288f, 0.8454664f, -0.09035437f, 0.12336579f, 0.89577115f, 0.059375636f, -0.014503376f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f, 0.68118745f, 0.091579735f, -0.061423592f, 0.9075425f, -0.046276104f, 0.03895616f, 0.9365917f, -0.02868794f, 0.14411281f,
+		// Dark2
+		0.6232795f, -0.11880339f, 0.02805141f, 0.6287904f, 0.11823225f, 0.12675461f, 0.5780286f, 0.028305465f, -0.09763377f,
+		0.6232795f, -0.11880339f, 0.02805141f, 0.6287904f, 0.11823225f, 0.12675461f, 0.5780286f, 0.028305465f, -0.09763377f, 0.61941487f, 0.23108535f, -0.015517129f,
+		0.6232795f, -0.11880339f, 0.02805141f, 0.6287904f, 0.11823225f, 0.12675461f, 0.5780286f, 0.028305465f, -0.09763377f, 0.61941487f, 0.23108535f, -0.015517129f, 0.6570374f, -0.116798386f, 0.12728788f,
+		0.6232795f, -0.11880339f, 0.02805141f, 0.6287904f, 0.11823225f, 0.12675461f, 0.5780286f, 0.028305465f, -0.09763377f, 0.61941487f, 0.23108535f, -0.015517129f, 0.6570374f, -0.116798386f, 0.12728788f, 0.7754215f, 0.018005054f, 0.15797752f,
+		0.6232795f, -0.11880339f, 0.02805141f, 0.6287904f, 0.11823225f, 0.12675461f, 0.5780286f, 0.028305465f, -0.09763377f, 0.61941487f, 0.23108535f, -0.015517129f, 0.6570374f, -0.116798386f, 0.12728788f, 0.7754215f, 0.018005054f, 0.15797752f, 0.59989494f, 0.025020616f, 0.11265017f,
+		0.6232795f, -0.11880339f, 0.02805141f, 0.6287904f, 0.11823225f, 0.12675461f, 0.5780286f, 0.028305465f, -0.09763377f, 0.61941487f, 0.23108535f, -0.015517129f, 0.6570374f, -0.116798386f, 0.12728788f, 0.7754215f, 0.018005054f, 0.15797752f, 0.59989494f, 0.025020616f, 0.11265017f, 0.51027834f, 4.1308457e-11f, 1.9020069e-08f,
+		// Paired
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f, 0.58316755f, 0.20128775f, 0.10669022f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f, 0.58316755f, 0.20128775f, 0.10669022f, 0.84515667f, 0.03734059f, 0.1147776f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f, 0.58316755f, 0.20128775f, 0.10669022f, 0.84515667f, 0.03734059f, 0.1147776f, 0.7303931f, 0.1133142f, 0.14803626f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f, 0.58316755f, 0.20128775f, 0.10669022f, 0.84515667f, 0.03734059f, 0.1147776f, 0.7303931f, 0.1133142f, 0.14803626f, 0.79552656f, 0.039548483f, -0.040268905f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f, 0.58316755f, 0.20128775f, 0.10669022f, 0.84515667f, 0.03734059f, 0.1147776f, 0.7303931f, 0.1133142f, 0.14803626f, 0.79552656f, 0.039548483f, -0.040268905f, 0.46019414f, 0.08130104f, -0.123332255f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f, 0.58316755f, 0.20128775f, 0.10669022f, 0.84515667f, 0.03734059f, 0.1147776f, 0.7303931f, 0.1133142f, 0.14803626f, 0.79552656f, 0.039548483f, -0.040268905f, 0.46019414f, 0.08130104f, -0.123332255f, 0.9783526f, -0.039475273f, 0.118012846f,
+		0.82961524f, -0.03242567f, -0.040082254f, 0.55163074f, -0.053987753f, -0.11043085f, 0.85187536f, -0.080023155f, 0.09119035f, 0.6210738f, -0.14357866f, 0.11125118f, 0.78531194f, 0.109168865f, 0.041196086f, 0.58316755f, 0.20128775f, 0.10669022f, 0.84515667f, 0.03734059f, 0.1147776f, 0.7303931f, 0.1133142f, 0.14803626f, 0.79552656f, 0.039548483f, -0.040268905f, 0.46019414f, 0.08130104f, -0.123332255f, 0.9783526f, -0.039475273f, 0.118012846f, 0.5621933f, 0.08877883f, 0.095056295f,
+		// Pastel2
+		0.873903f, -0.055024046f, 0.013670583f, 0.8819957f, 0.03899153f, 0.05813101f, 0.8712038f, -0.0032581422f, -0.02824555f,
+		0.873903f, -0.055024046f, 0.013670583f, 0.8819957f, 0.03899153f, 0.05813101f, 0.8712038f, -0.0032581422f, -0.02824555f, 0.8826578f, 0.05480205f, -0.01913933f,
+		0.873903f, -0.055024046f, 0.013670583f, 0.8819957f, 0.03899153f, 0.05813101f, 0.8712038f, -0.0032581422f, -0.02824555f, 0.8826578f, 0.05480205f, -0.01913933f, 0.9477777f, -0.032422565f, 0.05022542f,
+		0.873903f, -0.055024046f, 0.013670583f, 0.8819957f, 0.03899153f, 0.05813101f, 0.8712038f, -0.0032581422f, -0.02824555f, 0.8826578f, 0.05480205f, -0.01913933f, 0.9477777f, -0.032422565f, 0.05022542f, 0.9557363f, -0.013042293f, 0.08601665f,
+		0.873903f, -0.055024046f, 0.013670583f, 0.8819957f, 0.03899153f, 0.05813101f, 0.8712038f, -0.0032581422f, -0.02824555f, 0.8826578f, 0.05480205f, -0.01913933f, 0.9477777f, -0.032422565f, 0.05022542f, 0.9557363f, -0.013042293f, 0.08601665f, 0.9189945f, 0.007207138f, 0.03275646f,
+		0.873903f, -0.055024046f, 0.013670583f, 0.8819957f, 0.03899153f, 0.05813101f, 0.8712038f, -0.0032581422f, -0.02824555f, 0.8826578f, 0.05480205f, -0.01913933f, 0.9477777f, -0.032422565f, 0.05022542f, 0.9557363f, -0.013042293f, 0.08601665f, 0.9189945f, 0.007207138f, 0.03275646f, 0.84522223f, 6.8423045e-11f, 3.1504737e-08f,
+		// Pastel1
+		0.83479685f, 0.0762879f, 0.03466714f, 0.8360793f, -0.018428544f, -0.03744453f, 0.9075425f, -0.046276104f, 0.03895616f,
+		0.83479685f, 0.0762879f, 0.03466714f, 0.8360793f, -0.018428544f, -0.03744453f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8652659f, 0.029525341f, -0.026541023f,
+		0.83479685f, 0.0762879f, 0.03466714f, 0.8360793f, -0.018428544f, -0.03744453f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8652659f, 0.029525341f, -0.026541023f, 0.90449905f, 0.019532373f, 0.075068064f,
+		0.83479685f, 0.0762879f, 0.03466714f, 0.8360793f, -0.018428544f, -0.03744453f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8652659f, 0.029525341f, -0.026541023f, 0.90449905f, 0.019532373f, 0.075068064f, 0.98751295f, -0.019712258f, 0.062367894f,
+		0.83479685f, 0.0762879f, 0.03466714f, 0.8360793f, -0.018428544f, -0.03744453f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8652659f, 0.029525341f, -0.026541023f, 0.90449905f, 0.019532373f, 0.075068064f, 0.98751295f, -0.019712258f, 0.062367894f, 0.88564706f, 0.0031464084f, 0.038612653f,
+		0.83479685f, 0.0762879f, 0.03466714f, 0.8360793f, -0.018428544f, -0.03744453f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8652659f, 0.029525341f, -0.026541023f, 0.90449905f, 0.019532373f, 0.075068064f, 0.98751295f, -0.019712258f, 0.062367894f, 0.88564706f, 0.0031464084f, 0.038612653f, 0.9226295f, 0.04372582f, -0.011210137f,
+		0.83479685f, 0.0762879f, 0.03466714f, 0.8360793f, -0.018428544f, -0.03744453f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8652659f, 0.029525341f, -0.026541023f, 0.90449905f, 0.019532373f, 0.075068064f, 0.98751295f, -0.019712258f, 0.062367894f, 0.88564706f, 0.0031464084f, 0.038612653f, 0.9226295f, 0.04372582f, -0.011210137f, 0.96115136f, 7.780798e-11f, 3.5825867e-08f,
+
+		// sequential
+		// OrRd
+		0.94063425f, 0.010655849f, 0.047131497f, 0.84090763f, 0.051258985f, 0.090643674f, 0.62100136f, 0.16498396f, 0.10069965f,
+		0.96016896f, 0.00569065f, 0.033330508f, 0.87368494f, 0.027291443f, 0.096144915f, 0.7538001f, 0.10663972f, 0.106082395f, 0.5744319f, 0.17728351f, 0.10313862f,
+		0.96016896f, 0.00569065f, 0.033330508f, 0.87368494f, 0.027291443f, 0.096144915f, 0.7538001f, 0.10663972f, 0.106082395f, 0.62100136f, 0.16498396f, 0.10069965f, 0.48148805f, 0.17241493f, 0.096493304f,
+		0.96016896f, 0.00569065f, 0.033330508f, 0.8924627f, 0.022846088f, 0.08000741f, 0.84090763f, 0.051258985f, 0.090643674f, 0.7538001f, 0.10663972f, 0.106082395f, 0.62100136f, 0.16498396f, 0.10069965f, 0.48148805f, 0.17241493f, 0.096493304f,
+		0.96016896f, 0.00569065f, 0.033330508f, 0.8924627f, 0.022846088f, 0.08000741f, 0.84090763f, 0.051258985f, 0.090643674f, 0.7538001f, 0.10663972f, 0.106082395f, 0.67477113f, 0.14722672f, 0.097506136f, 0.5744319f, 0.17728351f, 0.10313862f, 0.42886424f, 0.153571f, 0.085947156f,
+		0.9793599f, 0.0040509696f, 0.016387857f, 0.94063425f, 0.010655849f, 0.047131497f, 0.8924627f, 0.022846088f, 0.08000741f, 0.84090763f, 0.051258985f, 0.090643674f, 0.7538001f, 0.10663972f, 0.106082395f, 0.67477113f, 0.14722672f, 0.097506136f, 0.5744319f, 0.17728351f, 0.10313862f, 0.42886424f, 0.153571f, 0.085947156f,
+		0.9793599f, 0.0040509696f, 0.016387857f, 0.94063425f, 0.010655849f, 0.047131497f, 0.8924627f, 0.022846088f, 0.08000741f, 0.84090763f, 0.051258985f, 0.090643674f, 0.7538001f, 0.10663972f, 0.106082395f, 0.67477113f, 0.14722672f, 0.097506136f, 0.5744319f, 0.17728351f, 0.10313862f, 0.48148805f, 0.17241493f, 0.096493304f, 0.37456876f, 0.13412845f, 0.07506599f,
+		// PuBu
+		0.9350434f, 0.009263237f, -0.012562283f, 0.7910176f, -0.012742773f, -0.04804697f, 0.607644f, -0.06409486f, -0.09576031f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.8342847f, -0.003549424f, -0.035932768f, 0.7120398f, -0.038965035f, -0.068728045f, 0.52636415f, -0.055501617f, -0.117811784f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.8342847f, -0.003549424f, -0.035932768f, 0.7120398f, -0.038965035f, -0.068728045f, 0.607644f, -0.06409486f, -0.09576031f, 0.45042995f, -0.04793485f, -0.098226994f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7120398f, -0.038965035f, -0.068728045f, 0.607644f, -0.06409486f, -0.09576031f, 0.45042995f, -0.04793485f, -0.098226994f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7120398f, -0.038965035f, -0.068728045f, 0.62113494f, -0.06186005f, -0.09181101f, 0.52636415f, -0.055501617f, -0.117811784f, 0.4082867f, -0.043487865f, -0.08886917f,
+		0.9834359f, 0.0096673705f, -0.002516747f, 0.9350434f, 0.009263237f, -0.012562283f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7120398f, -0.038965035f, -0.068728045f, 0.62113494f, -0.06186005f, -0.09181101f, 0.52636415f, -0.055501617f, -0.117811784f, 0.4082867f, -0.043487865f, -0.08886917f,
+		0.9834359f, 0.0096673705f, -0.002516747f, 0.9350434f, 0.009263237f, -0.012562283f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7120398f, -0.038965035f, -0.068728045f, 0.62113494f, -0.06186005f, -0.09181101f, 0.52636415f, -0.055501617f, -0.117811784f, 0.45042995f, -0.04793485f, -0.098226994f, 0.32673335f, -0.035487924f, -0.0676732f,
+		// BuPu
+		0.9364281f, -0.009224381f, -0.014040878f, 0.7831154f, -0.019761007f, -0.05021194f, 0.54232484f, 0.087019995f, -0.0994477f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.8360793f, -0.018428544f, -0.03744453f, 0.6828263f, 0.006535271f, -0.071543604f, 0.50468916f, 0.115615286f, -0.10438209f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.8360793f, -0.018428544f, -0.03744453f, 0.6828263f, 0.006535271f, -0.071543604f, 0.54232484f, 0.087019995f, -0.0994477f, 0.42589843f, 0.1590575f, -0.09054856f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.8578069f, -0.013444131f, -0.03142598f, 0.7831154f, -0.019761007f, -0.05021194f, 0.6828263f, 0.006535271f, -0.071543604f, 0.54232484f, 0.087019995f, -0.0994477f, 0.42589843f, 0.1590575f, -0.09054856f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.8578069f, -0.013444131f, -0.03142598f, 0.7831154f, -0.019761007f, -0.05021194f, 0.6828263f, 0.006535271f, -0.071543604f, 0.58848315f, 0.06287964f, -0.089940906f, 0.50468916f, 0.115615286f, -0.10438209f, 0.37610823f, 0.14753385f, -0.0859992f,
+		0.9875908f, -0.0046863738f, -0.0028202157f, 0.9364281f, -0.009224381f, -0.014040878f, 0.8578069f, -0.013444131f, -0.03142598f, 0.7831154f, -0.019761007f, -0.05021194f, 0.6828263f, 0.006535271f, -0.071543604f, 0.58848315f, 0.06287964f, -0.089940906f, 0.50468916f, 0.115615286f, -0.10438209f, 0.37610823f, 0.14753385f, -0.0859992f,
+		0.9875908f, -0.0046863738f, -0.0028202157f, 0.9364281f, -0.009224381f, -0.014040878f, 0.8578069f, -0.013444131f, -0.03142598f, 0.7831154f, -0.019761007f, -0.05021194f, 0.6828263f, 0.006535271f, -0.071543604f, 0.58848315f, 0.06287964f, -0.089940906f, 0.50468916f, 0.115615286f, -0.10438209f, 0.42589843f, 0.1590575f, -0.09054856f, 0.2934265f, 0.11561545f, -0.06772645f,
+		// Oranges
+		0.9381728f, 0.015929509f, 0.038059544f, 0.8135084f, 0.06236146f, 0.108043686f, 0.6361087f, 0.14641185f, 0.12540768f,
+		0.9556044f, 0.011940937f, 0.02443614f, 0.8466f, 0.046968598f, 0.09164776f, 0.7520499f, 0.09898283f, 0.13013078f, 0.59838426f, 0.15015262f, 0.120387584f,
+		0.9556044f, 0.011940937f, 0.02443614f, 0.8466f, 0.046968598f, 0.09164776f, 0.7520499f, 0.09898283f, 0.13013078f, 0.6361087f, 0.14641185f, 0.12540768f, 0.49232817f, 0.12106198f, 0.0981519f,
+		0.9556044f, 0.011940937f, 0.02443614f, 0.88560516f, 0.030485038f, 0.07232565f, 0.8135084f, 0.06236146f, 0.108043686f, 0.7520499f, 0.09898283f, 0.13013078f, 0.6361087f, 0.14641185f, 0.12540768f, 0.49232817f, 0.12106198f, 0.0981519f,
+		0.9556044f, 0.011940937f, 0.02443614f, 0.88560516f, 0.030485038f, 0.07232565f, 0.8135084f, 0.06236146f, 0.108043686f, 0.7520499f, 0.09898283f, 0.13013078f, 0.67909205f, 0.13123485f, 0.1331505f, 0.59949976f, 0.1489337f, 0.120630346f, 0.4356966f, 0.10609605f, 0.0859511f,
+		0.9752245f, 0.0065030614f, 0.0157976f, 0.9381728f, 0.015929509f, 0.038059544f, 0.88560516f, 0.030485038f, 0.07232565f, 0.8135084f, 0.06236146f, 0.108043686f, 0.7520499f, 0.09898283f, 0.13013078f, 0.67909205f, 0.13123485f, 0.1331505f, 0.59949976f, 0.1489337f, 0.120630346f, 0.4356966f, 0.10609605f, 0.0859511f,
+		0.9752245f, 0.0065030614f, 0.0157976f, 0.9381728f, 0.015929509f, 0.038059544f, 0.88560516f, 0.030485038f, 0.07232565f, 0.8135084f, 0.06236146f, 0.108043686f, 0.7520499f, 0.09898283f, 0.13013078f, 0.67909205f, 0.13123485f, 0.1331505f, 0.59949976f, 0.1489337f, 0.120630346f, 0.49232817f, 0.12106198f, 0.0981519f, 0.40477973f, 0.10043041f, 0.07939062f,
+		// BuGn
+		0.9594689f, -0.014643771f, -0.010018516f, 0.8353523f, -0.067480445f, 0.002237197f, 0.63165367f, -0.12874308f, 0.06400164f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.8793333f, -0.04751069f, -0.01388117f, 0.7485996f, -0.09788379f, 0.017063757f, 0.56224865f, -0.1211791f, 0.070833415f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.8793333f, -0.04751069f, -0.01388117f, 0.7485996f, -0.09788379f, 0.017063757f, 0.63165367f, -0.12874308f, 0.06400164f, 0.46686682f, -0.112978846f, 0.067974776f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.9183077f, -0.034369633f, -0.0017952825f, 0.8353523f, -0.067480445f, 0.002237197f, 0.7485996f, -0.09788379f, 0.017063757f, 0.63165367f, -0.12874308f, 0.06400164f, 0.46686682f, -0.112978846f, 0.067974776f,
+		0.9717853f, -0.009995031f, -0.00721456f, 0.9183077f, -0.034369633f, -0.0017952825f, 0.8353523f, -0.067480445f, 0.002237197f, 0.7485996f, -0.09788379f, 0.017063757f, 0.6736087f, -0.12034497f, 0.05004138f, 0.56224865f, -0.1211791f, 0.070833415f, 0.4022374f, -0.09639701f, 0.05643688f,
+		0.9875908f, -0.0046863738f, -0.0028202157f, 0.9594689f, -0.014643771f, -0.010018516f, 0.9183077f, -0.034369633f, -0.0017952825f, 0.8353523f, -0.067480445f, 0.002237197f, 0.7485996f, -0.09788379f, 0.017063757f, 0.6736087f, -0.12034497f, 0.05004138f, 0.56224865f, -0.1211791f, 0.070833415f, 0.4022374f, -0.09639701f, 0.05643688f,
+		0.9875908f, -0.0046863738f, -0.0028202157f, 0.9594689f, -0.014643771f, -0.010018516f, 0.9183077f, -0.034369633f, -0.0017952825f, 0.8353523f, -0.067480445f, 0.002237197f, 0.7485996f, -0.09788379f, 0.017063757f, 0.6736087f, -0.12034497f, 0.05004138f, 0.56224865f, -0.1211791f, 0.070833415f, 0.46686682f, -0.112978846f, 0.067974776f, 0.3379472f, -0.080563754f, 0.04645098f,
+		// YlOrBr
+		0.9683326f, -0.01470508f, 0.07422566f, 0.85211396f, 0.020804374f, 0.14449075f, 0.62909293f, 0.119321994f, 0.12395954f,
+		0.9892488f, -0.016553028f, 0.05291255f, 0.9002576f, 0.010258005f, 0.1015144f, 0.7718723f, 0.077698745f, 0.14618474f, 0.58299285f, 0.13089691f, 0.1171739f,
+		0.9892488f, -0.016553028f, 0.05291255f, 0.9002576f, 0.010258005f, 0.1015144f, 0.7718723f, 0.077698745f, 0.14618474f, 0.62909293f, 0.119321994f, 0.12395954f, 0.4673663f, 0.11032783f, 0.09263042f,
+		0.9892488f, -0.016553028f, 0.05291255f, 0.9202811f, -0.003445567f, 0.105590776f, 0.85211396f, 0.020804374f, 0.14449075f, 0.7718723f, 0.077698745f, 0.14618474f, 0.62909293f, 0.119321994f, 0.12395954f, 0.4673663f, 0.11032783f, 0.09263042f,
+		0.9892488f, -0.016553028f, 0.05291255f, 0.9202811f, -0.003445567f, 0.105590776f, 0.85211396f, 0.020804374f, 0.14449075f, 0.7718723f, 0.077698745f, 0.14618474f, 0.68176067f, 0.11596108f, 0.1336119f, 0.58299285f, 0.13089691f, 0.1171739f, 0.4356966f, 0.10609605f, 0.0859511f,
+		0.9932119f, -0.009893268f, 0.032359157f, 0.9683326f, -0.01470508f, 0.07422566f, 0.9202811f, -0.003445567f, 0.105590776f, 0.85211396f, 0.020804374f, 0.14449075f, 0.7718723f, 0.077698745f, 0.14618474f, 0.68176067f, 0.11596108f, 0.1336119f, 0.58299285f, 0.13089691f, 0.1171739f, 0.4356966f, 0.10609605f, 0.0859511f,
+		0.9932119f, -0.009893268f, 0.032359157f, 0.9683326f, -0.01470508f, 0.07422566f, 0.9202811f, -0.003445567f, 0.105590776f, 0.85211396f, 0.020804374f, 0.14449075f, 0.7718723f, 0.077698745f, 0.14618474f, 0.68176067f, 0.11596108f, 0.1336119f, 0.58299285f, 0.13089691f, 0.1171739f, 0.4673663f, 0.11032783f, 0.09263042f, 0.3569883f, 0.07566961f, 0.06790505f,
+		// YlGn
+		0.97147906f, -0.031248076f, 0.0795492f, 0.84485435f, -0.080581106f, 0.084059745f, 0.6335649f, -0.13259171f, 0.077880494f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.88068104f, -0.067536294f, 0.08404594f, 0.7568391f, -0.10810622f, 0.077409014f, 0.54241097f, -0.11494335f, 0.06635489f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.88068104f, -0.067536294f, 0.08404594f, 0.7568391f, -0.10810622f, 0.077409014f, 0.6335649f, -0.13259171f, 0.077880494f, 0.45391306f, -0.102978714f, 0.050393034f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.9201534f, -0.054028474f, 0.08666789f, 0.84485435f, -0.080581106f, 0.084059745f, 0.7568391f, -0.10810622f, 0.077409014f, 0.6335649f, -0.13259171f, 0.077880494f, 0.45391306f, -0.102978714f, 0.050393034f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.9201534f, -0.054028474f, 0.08666789f, 0.84485435f, -0.080581106f, 0.084059745f, 0.7568391f, -0.10810622f, 0.077409014f, 0.6608753f, -0.12868004f, 0.076784395f, 0.54241097f, -0.11494335f, 0.06635489f, 0.41096783f, -0.09142444f, 0.041405264f,
+		0.9932119f, -0.009893268f, 0.032359157f, 0.97147906f, -0.031248076f, 0.0795492f, 0.9201534f, -0.054028474f, 0.08666789f, 0.84485435f, -0.080581106f, 0.084059745f, 0.7568391f, -0.10810622f, 0.077409014f, 0.6608753f, -0.12868004f, 0.076784395f, 0.54241097f, -0.11494335f, 0.06635489f, 0.41096783f, -0.09142444f, 0.041405264f,
+		0.9932119f, -0.009893268f, 0.032359157f, 0.97147906f, -0.031248076f, 0.0795492f, 0.9201534f, -0.054028474f, 0.08666789f, 0.84485435f, -0.080581106f, 0.084059745f, 0.7568391f, -0.10810622f, 0.077409014f, 0.6608753f, -0.12868004f, 0.076784395f, 0.54241097f, -0.11494335f, 0.06635489f, 0.45391306f, -0.102978714f, 0.050393034f, 0.3440684f, -0.074142545f, 0.029008674f,
+		// Reds
+		0.9276698f, 0.026302816f, 0.027817987f, 0.76558334f, 0.107875824f, 0.08305266f, 0.5852682f, 0.18722731f, 0.100954086f,
+		0.938972f, 0.021640752f, 0.0234964f, 0.8188176f, 0.07557462f, 0.06618208f, 0.6994008f, 0.15274043f, 0.102931395f, 0.5374584f, 0.18520238f, 0.0951457f,
+		0.938972f, 0.021640752f, 0.0234964f, 0.8188176f, 0.07557462f, 0.06618208f, 0.6994008f, 0.15274043f, 0.102931395f, 0.5852682f, 0.18722731f, 0.100954086f, 0.4596762f, 0.15992278f, 0.08160526f,
+		0.938972f, 0.021640752f, 0.0234964f, 0.84540987f, 0.061405364f, 0.056783244f, 0.76558334f, 0.107875824f, 0.08305266f, 0.6994008f, 0.15274043f, 0.102931395f, 0.5852682f, 0.18722731f, 0.100954086f, 0.4596762f, 0.15992278f, 0.08160526f,
+		0.938972f, 0.021640752f, 0.0234964f, 0.84540987f, 0.061405364f, 0.056783244f, 0.76558334f, 0.107875824f, 0.08305266f, 0.6994008f, 0.15274043f, 0.102931395f, 0.626309f, 0.18981639f, 0.10719728f, 0.5374584f, 0.18520238f, 0.0951457f, 0.42957255f, 0.15599254f, 0.07945493f,
+		0.9765539f, 0.008391938f, 0.009516745f, 0.9276698f, 0.026302816f, 0.027817987f, 0.84540987f, 0.061405364f, 0.056783244f, 0.76558334f, 0.107875824f, 0.08305266f, 0.6994008f, 0.15274043f, 0.102931395f, 0.626309f, 0.18981639f, 0.10719728f, 0.5374584f, 0.18520238f, 0.0951457f, 0.42957255f, 0.15599254f, 0.07945493f,
+		0.9765539f, 0.008391938f, 0.009516745f, 0.9276698f, 0.026302816f, 0.027817987f, 0.84540987f, 0.061405364f, 0.056783244f, 0.76558334f, 0.107875824f, 0.08305266f, 0.6994008f, 0.15274043f, 0.102931395f, 0.626309f, 0.18981639f, 0.10719728f, 0.5374584f, 0.18520238f, 0.0951457f, 0.4596762f, 0.15992278f, 0.08160526f, 0.32388976f, 0.11956963f, 0.053637173f,
+		// RdPu
+		0.92965084f, 0.029421434f, 0.013592628f, 0.7996048f, 0.11065089f, 0.008093122f, 0.55452067f, 0.21434839f, -0.047544118f,
+		0.95278656f, 0.016354537f, 0.01761115f, 0.83758163f, 0.08045681f, 0.020555697f, 0.70966446f, 0.1830431f, -0.006593958f, 0.50064147f, 0.20519014f, -0.054577377f,
+		0.95278656f, 0.016354537f, 0.01761115f, 0.83758163f, 0.08045681f, 0.020555697f, 0.70966446f, 0.1830431f, -0.006593958f, 0.55452067f, 0.21434839f, -0.047544118f, 0.4050384f, 0.15894249f, -0.09311167f,
+		0.95278656f, 0.016354537f, 0.01761115f, 0.8708903f, 0.057916656f, 0.026326157f, 0.7996048f, 0.11065089f, 0.008093122f, 0.70966446f, 0.1830431f, -0.006593958f, 0.55452067f, 0.21434839f, -0.047544118f, 0.4050384f, 0.15894249f, -0.09311167f,
+		0.95278656f, 0.016354537f, 0.01761115f, 0.8708903f, 0.057916656f, 0.026326157f, 0.7996048f, 0.11065089f, 0.008093122f, 0.70966446f, 0.1830431f, -0.006593958f, 0.6147493f, 0.21772337f, -0.038598277f, 0.50064147f, 0.20519014f, -0.054577377f, 0.4050384f, 0.15894249f, -0.09311167f,
+		0.9812246f, 0.006694199f, 0.0075998413f, 0.92965084f, 0.029421434f, 0.013592628f, 0.8708903f, 0.057916656f, 0.026326157f, 0.7996048f, 0.11065089f, 0.008093122f, 0.70966446f, 0.1830431f, -0.006593958f, 0.6147493f, 0.21772337f, -0.038598277f, 0.50064147f, 0.20519014f, -0.054577377f, 0.4050384f, 0.15894249f, -0.09311167f,
+		0.9812246f, 0.006694199f, 0.0075998413f, 0.92965084f, 0.029421434f, 0.013592628f, 0.8708903f, 0.057916656f, 0.026326157f, 0.7996048f, 0.11065089f, 0.008093122f, 0.70966446f, 0.1830431f, -0.006593958f, 0.6147493f, 0.21772337f, -0.038598277f, 0.50064147f, 0.20519014f, -0.054577377f, 0.4050384f, 0.15894249f, -0.09311167f, 0.3123799f, 0.10185235f, -0.12055906f,
+		// Greens
+		0.9525981f, -0.024253964f, 0.021676581f, 0.83086133f, -0.08119494f, 0.06297774f, 0.6335649f, -0.13259171f, 0.077880494f,
+		0.9668218f, -0.016841905f, 0.015571035f, 0.87626964f, -0.061853737f, 0.049958393f, 0.7494423f, -0.110270865f, 0.078341246f, 0.56224865f, -0.1211791f, 0.070833415f,
+		0.9668218f, -0.016841905f, 0.015571035f, 0.87626964f, -0.061853737f, 0.049958393f, 0.7494423f, -0.110270865f, 0.078341246f, 0.6335649f, -0.13259171f, 0.077880494f, 0.46686682f, -0.112978846f, 0.067974776f,
+		0.9668218f, -0.016841905f, 0.015571035f, 0.8987001f, -0.050532073f, 0.041948196f, 0.83086133f, -0.08119494f, 0.06297774f, 0.7494423f, -0.110270865f, 0.078341246f, 0.6335649f, -0.13259171f, 0.077880494f, 0.46686682f, -0.112978846f, 0.067974776f,
+		0.9668218f, -0.016841905f, 0.015571035f, 0.8987001f, -0.050532073f, 0.041948196f, 0.83086133f, -0.08119494f, 0.06297774f, 0.7494423f, -0.110270865f, 0.078341246f, 0.6608753f, -0.12868004f, 0.076784395f, 0.56224865f, -0.1211791f, 0.070833415f, 0.41096783f, -0.09142444f, 0.041405264f,
+		0.9853776f, -0.00769026f, 0.007282905f, 0.9525981f, -0.024253964f, 0.021676581f, 0.8987001f, -0.050532073f, 0.041948196f, 0.83086133f, -0.08119494f, 0.06297774f, 0.7494423f, -0.110270865f, 0.078341246f, 0.6608753f, -0.12868004f, 0.076784395f, 0.56224865f, -0.1211791f, 0.070833415f, 0.41096783f, -0.09142444f, 0.041405264f,
+		0.9853776f, -0.00769026f, 0.007282905f, 0.9525981f, -0.024253964f, 0.021676581f, 0.8987001f, -0.050532073f, 0.041948196f, 0.83086133f, -0.08119494f, 0.06297774f, 0.7494423f, -0.110270865f, 0.078341246f, 0.6608753f, -0.12868004f, 0.076784395f, 0.56224865f, -0.1211791f, 0.070833415f, 0.46686682f, -0.112978846f, 0.067974776f, 0.3379472f, -0.080563754f, 0.04645098f,
+		// YlGnBu
+		0.9541905f, -0.039106477f, 0.08264374f, 0.79256845f, -0.08175068f, 0.003240627f, 0.5737297f, -0.053236872f, -0.10491312f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.8388117f, -0.07175323f, 0.03320863f, 0.7171416f, -0.09315331f, -0.046285287f, 0.48372543f, -0.032955285f, -0.12950143f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.8388117f, -0.07175323f, 0.03320863f, 0.7171416f, -0.09315331f, -0.046285287f, 0.5737297f, -0.053236872f, -0.10491312f, 0.37948954f, 0.00018679441f, -0.15737368f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.8959807f, -0.055503353f, 0.056537915f, 0.79256845f, -0.08175068f, 0.003240627f, 0.7171416f, -0.09315331f, -0.046285287f, 0.5737297f, -0.053236872f, -0.10491312f, 0.37948954f, 0.00018679441f, -0.15737368f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.8959807f, -0.055503353f, 0.056537915f, 0.79256845f, -0.08175068f, 0.003240627f, 0.7171416f, -0.09315331f, -0.046285287f, 0.61792475f, -0.07322941f, -0.093055956f, 0.48372543f, -0.032955285f, -0.12950143f, 0.3382748f, -0.015367503f, -0.15094517f,
+		0.9903756f, -0.014584442f, 0.04692826f, 0.9541905f, -0.039106477f, 0.08264374f, 0.8959807f, -0.055503353f, 0.056537915f, 0.79256845f, -0.08175068f, 0.003240627f, 0.7171416f, -0.09315331f, -0.046285287f, 0.61792475f, -0.07322941f, -0.093055956f, 0.48372543f, -0.032955285f, -0.12950143f, 0.3382748f, -0.015367503f, -0.15094517f,
+		0.9903756f, -0.014584442f, 0.04692826f, 0.9541905f, -0.039106477f, 0.08264374f, 0.8959807f, -0.055503353f, 0.056537915f, 0.79256845f, -0.08175068f, 0.003240627f, 0.7171416f, -0.09315331f, -0.046285287f, 0.61792475f, -0.07322941f, -0.093055956f, 0.48372543f, -0.032955285f, -0.12950143f, 0.37948954f, 0.00018679441f, -0.15737368f, 0.26044068f, -0.010374207f, -0.10919226f,
+		// Purples
+		0.9499397f, 0.0050331266f, -0.0096185375f, 0.80758536f, 0.010458548f, -0.042209636f, 0.5670472f, 0.034830257f, -0.10063145f,
+		0.9586741f, 0.004653566f, -0.008313161f, 0.8452695f, 0.011430536f, -0.032621536f, 0.70590204f, 0.021230841f, -0.06328337f, 0.49961126f, 0.05491858f, -0.11532475f,
+		0.9586741f, 0.004653566f, -0.008313161f, 0.8452695f, 0.011430536f, -0.032621536f, 0.70590204f, 0.021230841f, -0.06328337f, 0.5670472f, 0.034830257f, -0.10063145f, 0.39503828f, 0.07677859f, -0.14189611f,
+		0.9586741f, 0.004653566f, -0.008313161f, 0.8934628f, 0.006343518f, -0.022235982f, 0.80758536f, 0.010458548f, -0.042209636f, 0.70590204f, 0.021230841f, -0.06328337f, 0.5670472f, 0.034830257f, -0.10063145f, 0.39503828f, 0.07677859f, -0.14189611f,
+		0.9586741f, 0.004653566f, -0.008313161f, 0.8934628f, 0.006343518f, -0.022235982f, 0.80758536f, 0.010458548f, -0.042209636f, 0.70590204f, 0.021230841f, -0.06328337f, 0.61675906f, 0.02463056f, -0.08800615f, 0.49961126f, 0.05491858f, -0.11532475f, 0.35425404f, 0.08026646f, -0.15003797f,
+		0.9894076f, 0.001758639f, -0.0022165377f, 0.9499397f, 0.0050331266f, -0.0096185375f, 0.8934628f, 0.006343518f, -0.022235982f, 0.80758536f, 0.010458548f, -0.042209636f, 0.70590204f, 0.021230841f, -0.06328337f, 0.61675906f, 0.02463056f, -0.08800615f, 0.49961126f, 0.05491858f, -0.11532475f, 0.35425404f, 0.08026646f, -0.15003797f,
+		0.9894076f, 0.001758639f, -0.0022165377f, 0.9499397f, 0.0050331266f, -0.0096185375f, 0.8934628f, 0.006343518f, -0.022235982f, 0.80758536f, 0.010458548f, -0.042209636f, 0.70590204f, 0.021230841f, -0.06328337f, 0.61675906f, 0.02463056f, -0.08800615f, 0.49961126f, 0.05491858f, -0.11532475f, 0.39503828f, 0.07677859f, -0.14189611f, 0.3174725f, 0.07649188f, -0.1552985f,
+		// GnBu
+		0.94364417f, -0.028482754f, 0.024610009f, 0.8499605f, -0.068787314f, 0.036521953f, 0.67245543f, -0.069243655f, -0.080279626f,
+		0.97077256f, -0.0155886635f, 0.018652901f, 0.8783645f, -0.058082756f, 0.038882494f, 0.79103017f, -0.079892844f, -0.010688688f, 0.607644f, -0.06409486f, -0.09576031f,
+		0.97077256f, -0.0155886635f, 0.018652901f, 0.8783645f, -0.058082756f, 0.038882494f, 0.79103017f, -0.079892844f, -0.010688688f, 0.67245543f, -0.069243655f, -0.080279626f, 0.5049498f, -0.04967304f, -0.123402655f,
+		0.97077256f, -0.0155886635f, 0.018652901f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8499605f, -0.068787314f, 0.036521953f, 0.79103017f, -0.079892844f, -0.010688688f, 0.67245543f, -0.069243655f, -0.080279626f, 0.5049498f, -0.04967304f, -0.123402655f,
+		0.97077256f, -0.0155886635f, 0.018652901f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8499605f, -0.068787314f, 0.036521953f, 0.79103017f, -0.079892844f, -0.010688688f, 0.71988815f, -0.07707034f, -0.06937222f, 0.607644f, -0.06409486f, -0.09576031f, 0.45738372f, -0.040843163f, -0.12627071f,
+		0.9840375f, -0.009592967f, 0.013558774f, 0.94364417f, -0.028482754f, 0.024610009f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8499605f, -0.068787314f, 0.036521953f, 0.79103017f, -0.079892844f, -0.010688688f, 0.71988815f, -0.07707034f, -0.06937222f, 0.607644f, -0.06409486f, -0.09576031f, 0.45738372f, -0.040843163f, -0.12627071f,
+		0.9840375f, -0.009592967f, 0.013558774f, 0.94364417f, -0.028482754f, 0.024610009f, 0.9075425f, -0.046276104f, 0.03895616f, 0.8499605f, -0.068787314f, 0.036521953f, 0.79103017f, -0.079892844f, -0.010688688f, 0.71988815f, -0.07707034f, -0.06937222f, 0.607644f, -0.06409486f, -0.09576031f, 0.5049498f, -0.04967304f, -0.123402655f, 0.3786096f, -0.029129228f, -0.11891674f,
+		// Greys
+		0.95514005f, 7.732098e-11f, 3.56018e-08f, 0.7983724f, 6.463069e-11f, 2.9758459e-08f, 0.49969557f, 4.0451864e-11f, 1.8625606e-08f,
+		0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.84522223f, 6.8423045e-11f, 3.1504737e-08f, 0.6731222f, 5.449119e-11f, 2.5089895e-08f, 0.43860474f, 3.5506265e-11f, 1.6348514e-08f,
+		0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.84522223f, 6.8423045e-11f, 3.1504737e-08f, 0.6731222f, 5.449119e-11f, 2.5089895e-08f, 0.49969557f, 4.0451864e-11f, 1.8625606e-08f, 0.26447967f, 2.1410429e-11f, 9.858191e-09f,
+		0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f, 0.7983724f, 6.463069e-11f, 2.9758459e-08f, 0.6731222f, 5.449119e-11f, 2.5089895e-08f, 0.49969557f, 4.0451864e-11f, 1.8625606e-08f, 0.26447967f, 2.1410429e-11f, 9.858191e-09f,
+		0.9761388f, 7.902107e-11f, 3.6384506e-08f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f, 0.7983724f, 6.463069e-11f, 2.9758459e-08f, 0.6731222f, 5.449119e-11f, 2.5089895e-08f, 0.55552673f, 4.497136e-11f, 2.0706652e-08f, 0.43860474f, 3.5506265e-11f, 1.6348514e-08f, 0.26447967f, 2.1410429e-11f, 9.858191e-09f,
+		1.0f, 8.0952856e-11f, 3.7273907e-08f, 0.95514005f, 7.732098e-11f, 3.56018e-08f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f, 0.7983724f, 6.463069e-11f, 2.9758459e-08f, 0.6731222f, 5.449119e-11f, 2.5089895e-08f, 0.55552673f, 4.497136e-11f, 2.0706652e-08f, 0.43860474f, 3.5506265e-11f, 1.6348514e-08f, 0.26447967f, 2.1410429e-11f, 9.858191e-09f,
+		1.0f, 8.0952856e-11f, 3.7273907e-08f, 0.95514005f, 7.732098e-11f, 3.56018e-08f, 0.8853053f, 7.166784e-11f, 3.2998788e-08f, 0.7983724f, 6.463069e-11f, 2.9758459e-08f, 0.6731222f, 5.449119e-11f, 2.5089895e-08f, 0.55552673f, 4.497136e-11f, 2.0706652e-08f, 0.43860474f, 3.5506265e-11f, 1.6348514e-08f, 0.26447967f, 2.1410429e-11f, 9.858191e-09f, 0.0f, 0.0f, 0.0f,
+		// YlOrRd
+		0.9433489f, -0.011254806f, 0.09745336f, 0.81833017f, 0.047388587f, 0.13712525f, 0.627155f, 0.18786871f, 0.1151618f,
+		0.98243606f, -0.029948907f, 0.09187869f, 0.86862797f, 0.012507081f, 0.13932806f, 0.7520499f, 0.09898283f, 0.13013078f, 0.58316755f, 0.20128775f, 0.10669022f,
+		0.98243606f, -0.029948907f, 0.09187869f, 0.86862797f, 0.012507081f, 0.13932806f, 0.7520499f, 0.09898283f, 0.13013078f, 0.627155f, 0.18786871f, 0.1151618f, 0.5038344f, 0.18735717f, 0.078894146f,
+		0.98243606f, -0.029948907f, 0.09187869f, 0.8968169f, 0.0015498638f, 0.12516026f, 0.81833017f, 0.047388587f, 0.13712525f, 0.7520499f, 0.09898283f, 0.13013078f, 0.627155f, 0.18786871f, 0.1151618f, 0.5038344f, 0.18735717f, 0.078894146f,
+		0.98243606f, -0.029948907f, 0.09187869f, 0.8968169f, 0.0015498638f, 0.12516026f, 0.81833017f, 0.047388587f, 0.13712525f, 0.7520499f, 0.09898283f, 0.13013078f, 0.66538304f, 0.18042707f, 0.11867048f, 0.58316755f, 0.20128775f, 0.10669022f, 0.480239f, 0.17945582f, 0.07220905f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.9433489f, -0.011254806f, 0.09745336f, 0.8968169f, 0.0015498638f, 0.12516026f, 0.81833017f, 0.047388587f, 0.13712525f, 0.7520499f, 0.09898283f, 0.13013078f, 0.66538304f, 0.18042707f, 0.11867048f, 0.58316755f, 0.20128775f, 0.10669022f, 0.480239f, 0.17945582f, 0.07220905f,
+		0.98751295f, -0.019712258f, 0.062367894f, 0.9433489f, -0.011254806f, 0.09745336f, 0.8968169f, 0.0015498638f, 0.12516026f, 0.81833017f, 0.047388587f, 0.13712525f, 0.7520499f, 0.09898283f, 0.13013078f, 0.66538304f, 0.18042707f, 0.11867048f, 0.58316755f, 0.20128775f, 0.10669022f, 0.5038344f, 0.18735717f, 0.078894146f, 0.3810883f, 0.14679044f, 0.040960927f,
+		// PuRd
+		0.9185458f, 0.011446685f, -0.016195994f, 0.73368293f, 0.07884836f, -0.049796935f, 0.589564f, 0.2264768f, 0.0009379778f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.8134975f, 0.050152056f, -0.034815654f, 0.6779031f, 0.16752258f, -0.045236982f, 0.5496033f, 0.20984806f, 0.034665838f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.8134975f, 0.050152056f, -0.034815654f, 0.6779031f, 0.16752258f, -0.045236982f, 0.589564f, 0.2264768f, 0.0009379778f, 0.43663856f, 0.17435257f, 0.017770743f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.81902486f, 0.041575626f, -0.034759644f, 0.73368293f, 0.07884836f, -0.049796935f, 0.6779031f, 0.16752258f, -0.045236982f, 0.589564f, 0.2264768f, 0.0009379778f, 0.43663856f, 0.17435257f, 0.017770743f,
+		0.95372117f, 0.00605664f, -0.009287277f, 0.81902486f, 0.041575626f, -0.034759644f, 0.73368293f, 0.07884836f, -0.049796935f, 0.6779031f, 0.16752258f, -0.045236982f, 0.61941487f, 0.23108535f, -0.015517129f, 0.5496033f, 0.20984806f, 0.034665838f, 0.42168024f, 0.16822271f, 0.018057233f,
+		0.9708686f, 0.0049257874f, -0.005412983f, 0.9185458f, 0.011446685f, -0.016195994f, 0.81902486f, 0.041575626f, -0.034759644f, 0.73368293f, 0.07884836f, -0.049796935f, 0.6779031f, 0.16752258f, -0.045236982f, 0.61941487f, 0.23108535f, -0.015517129f, 0.5496033f, 0.20984806f, 0.034665838f, 0.42168024f, 0.16822271f, 0.018057233f,
+		0.9708686f, 0.0049257874f, -0.005412983f, 0.9185458f, 0.011446685f, -0.016195994f, 0.81902486f, 0.041575626f, -0.034759644f, 0.73368293f, 0.07884836f, -0.049796935f, 0.6779031f, 0.16752258f, -0.045236982f, 0.61941487f, 0.23108535f, -0.015517129f, 0.5496033f, 0.20984806f, 0.034665838f, 0.43663856f, 0.17435257f, 0.017770743f, 0.3268716f, 0.1266581f, 0.032032344f,
+		// Blues
+		0.93388706f, -0.008759453f, -0.019544842f, 0.8154061f, -0.03555162f, -0.044015985f, 0.584983f, -0.051895402f, -0.10731578f,
+		0.9646068f, 0.00036044832f, -0.016618468f, 0.86496985f, -0.02049421f, -0.029126212f, 0.7214989f, -0.05009316f, -0.074514575f, 0.53606963f, -0.04670235f, -0.121560596f,
+		0.9646068f, 0.00036044832f, -0.016618468f, 0.86496985f, -0.02049421f, -0.029126212f, 0.7214989f, -0.05009316f, -0.074514575f, 0.584983f, -0.051895402f, -0.10731578f, 0.43945953f, -0.036197826f, -0.13356608f,
+		0.9646068f, 0.00036044832f, -0.016618468f, 0.88202214f, -0.013995896f, -0.0328343f, 0.8154061f, -0.03555162f, -0.044015985f, 0.7214989f, -0.05009316f, -0.074514575f, 0.584983f, -0.051895402f, -0.10731578f, 0.43945953f, -0.036197826f, -0.13356608f,
+		0.9646068f, 0.00036044832f, -0.016618468f, 0.88202214f, -0.013995896f, -0.0328343f, 0.8154061f, -0.03555162f, -0.044015985f, 0.7214989f, -0.05009316f, -0.074514575f, 0.6327032f, -0.054807343f, -0.095914185f, 0.53606963f, -0.04670235f, -0.121560596f, 0.40558985f, -0.029519523f, -0.13937669f,
+		0.9862047f, -0.0025673439f, -0.006320671f, 0.93388706f, -0.008759453f, -0.019544842f, 0.88202214f, -0.013995896f, -0.0328343f, 0.8154061f, -0.03555162f, -0.044015985f, 0.7214989f, -0.05009316f, -0.074514575f, 0.6327032f, -0.054807343f, -0.095914185f, 0.53606963f, -0.04670235f, -0.121560596f, 0.40558985f, -0.029519523f, -0.13937669f,
+		0.9862047f, -0.0025673439f, -0.006320671f, 0.93388706f, -0.008759453f, -0.019544842f, 0.88202214f, -0.013995896f, -0.0328343f, 0.8154061f, -0.03555162f, -0.044015985f, 0.7214989f, -0.05009316f, -0.074514575f, 0.6327032f, -0.054807343f, -0.095914185f, 0.53606963f, -0.04670235f, -0.121560596f, 0.43945953f, -0.036197826f, -0.13356608f, 0.32222983f, -0.021243574f, -0.10981454f,
+		// PuBuGn
+		0.9247497f, 0.015609458f, -0.014836114f, 0.7910176f, -0.012742773f, -0.04804697f, 0.59786713f, -0.0881833f, -0.03768337f,
+		0.95983756f, 0.010170017f, -0.0079756845f, 0.8342847f, -0.003549424f, -0.035932768f, 0.7053337f, -0.04999039f, -0.071779095f, 0.5499052f, -0.085621566f, -0.03712453f,
+		0.95983756f, 0.010170017f, -0.0079756845f, 0.8342847f, -0.003549424f, -0.035932768f, 0.7053337f, -0.04999039f, -0.071779095f, 0.59786713f, -0.0881833f, -0.03768337f, 0.47439668f, -0.088911355f, 0.007954466f,
+		0.95983756f, 0.010170017f, -0.0079756845f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7053337f, -0.04999039f, -0.071779095f, 0.59786713f, -0.0881833f, -0.03768337f, 0.47439668f, -0.088911355f, 0.007954466f,
+		0.95983756f, 0.010170017f, -0.0079756845f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7053337f, -0.04999039f, -0.071779095f, 0.62113494f, -0.06186005f, -0.09181101f, 0.5499052f, -0.085621566f, -0.03712453f, 0.44865593f, -0.08538431f, 0.010918893f,
+		0.9834359f, 0.0096673705f, -0.002516747f, 0.9247497f, 0.015609458f, -0.014836114f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7053337f, -0.04999039f, -0.071779095f, 0.62113494f, -0.06186005f, -0.09181101f, 0.5499052f, -0.085621566f, -0.03712453f, 0.44865593f, -0.08538431f, 0.010918893f,
+		0.9834359f, 0.0096673705f, -0.002516747f, 0.9247497f, 0.015609458f, -0.014836114f, 0.86634165f, 0.0067925034f, -0.028065233f, 0.7910176f, -0.012742773f, -0.04804697f, 0.7053337f, -0.04999039f, -0.071779095f, 0.62113494f, -0.06186005f, -0.09181101f, 0.5499052f, -0.085621566f, -0.03712453f, 0.47439668f, -0.088911355f, 0.007954466f, 0.35112906f, -0.06739543f, 0.01059832f
+	};
+
+
+	// Dense scheme registry indexed by family, scheme name and n - minClasses.
+	// Properties are stored in the order blind, print, copy, screen.
+	constexpr ColorBrewer::ColorScheme schemeTable[numFamilies][maxSchemes][maxClasses - minClasses + 1] =
+	{
+		// diverging
+		{
+			{ { 0, 3, { 2, 1, 1, 1 }, 0xe }, { 9, 4, { 2, 1, 1, 1 }, 0xe }, { 21, 5, { 2, 1, 1, 2 }, 0x6 }, { 36, 6, { 0, 0, 0, 0 }, 0x0 }, { 54, 7, { 0, 0, 0, 0 }, 0x0 }, { 75, 8, { 0, 0, 0, 0 }, 0x0 }, { 99, 9, { 0, 0, 0, 0 }, 0x0 }, { 126, 10, { 0, 0, 0, 0 }, 0x0 }, { 156, 11, { 0, 0, 0, 0 }, 0x0 } }, // Spectral
+			{ { 189, 3, { 2, 1, 0, 1 }, 0xa }, { 198, 4, { 2, 1, 0, 1 }, 0xa }, { 210, 5, { 2, 1, 0, 1 }, 0xa }, { 225, 6, { 0, 2, 0, 0 }, 0x0 }, { 243, 7, { 0, 0, 0, 0 }, 0x0 }, { 264, 8, { 0, 0, 0, 0 }, 0x0 }, { 288, 9, { 0, 0, 0, 0 }, 0x0 }, { 315, 10, { 0, 0, 0, 0 }, 0x0 }, { 345, 11, { 0, 0, 0, 0 }, 0x0 } }, // RdYlGn
+			{ { 378, 3, { 1, 1, 0, 1 }, 0xb }, { 387, 4, { 1, 1, 0, 1 }, 0xb }, { 399, 5, { 1, 1, 0, 1 }, 0xb }, { 414, 6, { 1, 1, 0, 0 }, 0x3 }, { 432, 7, { 1, 0, 0, 0 }, 0x1 }, { 453, 8, { 1, 0, 0, 0 }, 0x1 }, { 477, 9, { 1, 0, 0, 0 }, 0x1 }, { 504, 10, { 1, 0, 0, 0 }, 0x1 }, { 534, 11, { 1, 0, 0, 0 }, 0x1 } }, // RdBu
+			{ { 567, 3, { 1, 1, 0, 1 }, 0xb }, { 576, 4, { 1, 1, 0, 1 }, 0xb }, { 588, 5, { 1, 2, 0, 2 }, 0x1 }, { 603, 6, { 1, 0, 0, 0 }, 0x1 }, { 621, 7, { 1, 0, 0, 0 }, 0x1 }, { 642, 8, { 1, 0, 0, 0 }, 0x1 }, { 666, 9, { 1, 0, 0, 0 }, 0x1 }, { 693, 10, { 1, 0, 0, 0 }, 0x1 }, { 723, 11, { 1, 0, 0, 0 }, 0x1 } }, // PiYG
+			{ { 756, 3, { 1, 1, 0, 1 }, 0xb }, { 765, 4, { 1, 1, 0, 1 }, 0xb }, { 777, 5, { 1, 1, 0, 2 }, 0x3 }, { 792, 6, { 1, 1, 0, 2 }, 0x3 }, { 810, 7, { 1, 0, 0, 0 }, 0x1 }, { 831, 8, { 1, 0, 0, 0 }, 0x1 }, { 855, 9, { 1, 0, 0, 0 }, 0x1 }, { 882, 10, { 1, 0, 0, 0 }, 0x1 }, { 912, 11, { 1, 0, 0, 0 }, 0x1 } }, // PRGn
+			{ { 945, 3, { 1, 1, 0, 1 }, 0xb }, { 954, 4, { 1, 1, 0, 1 }, 0xb }, { 966, 5, { 1, 1, 0, 1 }, 0xb }, { 981, 6, { 1, 1, 0, 2 }, 0x3 }, { 999, 7, { 1, 2, 0, 0 }, 0x1 }, { 1020, 8, { 1, 0, 0, 0 }, 0x1 }, { 1044, 9, { 1, 0, 0, 0 }, 0x1 }, { 1071, 10, { 1, 0, 0, 0 }, 0x1 }, { 1101, 11, { 1, 0, 0, 0 }, 0x1 } }, // RdYlBu
+			{ { 1134, 3, { 1, 1, 0, 1 }, 0xb }, { 1143, 4, { 1, 1, 0, 1 }, 0xb }, { 1155, 5, { 1, 1, 0, 1 }, 0xb }, { 1170, 6, { 1, 1, 0, 1 }, 0xb }, { 1188, 7, { 1, 0, 0, 0 }, 0x1 }, { 1209, 8, { 1, 0, 0, 0 }, 0x1 }, { 1233, 9, { 1, 0, 0, 0 }, 0x1 }, { 1260, 10, { 1, 0, 0, 0 }, 0x1 }, { 1290, 11, { 1, 0, 0, 0 }, 0x1 } }, // BrBG
+			{ { 1323, 3, { 2, 1, 0, 1 }, 0xa }, { 1332, 4, { 2, 1, 0, 1 }, 0xa }, { 1344, 5, { 2, 1, 0, 2 }, 0x2 }, { 1359, 6, { 2, 2, 0, 0 }, 0x0 }, { 1377, 7, { 2, 0, 0, 0 }, 0x0 }, { 1398, 8, { 2, 0, 0, 0 }, 0x0 }, { 1422, 9, { 2, 0, 0, 0 }, 0x0 }, { 1449, 10, { 2, 0, 0, 0 }, 0x0 }, { 1479, 11, { 2, 0, 0, 0 }, 0x0 } }, // RdGy
+			{ { 1512, 3, { 1, 1, 1, 1 }, 0xf }, { 1521, 4, { 1, 1, 1, 1 }, 0xf }, { 1533, 5, { 1, 2, 0, 1 }, 0x9 }, { 1548, 6, { 1, 2, 0, 1 }, 0x9 }, { 1566, 7, { 1, 0, 0, 0 }, 0x1 }, { 1587, 8, { 1, 0, 0, 0 }, 0x1 }, { 1611, 9, { 1, 0, 0, 0 }, 0x1 }, { 1638, 10, { 1, 0, 0, 0 }, 0x1 }, { 1668, 11, { 1, 0, 0, 0 }, 0x1 } } // PuOr
+		},
+		// qualitative
+		{
+			{ { 1701, 3, { 1, 1, 0, 1 }, 0xb }, { 1710, 4, { 2, 1, 0, 1 }, 0xa }, { 1722, 5, { 2, 1, 0, 2 }, 0x2 }, { 1737, 6, { 2, 2, 0, 2 }, 0x0 }, { 1755, 7, { 0, 2, 0, 2 }, 0x0 }, { 1776, 8, { 0, 2, 0, 2 }, 0x0 } }, // Set2
+			{ { 1800, 3, { 2, 1, 0, 1 }, 0xa }, { 1809, 4, { 0, 1, 0, 1 }, 0xa }, { 1821, 5, { 0, 2, 0, 1 }, 0x8 }, { 1836, 6, { 0, 2, 0, 2 }, 0x0 }, { 1854, 7, { 0, 2, 0, 2 }, 0x0 }, { 1875, 8, { 0, 2, 0, 2 }, 0x0 } }, // Accent
+			{ { 1899, 3, { 2, 1, 0, 1 }, 0xa }, { 1908, 4, { 2, 1, 0, 1 }, 0xa }, { 1920, 5, { 2, 1, 0, 1 }, 0xa }, { 1935, 6, { 2, 1, 0, 1 }, 0xa }, { 1953, 7, { 2, 1, 0, 1 }, 0xa }, { 1974, 8, { 2, 1, 0, 1 }, 0xa }, { 1998, 9, { 2, 1, 0, 1 }, 0xa } }, // Set1
+			{ { 2025, 3, { 2, 1, 1, 1 }, 0xe }, { 2034, 4, { 2, 1, 2, 1 }, 0xa }, { 2046, 5, { 0, 1, 2, 1 }, 0xa }, { 2061, 6, { 0, 1, 2, 2 }, 0x2 }, { 2079, 7, { 0, 1, 2, 2 }, 0x2 }, { 2100, 8, { 0, 1, 2, 2 }, 0x2 }, { 2124, 9, { 0, 2, 2, 0 }, 0x0 }, { 2151, 10, { 0, 0, 0, 0 }, 0x0 }, { 2181, 11, { 0, 0, 0, 0 }, 0x0 }, { 2214, 12, { 0, 0, 0, 0 }, 0x0 } }, // Set3
+			{ { 2250, 3, { 1, 1, 0, 1 }, 0xb }, { 2259, 4, { 2, 1, 0, 1 }, 0xa }, { 2271, 5, { 2, 1, 0, 1 }, 0xa }, { 2286, 6, { 2, 1, 0, 1 }, 0xa }, { 2304, 7, { 0, 1, 0, 1 }, 0xa }, { 2325, 8, { 0, 1, 0, 1 }, 0xa } }, // Dark2
+			{ { 2349, 3, { 1, 1, 0, 1 }, 0xb }, { 2358, 4, { 1, 1, 0, 1 }, 0xb }, { 2370, 5, { 2, 1, 0, 1 }, 0xa }, { 2385, 6, { 2, 1, 0, 1 }, 0xa }, { 2403, 7, { 2, 1, 0, 1 }, 0xa }, { 2424, 8, { 2, 2, 0, 1 }, 0x8 }, { 2448, 9, { 0, 2, 0, 1 }, 0x8 }, { 2475, 10, { 0, 2, 0, 1 }, 0x8 }, { 2505, 11, { 0, 2, 0, 2 }, 0x0 }, { 2538, 12, { 0, 2, 0, 2 }, 0x0 } }, // Paired
+			{ { 2574, 3, { 2, 2, 0, 2 }, 0x0 }, { 2583, 4, { 0, 0, 0, 2 }, 0x0 }, { 2595, 5, { 0, 0, 0, 0 }, 0x0 }, { 2610, 6, { 0, 0, 0, 0 }, 0x0 }, { 2628, 7, { 0, 0, 0, 0 }, 0x0 }, { 2649, 8, { 0, 0, 0, 0 }, 0x0 } }, // Pastel2
+			{ { 2673, 3, { 2, 2, 0, 2 }, 0x0 }, { 2682, 4, { 0, 2, 0, 2 }, 0x0 }, { 2694, 5, { 0, 2, 0, 2 }, 0x0 }, { 2709, 6, { 0, 0, 0, 2 }, 0x0 }, { 2727, 7, { 0, 0, 0, 0 }, 0x0 }, { 2748, 8, { 0, 0, 0, 0 }, 0x0 }, { 2772, 9, { 0, 0, 0, 0 }, 0x0 } } // Pastel1
+		},
+		// sequential
+		{
+			{ { 2799, 3, { 1, 1, 1, 1 }, 0xf }, { 2808, 4, { 1, 1, 1, 1 }, 0xf }, { 2820, 5, { 1, 0, 2, 1 }, 0x9 }, { 2835, 6, { 1, 0, 0, 0 }, 0x1 }, { 2853, 7, { 1, 0, 0, 0 }, 0x1 }, { 2874, 8, { 1, 0, 0, 0 }, 0x1 }, { 2898, 9, { 1, 0, 0, 0 }, 0x1 } }, // OrRd
+			{ { 2925, 3, { 1, 1, 1, 1 }, 0xf }, { 2934, 4, { 1, 2, 2, 1 }, 0x9 }, { 2946, 5, { 1, 2, 0, 2 }, 0x1 }, { 2961, 6, { 1, 0, 0, 0 }, 0x1 }, { 2979, 7, { 1, 0, 0, 0 }, 0x1 }, { 3000, 8, { 1, 0, 0, 0 }, 0x1 }, { 3024, 9, { 1, 0, 0, 0 }, 0x1 } }, // PuBu
+			{ { 3051, 3, { 1, 1, 1, 1 }, 0xf }, { 3060, 4, { 1, 1, 2, 1 }, 0xb }, { 3072, 5, { 1, 2, 0, 1 }, 0x9 }, { 3087, 6, { 1, 2, 0, 0 }, 0x1 }, { 3105, 7, { 1, 0, 0, 0 }, 0x1 }, { 3126, 8, { 1, 0, 0, 0 }, 0x1 }, { 3150, 9, { 1, 0, 0, 0 }, 0x1 } }, // BuPu
+			{ { 3177, 3, { 1, 1, 1, 1 }, 0xf }, { 3186, 4, { 1, 2, 2, 1 }, 0x9 }, { 3198, 5, { 1, 0, 2, 1 }, 0x9 }, { 3213, 6, { 1, 0, 0, 0 }, 0x1 }, { 3231, 7, { 1, 0, 0, 0 }, 0x1 }, { 3252, 8, { 1, 0, 0, 0 }, 0x1 }, { 3276, 9, { 1, 0, 0, 0 }, 0x1 } }, // Oranges
+			{ { 3303, 3, { 1, 1, 1, 1 }, 0xf }, { 3312, 4, { 1, 1, 2, 2 }, 0x3 }, { 3324, 5, { 1, 2, 0, 0 }, 0x1 }, { 3339, 6, { 1, 0, 0, 0 }, 0x1 }, { 3357, 7, { 1, 0, 0, 0 }, 0x1 }, { 3378, 8, { 1, 0, 0, 0 }, 0x1 }, { 3402, 9, { 1, 0, 0, 0 }, 0x1 } }, // BuGn
+			{ { 3429, 3, { 1, 1, 1, 1 }, 0xf }, { 3438, 4, { 1, 1, 2, 2 }, 0x3 }, { 3450, 5, { 1, 2, 2, 0 }, 0x1 }, { 3465, 6, { 1, 0, 0, 0 }, 0x1 }, { 3483, 7, { 1, 0, 0, 0 }, 0x1 }, { 3504, 8, { 1, 0, 0, 0 }, 0x1 }, { 3528, 9, { 1, 0, 0, 0 }, 0x1 } }, // YlOrBr
+			{ { 3555, 3, { 1, 1, 1, 1 }, 0xf }, { 3564, 4, { 1, 1, 2, 1 }, 0xb }, { 3576, 5, { 1, 1, 0, 1 }, 0xb }, { 3591, 6, { 1, 0, 0, 0 }, 0x1 }, { 3609, 7, { 1, 0, 0, 0 }, 0x1 }, { 3630, 8, { 1, 0, 0, 0 }, 0x1 }, { 3654, 9, { 1, 0, 0, 0 }, 0x1 } }, // YlGn
+			{ { 3681, 3, { 1, 1, 1, 1 }, 0xf }, { 3690, 4, { 1, 2, 2, 2 }, 0x1 }, { 3702, 5, { 1, 2, 0, 0 }, 0x1 }, { 3717, 6, { 1, 0, 0, 0 }, 0x1 }, { 3735, 7, { 1, 0, 0, 0 }, 0x1 }, { 3756, 8, { 1, 0, 0, 0 }, 0x1 }, { 3780, 9, { 1, 0, 0, 0 }, 0x1 } }, // Reds
+			{ { 3807, 3, { 1, 1, 1, 1 }, 0xf }, { 3816, 4, { 1, 1, 2, 1 }, 0xb }, { 3828, 5, { 1, 1, 0, 1 }, 0xb }, { 3843, 6, { 1, 2, 0, 0 }, 0x1 }, { 3861, 7, { 1, 0, 0, 0 }, 0x1 }, { 3882, 8, { 1, 0, 0, 0 }, 0x1 }, { 3906, 9, { 1, 0, 0, 0 }, 0x1 } }, // RdPu
+			{ { 3933, 3, { 1, 1, 1, 1 }, 0xf }, { 3942, 4, { 1, 0, 2, 2 }, 0x1 }, { 3954, 5, { 1, 0, 0, 0 }, 0x1 }, { 3969, 6, { 1, 0, 0, 0 }, 0x1 }, { 3987, 7, { 1, 0, 0, 0 }, 0x1 }, { 4008, 8, { 1, 0, 0, 0 }, 0x1 }, { 4032, 9, { 1, 0, 0, 0 }, 0x1 } }, // Greens
+			{ { 4059, 3, { 1, 1, 1, 1 }, 0xf }, { 4068, 4, { 1, 1, 2, 1 }, 0xb }, { 4080, 5, { 1, 1, 0, 2 }, 0x3 }, { 4095, 6, { 1, 2, 0, 0 }, 0x1 }, { 4113, 7, { 1, 2, 0, 0 }, 0x1 }, { 4134, 8, { 1, 2, 0, 0 }, 0x1 }, { 4158, 9, { 1, 0, 0, 0 }, 0x1 } }, // YlGnBu
+			{ { 4185, 3, { 1, 1, 1, 1 }, 0xf }, { 4194, 4, { 1, 0, 2, 0 }, 0x1 }, { 4206, 5, { 1, 0, 0, 0 }, 0x1 }, { 4221, 6, { 1, 0, 0, 0 }, 0x1 }, { 4239, 7, { 1, 0, 0, 0 }, 0x1 }, { 4260, 8, { 1, 0, 0, 0 }, 0x1 }, { 4284, 9, { 1, 0, 0, 0 }, 0x1 } }, // Purples
+			{ { 4311, 3, { 1, 1, 1, 1 }, 0xf }, { 4320, 4, { 1, 1, 2, 1 }, 0xb }, { 4332, 5, { 1, 1, 0, 2 }, 0x3 }, { 4347, 6, { 1, 2, 0, 0 }, 0x1 }, { 4365, 7, { 1, 2, 0, 0 }, 0x1 }, { 4386, 8, { 1, 2, 0, 0 }, 0x1 }, { 4410, 9, { 1, 0, 0, 0 }, 0x1 } }, // GnBu
+			{ { 4437, 3, { 1, 1, 1, 1 }, 0xf }, { 4446, 4, { 1, 1, 0, 2 }, 0x3 }, { 4458, 5, { 1, 2, 0, 0 }, 0x1 }, { 4473, 6, { 1, 0, 0, 0 }, 0x1 }, { 4491, 7, { 1, 0, 0, 0 }, 0x1 }, { 4512, 8, { 1, 0, 0, 0 }, 0x1 }, { 4536, 9, { 1, 0, 0, 0 }, 0x1 } }, // Greys
+			{ { 4563, 3, { 1, 1, 1, 1 }, 0xf }, { 4572, 4, { 1, 1, 2, 2 }, 0x3 }, { 4584, 5, { 1, 2, 2, 2 }, 0x1 }, { 4599, 6, { 1, 2, 0, 0 }, 0x1 }, { 4617, 7, { 1, 0, 0, 0 }, 0x1 }, { 4638, 8, { 1, 0, 0, 0 }, 0x1 }, { 4662, 9, { 1, 0, 0, 0 }, 0x1 } }, // YlOrRd
+			{ { 4689, 3, { 1, 1, 1, 1 }, 0xf }, { 4698, 4, { 1, 1, 2, 1 }, 0xb }, { 4710, 5, { 1, 1, 0, 1 }, 0xb }, { 4725, 6, { 1, 0, 0, 0 }, 0x1 }, { 4743, 7, { 1, 0, 0, 0 }, 0x1 }, { 4764, 8, { 1, 0, 0, 0 }, 0x1 }, { 4788, 9, { 1, 0, 0, 0 }, 0x1 } }, // PuRd
+			{ { 4815, 3, { 1, 1, 1, 1 }, 0xf }, { 4824, 4, { 1, 2, 0, 2 }, 0x1 }, { 4836, 5, { 1, 0, 0, 0 }, 0x1 }, { 4851, 6, { 1, 0, 0, 0 }, 0x1 }, { 4869, 7, { 1, 0, 0, 0 }, 0x1 }, { 4890, 8, { 1, 0, 0, 0 }, 0x1 }, { 4914, 9, { 1, 0, 0, 0 }, 0x1 } }, // Blues
+			{ { 4941, 3, { 1, 1, 1, 1 }, 0xf }, { 4950, 4, { 1, 2, 2, 1 }, 0x9 }, { 4962, 5, { 1, 2, 0, 2 }, 0x1 }, { 4977, 6, { 1, 0, 0, 0 }, 0x1 }, { 4995, 7, { 1, 0, 0, 0 }, 0x1 }, { 5016, 8, { 1, 0, 0, 0 }, 0x1 }, { 5040, 9, { 1, 0, 0, 0 }, 0x1 } } // PuBuGn
+		}
+	};
+
+
+	// Bitsets over scheme names per family and n - minClasses, for all schemes with n classes
+	// and for the schemes which satisfy a property.
+	constexpr unsigned int classIndex[numFamilies][maxClasses - minClasses + 1] =
+	{
+		{ 0x001ff, 0x001ff, 0x001ff, 0x001ff, 0x001ff, 0x001ff, 0x001ff, 0x001ff, 0x001ff, 0x00000 }, // diverging
+		{ 0x000ff, 0x000ff, 0x000ff, 0x000ff, 0x000ff, 0x000ff, 0x000ac, 0x00028, 0x00028, 0x00028 }, // qualitative
+		{ 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x00000, 0x00000, 0x00000 } // sequential
+	};
+
+	constexpr unsigned int propertyIndex[numFamilies][numProperties][maxClasses - minClasses + 1] =
+	{
+		// diverging
+		{
+			{ 0x0017c, 0x0017c, 0x0017c, 0x0017c, 0x0017c, 0x0017c, 0x0017c, 0x0017c, 0x0017c, 0x00000 }, // blind
+			{ 0x001ff, 0x001ff, 0x000f7, 0x00074, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 }, // print
+			{ 0x00101, 0x00101, 0x00001, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 }, // copy
+			{ 0x001ff, 0x001ff, 0x00166, 0x00140, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 } // screen
+		},
+		// qualitative
+		{
+			{ 0x00031, 0x00020, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 }, // blind
+			{ 0x0003f, 0x0003f, 0x0003d, 0x0003c, 0x0003c, 0x0001c, 0x00004, 0x00000, 0x00000, 0x00000 }, // print
+			{ 0x00008, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 }, // copy
+			{ 0x0003f, 0x0003f, 0x0003e, 0x00034, 0x00034, 0x00034, 0x00024, 0x00020, 0x00000, 0x00000 } // screen
+		},
+		// sequential
+		{
+			{ 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x3ffff, 0x00000, 0x00000, 0x00000 }, // blind
+			{ 0x3ffff, 0x0f575, 0x09540, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 }, // print
+			{ 0x3ffff, 0x00001, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 }, // copy
+			{ 0x3ffff, 0x2954f, 0x0814d, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000 } // screen
+		}
+	};
+
+
+	constexpr char schemeNames[numFamilies][maxSchemes][PaletteRegistry::nameLength] =
+	{
+		{ "Spectral", "RdYlGn", "RdBu", "PiYG", "PRGn", "RdYlBu", "BrBG", "RdGy", "PuOr" },
+		{ "Set2", "Accent", "Set1", "Set3", "Dark2", "Paired", "Pastel2", "Pastel1" },
+		{ "OrRd", "PuBu", "BuPu", "Oranges", "BuGn", "YlOrBr", "YlGn", "Reds", "RdPu", "Greens", "YlGnBu", "Purples", "GnBu", "Greys", "YlOrRd", "PuRd", "Blues", "PuBuGn" }
+	};
+
+
+	constexpr PaletteRegistry::Layout builtinLayout =
+	{
+		{ 9, 8, 18 },
+		maxSchemes,
+		minClasses,
+		maxClasses,
+		1,
+		5067,
+		&schemeTable[0][0][0],
+		rgbTable,
+		normalizedTable,
+		rgb8Table,
+		labTable,
+		oklabTable,
+		&classIndex[0][0],
+		&propertyIndex[0][0][0],
+		&schemeNames[0][0]
+	};
+
+	// constant-initialized, no construction at runtime and no initialization order dependencies
+	constexpr PaletteRegistry builtinRegistry(builtinLayout);
+
+	// no schemes and no valid number of classes
+	constexpr PaletteRegistry::Layout emptyLayout =
+	{
+		{ 0, 0, 0 }, 0, 1, 0, 1, 0,
+		nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr
+	};
+
+
+	unsigned int propertyMask(const ColorBrewer::Properties *props, std::size_t numProps) noexcept
+	{
+		unsigned int mask = 0;
+
+		// unknown properties map to a bit no scheme has set
+		for (std::size_t i = 0; i < numProps; ++i)
+			mask |= (props[i] >= 0 && props[i] < numProperties) ? 1u << props[i] : 1u << numProperties;
+
+		return mask;
+	}
+}
+
+
+PaletteRegistry::PaletteRegistry()
+: m_layout(emptyLayout)
+{
+}
+
+const PaletteRegistry &PaletteRegistry::builtin()
+{
+	return builtinRegistry;
+}
+
+int PaletteRegistry::getNumSchemes(ColorBrewer::Family family) const noexcept
+{
+	if (family < 0 || family >= numFamilies)
+		return 0;
+
+	return m_layout.numSchemes[family];
+}
+
+int PaletteRegistry::getMaxClasses(ColorBrewer::Family family, int name) const
+{
+	for (int n = m_layout.maxClasses; n >= m_layout.minClasses; --n)
+	{
+		if (findScheme(family, name, n))
+			return n;
+	}
+
+	return 0;
+}
+
+const char *PaletteRegistry::getName(ColorBrewer::Family family, int name) const
+{
+	if (name < 0 || name >= getNumSchemes(family))
+		return "";
+
+	return m_layout.names[family * m_layout.schemeStride + name];
+}
+
+int PaletteRegistry::findName(ColorBrewer::Family family, const char *name) const
+{
+	for (int i = 0; i < getNumSchemes(family); ++i)
+	{
+		const char *entry = m_layout.names[family * m_layout.schemeStride + i];
+
+		int c = 0;
+		while (c < nameLength && entry[c] && entry[c] == name[c])
+			++c;
+
+		if (c == nameLength || entry[c] == name[c])
+			return i;
+	}
+
+	return -1;
+}
+
+const ColorBrewer::ColorScheme *PaletteRegistry::findScheme(ColorBrewer::Family family, int name, int n) const noexcept
+{
+	if (name < 0 || name >= getNumSchemes(family) || n < m_layout.minClasses || n > m_layout.maxClasses)
+		return nullptr;
+
+	int numClasses = m_layout.maxClasses - m_layout.minClasses + 1;
+	const ColorBrewer::ColorScheme &scheme = m_layout.entries[(family * m_layout.schemeStride + name) * numClasses + n - m_layout.minClasses];
+
+	return scheme.n != 0 ? &scheme : nullptr;
+}
+
+bool PaletteRegistry::hasProperties(const ColorBrewer::ColorScheme &scheme, const ColorBrewer::Properties *props, std::size_t numProps) noexcept
+{
+	unsigned int required = propertyMask(props, numProps);
+
+	return (scheme.propertyMask & required) == required;
+}
+
+ColorBrewer::ColorView PaletteRegistry::getView(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *props, std::size_t numProps, bool normalized) const
+{
+	const ColorBrewer::ColorScheme *scheme = findScheme(family, name, n);
+	if (!scheme || !hasProperties(*scheme, props, numProps))
+		return ColorBrewer::ColorView();
+
+	ColorBrewer::ColorView view;
+	view.rgb = getColors(*scheme, normalized);
+	view.n = scheme->n;
+
+	return view;
+}
+
+ColorBrewer::ColorView8 PaletteRegistry::getView8(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *props, std::size_t numProps) const
+{
+	const ColorBrewer::ColorScheme *scheme = findScheme(family, name, n);
+	if (!scheme || !hasProperties(*scheme, props, numProps))
+		return ColorBrewer::ColorView8();
+
+	ColorBrewer::ColorView8 view;
+	view.rgb = getColors8(*scheme);
+	view.n = scheme->n;
+
+	return view;
+}
+
+ColorBrewer::ColorView PaletteRegistry::getLabView(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *props, std::size_t numProps) const
+{
+	const ColorBrewer::ColorScheme *scheme = findScheme(family, name, n);
+	if (!scheme || !hasProperties(*scheme, props, numProps))
+		return ColorBrewer::ColorView();
+
+	ColorBrewer::ColorView view;
+	view.rgb = getLab(*scheme);
+	view.n = scheme->n;
+
+	return view;
+}
+
+ColorBrewer::ColorView PaletteRegistry::getOklabView(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *props, std::size_t numProps) const
+{
+	const ColorBrewer::ColorScheme *scheme = findScheme(family, name, n);
+	if (!scheme || !hasProperties(*scheme, props, numProps))
+		return ColorBrewer::ColorView();
+
+	ColorBrewer::ColorView view;
+	view.rgb = getOklab(*scheme);
+	view.n = scheme->n;
+
+	return view;
+}
+
+PaletteRegistry::Status PaletteRegistry::lookup(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *props, std::size_t numProps, bool normalized, ColorBrewer::ColorView &view) const noexcept
+{
+	const ColorBrewer::ColorScheme *scheme;
+	Status status = check(family, name, n, props, numProps, scheme);
+
+	view.rgb = status == found ? getColors(*scheme, normalized) : nullptr;
+	view.n = status == found ? scheme->n : 0;
+
+	return status;
+}
+
+PaletteRegistry::Status PaletteRegistry::lookup8(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *props, std::size_t numProps, ColorBrewer::ColorView8 &view) const noexcept
+{
+	const ColorBrewer::ColorScheme *scheme;
+	Status status = check(family, name, n, props, numProps, scheme);
+
+	view.rgb = status == found ? getColors8(*scheme) : nullptr;
+	view.n = status == found ? scheme->n : 0;
+
+	return status;
+}
+
+const char *PaletteRegistry::getMessage(Status status) noexcept
+{
+	switch (status)
+	{
+	case found:              return "Color scheme found.";
+	case unknownFamily:      return "No color scheme family with such value available.";
+	case unknownName:        return "No color scheme with such name available.";
+	case unavailableClasses: return "No color scheme with such number of classes available.";
+	case unknownProperty:    return "No property with such value available.";
+	case missingProperty:    return "Color scheme does not satisfy the properties.";
+	}
+
+	return "Unknown status.";
+}
+
+PaletteRegistry::Status PaletteRegistry::check(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *props, std::size_t numProps, const ColorBrewer::ColorScheme *&scheme) const noexcept
+{
+	scheme = nullptr;
+
+	if (family < 0 || family >= numFamilies)
+		return unknownFamily;
+
+	if (name < 0 || name >= m_layout.numSchemes[family])
+		return unknownName;
+
+	scheme = findScheme(family, name, n);
+	if (!scheme)
+		return unavailableClasses;
+
+	for (std::size_t i = 0; i < numProps; ++i)
+	{
+		if (props[i] < 0 || props[i] >= numProperties)
+			return unknownProperty;
+	}
+
+	return hasProperties(*scheme, props, numProps) ? found : missingProperty;
+}
+
+const float *PaletteRegistry::getColors(const ColorBrewer::ColorScheme &scheme, bool normalized) const noexcept
+{
+	return (normalized ? m_layout.normalized : m_layout.rgb) + scheme.offset;
+}
+
+const unsigned char *PaletteRegistry::getColors8(const ColorBrewer::ColorScheme &scheme) const noexcept
+{
+	return m_layout.rgb8 + scheme.offset;
+}
+
+const float *PaletteRegistry::getLab(const ColorBrewer::ColorScheme &scheme) const noexcept
+{
+	return m_layout.lab + scheme.offset;
+}
+
+const float *PaletteRegistry::getOklab(const ColorBrewer::ColorScheme &scheme) const noexcept
+{
+	return m_layout.oklab + scheme.offset;
+}
+
+void PaletteRegistry::getSchemeMask(ColorBrewer::Family family, int n, const ColorBrewer::Properties *props, std::size_t numProps, unsigned int *mask) const noexcept
+{
+	for (int w = 0; w < m_layout.indexWords; ++w)
+		mask[w] = getMaskWord(family, n, props, numProps, w);
+}
+
+unsigned int PaletteRegistry::getSchemeMask(ColorBrewer::Family family, int n, std::initializer_list<ColorBrewer::Properties> props) const noexcept
+{
+	return getMaskWord(family, n, props.begin(), props.size(), 0);
+}
+
+std::size_t PaletteRegistry::countSchemes(ColorBrewer::Family family, int n, const ColorBrewer::Properties *props, std::size_t numProps) const noexcept
+{
+	std::size_t count = 0;
+
+	for (int w = 0; w < m_layout.indexWords; ++w)
+		count += popCount(getMaskWord(family, n, props, numProps, w));
+
+	return count;
+}
+
+std::size_t PaletteRegistry::query(ColorBrewer::Family family, int n, const ColorBrewer::Properties *props, std::size_t numProps, bool normalized, float *colors, Entry *entries, std::size_t capacity) const noexcept
+{
+	std::size_t count = getEntries(family, n, props, numProps, entries, capacity);
+
+	for (std::size_t i = 0; i < count && i < capacity; ++i)
+	{
+		// every index bit has its scheme, load() rejects bundles where they disagree
+		const ColorBrewer::ColorScheme *scheme = findScheme(family, entries[i].name, n);
+		assert(scheme);
+		std::memcpy(colors + entries[i].offset, getColors(*scheme, normalized), 3 * entries[i].n * sizeof(float));
+	}
+
+	return count;
+}
+
+std::size_t PaletteRegistry::query8(ColorBrewer::Family family, int n, const ColorBrewer::Properties *props, std::size_t numProps, unsigned char *colors, Entry *entries, std::size_t capacity) const noexcept
+{
+	std::size_t count = getEntries(family, n, props, numProps, entries, capacity);
+
+	for (std::size_t i = 0; i < count && i < capacity; ++i)
+	{
+		const ColorBrewer::ColorScheme *scheme = findScheme(family, entries[i].name, n);
+		assert(scheme);
+		std::memcpy(colors + entries[i].offset, getColors8(*scheme), 3 * entries[i].n);
+	}
+
+	return count;
+}
+
+std::size_t PaletteRegistry::query(ColorBrewer::Family family, int n, const ColorBrewer::Properties *props, std::size_t numProps, bool normalized, std::vector<float> &colors, std::vector<Entry> &entries) const
+{
+	std::size_t count = countSchemes(family, n, props, numProps);
+
+	// resize only grows the capacity, reusing both vectors across queries does not allocate
+	colors.resize(3 * n * count);
+	entries.resize(count);
+
+	return query(family, n, props, numProps, normalized, colors.data(), entries.data(), count);
+}
+
+unsigned int PaletteRegistry::getMaskWord(ColorBrewer::Family family, int n, const ColorBrewer::Properties *props, std::size_t numProps, int word) const noexcept
+{
+	if (family < 0 || family >= numFamilies || n < m_layout.minClasses || n > m_layout.maxClasses)
+		return 0;
+
+	int numClasses = m_layout.maxClasses - m_layout.minClasses + 1;
+	int c = n - m_layout.minClasses;
+
+	unsigned int mask = m_layout.classIndex[(family * numClasses + c) * m_layout.indexWords + word];
+
+	for (std::size_t i = 0; i < numProps && mask; ++i)
+	{
+		if (props[i] < 0 || props[i] >= numProperties)
+			return 0;
+
+		mask &= m_layout.propertyIndex[((family * numProperties + props[i]) * numClasses + c) * m_layout.indexWords + word];
+	}
+
+	return mask;
+}
+
+std::size_t PaletteRegistry::getEntries(ColorBrewer::Family family, int n, const ColorBrewer::Properties *props, std::size_t numProps, Entry *entries, std::size_t capacity) const noexcept
+{
+	std::size_t count = 0;
+
+	for (int w = 0; w < m_layout.indexWords; ++w)
+	{
+		for (unsigned int mask = getMaskWord(family, n, props, numProps, w); mask; mask &= mask - 1, ++count)
+		{
+			if (count >= capacity)
+				continue;
+
+			entries[count].name = 32 * w + lowestBit(mask);
+			entries[count].offset = static_cast<unsigned int>(3 * n * count);
+			entries[count].n = n;
+		}
+	}
+
+	return count;
+}
+
+int PaletteRegistry::lowestBit(unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return static_cast<int>(index);
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+int PaletteRegistry::popCount(unsigned int mask)
+{
+#ifdef _MSC_VER
+	return static_cast<int>(__popcnt(mask));
+#else
+	return __builtin_popcount(mask);
+#endif
+}
@@ -0,0 +1,186 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef PALETTEREGISTRY
+#define PALETTEREGISTRY
+
+#include "ColorBrewer.h"
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+/**
+**  Immutable scheme registry over packed color tables.
+**  The built-in Color Brewer schemes are a constant-initialized instance shared by the whole process, so any number
+**  of threads can read it concurrently without locks or initialization order issues. All options such as the
+**  normalization are arguments of the individual calls.
+**
+**	Layout:
+**	entries:       ColorScheme [family][scheme < schemeStride][n - minClasses], n == 0 marks missing entries
+**	colors:        numValues values each as rgb [0, 255], normalized, 8 bit, CIELAB and OKLab, 3 * n per entry from ColorScheme::offset
+**	classIndex:    bitset over the schemes of a family with n classes, [family][n - minClasses][word]
+**	propertyIndex: bitset over the schemes satisfying a property, [family][property][n - minClasses][word]
+**	names:         zero terminated, nameLength chars per scheme, [family][scheme < schemeStride]
+**
+**	Usage:
+**  const PaletteRegistry &registry = PaletteRegistry::builtin();
+**	ColorBrewer::ColorView view = registry.getView(ColorBrewer::sequential, ColorBrewer::Blues, 5, {}, true);
+**	ColorBrewer::ColorView lab = registry.getLabView(ColorBrewer::sequential, ColorBrewer::Blues, 5);
+**
+**	std::vector<float> colors;
+**	std::vector<PaletteRegistry::Entry> entries;
+**	registry.query(ColorBrewer::sequential, 5, nullptr, 0, true, colors, entries);
+**
+**	PaletteRegistry::Status status = registry.lookup(family, name, n, {}, true, view);
+**	if (status != PaletteRegistry::found)
+**		return reject(PaletteRegistry::getMessage(status));
+**
+**/
+
+
+class PaletteRegistry
+{
+
+public:
+	static const int numFamilies = 3;
+	static const int numProperties = 4;
+	static const int nameLength = 32;
+
+	// result of lookup(), in the order the checks are made
+	enum Status
+	{
+		found, unknownFamily, unknownName, unavailableClasses, unknownProperty, missingProperty
+	};
+
+	// one palette of a batch query, offset counts values (3 per color) from the start of the color buffer
+	struct Entry
+	{
+		int name;
+		unsigned int offset;
+		unsigned int n;
+	};
+
+	struct Layout
+	{
+		int numSchemes[numFamilies];
+		int schemeStride;
+		int minClasses;
+		int maxClasses;
+		int indexWords;
+		unsigned int numValues;
+
+		const ColorBrewer::ColorScheme *entries;
+		const float *rgb;
+		const float *normalized;
+		const unsigned char *rgb8;
+		const float *lab;
+		const float *oklab;
+		const unsigned int *classIndex;
+		const unsigned int *propertyIndex;
+		const char (*names)[nameLength];
+	};
+
+
+public:
+	// registry without schemes
+	PaletteRegistry();
+	constexpr explicit PaletteRegistry(const Layout &layout) : m_layout(layout) {}
+
+	// Color Brewer schemes, name is the value of ColorBrewer::Diverging, Qualitative or Sequential
+	static const PaletteRegistry &builtin();
+
+	const Layout &layout() const { return m_layout; }
+
+	int getNumSchemes(ColorBrewer::Family family) const noexcept;
+	int getMaxClasses(ColorBrewer::Family family, int name) const;
+
+	// scheme name, empty if the scheme does not exist; find returns -1 for unknown names
+	const char *getName(ColorBrewer::Family family, int name) const;
+	int findName(ColorBrewer::Family family, const char *name) const;
+
+	// registry entry, nullptr if not available
+	const ColorBrewer::ColorScheme *findScheme(ColorBrewer::Family family, int name, int n) const noexcept;
+	static bool hasProperties(const ColorBrewer::ColorScheme &scheme, const ColorBrewer::Properties *properties, std::size_t numProperties) noexcept;
+
+	ColorBrewer::ColorView getView(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, bool normalized) const;
+	ColorBrewer::ColorView8 getView8(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *properties, std::size_t numProperties) const;
+
+	ColorBrewer::ColorView getView(ColorBrewer::Family family, int name, int n, std::initializer_list<ColorBrewer::Properties> properties = {}, bool normalized = true) const
+	{
+		return getView(family, name, n, properties.begin(), properties.size(), normalized);
+	}
+
+	ColorBrewer::ColorView8 getView8(ColorBrewer::Family family, int name, int n, std::initializer_list<ColorBrewer::Properties> properties = {}) const
+	{
+		return getView8(family, name, n, properties.begin(), properties.size());
+	}
+
+	// precomputed CIELAB and OKLab copies of a scheme, the view holds 3 values per color in the order of the rgb view
+	ColorBrewer::ColorView getLabView(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *properties, std::size_t numProperties) const;
+	ColorBrewer::ColorView getOklabView(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *properties, std::size_t numProperties) const;
+
+	ColorBrewer::ColorView getLabView(ColorBrewer::Family family, int name, int n, std::initializer_list<ColorBrewer::Properties> properties = {}) const
+	{
+		return getLabView(family, name, n, properties.begin(), properties.size());
+	}
+
+	ColorBrewer::ColorView getOklabView(ColorBrewer::Family family, int name, int n, std::initializer_list<ColorBrewer::Properties> properties = {}) const
+	{
+		return getOklabView(family, name, n, properties.begin(), properties.size());
+	}
+
+	// checked lookup without output, exceptions or allocation, view is empty unless the status is found
+	Status lookup(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, bool normalized, ColorBrewer::ColorView &view) const noexcept;
+	Status lookup8(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, ColorBrewer::ColorView8 &view) const noexcept;
+
+	Status lookup(ColorBrewer::Family family, int name, int n, std::initializer_list<ColorBrewer::Properties> properties, bool normalized, ColorBrewer::ColorView &view) const noexcept
+	{
+		return lookup(family, name, n, properties.begin(), properties.size(), normalized, view);
+	}
+
+	Status lookup8(ColorBrewer::Family family, int name, int n, std::initializer_list<ColorBrewer::Properties> properties, ColorBrewer::ColorView8 &view) const noexcept
+	{
+		return lookup8(family, name, n, properties.begin(), properties.size(), view);
+	}
+
+	// static description of a status, e.g. for logging outside the hot path
+	static const char *getMessage(Status status) noexcept;
+
+	// colors of an entry of this registry
+	const float *getColors(const ColorBrewer::ColorScheme &scheme, bool normalized) const noexcept;
+	const unsigned char *getColors8(const ColorBrewer::ColorScheme &scheme) const noexcept;
+	const float *getLab(const ColorBrewer::ColorScheme &scheme) const noexcept;
+	const float *getOklab(const ColorBrewer::ColorScheme &scheme) const noexcept;
+
+	// bitset over the schemes of a family with n classes and all properties, writes layout().indexWords words
+	void getSchemeMask(ColorBrewer::Family family, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, unsigned int *mask) const noexcept;
+
+	// first word of the bitset, covers the schemes 0 to 31
+	unsigned int getSchemeMask(ColorBrewer::Family family, int n, std::initializer_list<ColorBrewer::Properties> properties = {}) const noexcept;
+
+	// number of schemes of a family with n classes and all properties
+	std::size_t countSchemes(ColorBrewer::Family family, int n, const ColorBrewer::Properties *properties, std::size_t numProperties) const noexcept;
+
+	// batch query: all matching palettes back to back, entries in order of the scheme names. Fills at most capacity
+	// entries, colors holds 3 * n * capacity values. Returns the number of matches, which may exceed capacity.
+	std::size_t query(ColorBrewer::Family family, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, bool normalized, float *colors, Entry *entries, std::size_t capacity) const noexcept;
+	std::size_t query8(ColorBrewer::Family family, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, unsigned char *colors, Entry *entries, std::size_t capacity) const noexcept;
+
+	// batch query into vectors sized to the result
+	std::size_t query(ColorBrewer::Family family, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, bool normalized, std::vector<float> &colors, std::vector<Entry> &entries) const;
+
+	// index of the lowest set bit of a non-zero mask word and number of set bits
+	static int lowestBit(unsigned int mask);
+	static int popCount(unsigned int mask);
+
+
+private:
+	unsigned int getMaskWord(ColorBrewer::Family family, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, int word) const noexcept;
+	std::size_t getEntries(ColorBrewer::Family family, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, Entry *entries, std::size_t capacity) const noexcept;
+	Status check(ColorBrewer::Family family, int name, int n, const ColorBrewer::Properties *properties, std::size_t numProperties, const ColorBrewer::ColorScheme *&scheme) const noexcept;
+
+	Layout m_layout;
+};
+
+
+#endif
@@ -0,0 +1,410 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "PixelFormat.h"
+#include "ColorSpace.h"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PIXELFORMAT_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(PIXELFORMAT_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PIXELFORMAT_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PIXELFORMAT_TARGET(isa)
+#endif
+
+
+namespace
+{
+	const std::size_t blockSize = 256;
+
+	bool hasF16c()
+	{
+#if defined(PIXELFORMAT_X86) && defined(_MSC_VER)
+		static const bool f16c = []()
+		{
+			int info[4];
+			__cpuid(info, 1);
+			return (info[2] & (1 << 29)) != 0 && (info[2] & (1 << 28)) != 0;
+		}();
+		return f16c;
+#elif defined(PIXELFORMAT_X86)
+		static const bool f16c = __builtin_cpu_supports("f16c") && __builtin_cpu_supports("avx");
+		return f16c;
+#else
+		return false;
+#endif
+	}
+
+	inline float clamp(float c)
+	{
+		return c > 0.0f ? (c < 1.0f ? c : 1.0f) : 0.0f;
+	}
+
+	// same rounding as the 8 bit tables of ColorLut
+	inline unsigned int quantize(float c, float levels)
+	{
+		return static_cast<unsigned int>(clamp(c) * levels + 0.5f);
+	}
+
+#ifdef PIXELFORMAT_X86
+	PIXELFORMAT_TARGET("avx,f16c")
+	void toHalfF16c(const float *in, std::uint16_t *out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), h);
+		}
+
+		for (; i < count; ++i)
+			out[i] = PixelFormat::toHalf(in[i]);
+	}
+
+	PIXELFORMAT_TARGET("avx,f16c")
+	void fromHalfF16c(const std::uint16_t *in, float *out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+		}
+
+		for (; i < count; ++i)
+			out[i] = PixelFormat::fromHalf(in[i]);
+	}
+#endif
+}
+
+
+std::uint16_t PixelFormat::toHalf(float value)
+{
+	std::uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	std::uint32_t sign = (bits >> 16) & 0x8000u;
+	std::uint32_t abs = bits & 0x7fffffffu;
+
+	// NaN keeps the top of its payload and becomes quiet, like F16C
+	if (abs > 0x7f800000u)
+		return static_cast<std::uint16_t>(sign | 0x7e00u | ((abs >> 13) & 0x3ffu));
+
+	// 65536 and beyond, infinity included
+	if (abs >= 0x47800000u)
+		return static_cast<std::uint16_t>(sign | 0x7c00u);
+
+	// below 2^-14: subnormal half, the float mantissa with its implicit bit shifted into place
+	if (abs < 0x38800000u)
+	{
+		unsigned int shift = 126 - (abs >> 23);
+		if (shift > 24)
+			return static_cast<std::uint16_t>(sign);
+
+		std::uint32_t mantissa = (abs & 0x7fffffu) | 0x800000u;
+		std::uint32_t result = mantissa >> shift;
+		std::uint32_t rest = mantissa & ((1u << shift) - 1);
+		std::uint32_t half = 1u << (shift - 1);
+
+		if (rest > half || (rest == half && (result & 1)))
+			++result;
+
+		return static_cast<std::uint16_t>(sign | result);
+	}
+
+	// normal, rebias the exponent from 127 to 15; a carry out of the mantissa rounds up to the next exponent
+	std::uint32_t result = (abs - 0x38000000u) >> 13;
+	std::uint32_t rest = abs & 0x1fffu;
+
+	if (rest > 0x1000u || (rest == 0x1000u && (result & 1)))
+		++result;
+
+	return static_cast<std::uint16_t>(sign | result);
+}
+
+float PixelFormat::fromHalf(std::uint16_t value)
+{
+	std::uint32_t sign = static_cast<std::uint32_t>(value & 0x8000u) << 16;
+	std::uint32_t exponent = (value >> 10) & 0x1fu;
+	std::uint32_t mantissa = value & 0x3ffu;
+	std::uint32_t bits;
+
+	if (exponent == 0)
+	{
+		// zero or subnormal, exact in float
+		float magnitude = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+		std::memcpy(&bits, &magnitude, sizeof(bits));
+		bits |= sign;
+	}
+	else if (exponent == 31)
+	{
+		// infinity, or NaN made quiet like F16C
+		bits = sign | 0x7f800000u | (mantissa << 13) | (mantissa ? 0x400000u : 0u);
+	}
+	else
+	{
+		bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+
+	float result;
+	std::memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+
+void PixelFormat::toHalf(const float *in, std::uint16_t *out, std::size_t count)
+{
+#ifdef PIXELFORMAT_X86
+	if (hasF16c())
+	{
+		toHalfF16c(in, out, count);
+		return;
+	}
+#endif
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = toHalf(in[i]);
+}
+
+void PixelFormat::fromHalf(const std::uint16_t *in, float *out, std::size_t count)
+{
+#ifdef PIXELFORMAT_X86
+	if (hasF16c())
+	{
+		fromHalfF16c(in, out, count);
+		return;
+	}
+#endif
+	for (std::size_t i = 0; i < count; ++i)
+		out[i] = fromHalf(in[i]);
+}
+
+std::uint16_t PixelFormat::packRgb565(float r, float g, float b)
+{
+	return static_cast<std::uint16_t>((quantize(r, 31.0f) << 11) | (quantize(g, 63.0f) << 5) | quantize(b, 31.0f));
+}
+
+std::uint16_t PixelFormat::packRgba4444(float r, float g, float b, float a)
+{
+	return static_cast<std::uint16_t>((quantize(r, 15.0f) << 12) | (quantize(g, 15.0f) << 8) | (quantize(b, 15.0f) << 4) | quantize(a, 15.0f));
+}
+
+void PixelFormat::encode(const float *colors, std::size_t count, void *out, ColorMapper::Format format, unsigned int stride)
+{
+	if (stride < 3)
+	{
+		std::cout << "PixelFormat::encode(): Stride must be at least 3.";
+		return;
+	}
+
+	unsigned char *bytes = static_cast<unsigned char *>(out);
+	std::size_t pixelSize = ColorMapper::pixelSize(format);
+
+	// rgba blocks, half floats are converted a block at a time
+	float rgba[4 * blockSize];
+	std::uint16_t halves[4 * blockSize];
+
+	for (std::size_t i = 0; i < count; i += blockSize)
+	{
+		std::size_t n = count - i < blockSize ? count - i : blockSize;
+		const float *in = colors + i * stride;
+		unsigned char *dst = bytes + i * pixelSize;
+
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			rgba[4 * k + 0] = in[k * stride + 0];
+			rgba[4 * k + 1] = in[k * stride + 1];
+			rgba[4 * k + 2] = in[k * stride + 2];
+			rgba[4 * k + 3] = stride > 3 ? in[k * stride + 3] : 1.0f;
+		}
+
+		if (format == ColorMapper::rgba16f)
+		{
+			toHalf(rgba, halves, 4 * n);
+			std::memcpy(dst, halves, 8 * n);
+			continue;
+		}
+
+		for (std::size_t k = 0; k < n; ++k)
+		{
+			const float *c = &rgba[4 * k];
+			unsigned char *o = dst + k * pixelSize;
+
+			switch (format)
+			{
+			case ColorMapper::rgb:
+				std::memcpy(o, c, 12);
+				break;
+			case ColorMapper::rgba:
+				std::memcpy(o, c, 16);
+				break;
+			case ColorMapper::rgb8:
+			case ColorMapper::rgba8:
+			{
+				unsigned char p[4] = { static_cast<unsigned char>(quantize(c[0], 255.0f)), static_cast<unsigned char>(quantize(c[1], 255.0f)),
+					static_cast<unsigned char>(quantize(c[2], 255.0f)), static_cast<unsigned char>(quantize(c[3], 255.0f)) };
+				std::memcpy(o, p, pixelSize);
+				break;
+			}
+			case ColorMapper::bgra8:
+			{
+				unsigned char p[4] = { static_cast<unsigned char>(quantize(c[2], 255.0f)), static_cast<unsigned char>(quantize(c[1], 255.0f)),
+					static_cast<unsigned char>(quantize(c[0], 255.0f)), static_cast<unsigned char>(quantize(c[3], 255.0f)) };
+				std::memcpy(o, p, 4);
+				break;
+			}
+			case ColorMapper::rgb565:
+			{
+				std::uint16_t p = packRgb565(c[0], c[1], c[2]);
+				std::memcpy(o, &p, 2);
+				break;
+			}
+			case ColorMapper::rgba4444:
+			{
+				std::uint16_t p = packRgba4444(c[0], c[1], c[2], c[3]);
+				std::memcpy(o, &p, 2);
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+}
+
+void PixelFormat::decode(const void *pixels, std::size_t count, float *rgba, ColorMapper::Format format)
+{
+	const unsigned char *bytes = static_cast<const unsigned char *>(pixels);
+	std::size_t pixelSize = ColorMapper::pixelSize(format);
+
+	if (format == ColorMapper::rgba16f)
+	{
+		std::vector<std::uint16_t> halves(4 * count);
+		std::memcpy(halves.data(), bytes, 8 * count);
+		fromHalf(halves.data(), rgba, 4 * count);
+		return;
+	}
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const unsigned char *p = bytes + i * pixelSize;
+		float *c = rgba + 4 * i;
+		c[3] = 1.0f;
+
+		switch (format)
+		{
+		case ColorMapper::rgb:
+			std::memcpy(c, p, 12);
+			break;
+		case ColorMapper::rgba:
+			std::memcpy(c, p, 16);
+			break;
+		case ColorMapper::rgb8:
+		case ColorMapper::rgba8:
+		case ColorMapper::bgra8:
+		{
+			bool swap = format == ColorMapper::bgra8;
+			c[0] = p[swap ? 2 : 0] / 255.0f;
+			c[1] = p[1] / 255.0f;
+			c[2] = p[swap ? 0 : 2] / 255.0f;
+			if (pixelSize == 4)
+				c[3] = p[3] / 255.0f;
+			break;
+		}
+		case ColorMapper::rgb565:
+		{
+			std::uint16_t v;
+			std::memcpy(&v, p, 2);
+			c[0] = static_cast<float>(v >> 11) / 31.0f;
+			c[1] = static_cast<float>((v >> 5) & 0x3f) / 63.0f;
+			c[2] = static_cast<float>(v & 0x1f) / 31.0f;
+			break;
+		}
+		case ColorMapper::rgba4444:
+		{
+			std::uint16_t v;
+			std::memcpy(&v, p, 2);
+			c[0] = static_cast<float>(v >> 12) / 15.0f;
+			c[1] = static_cast<float>((v >> 8) & 0xf) / 15.0f;
+			c[2] = static_cast<float>((v >> 4) & 0xf) / 15.0f;
+			c[3] = static_cast<float>(v & 0xf) / 15.0f;
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
+PixelFormat::Error PixelFormat::error(const float *colors, std::size_t count, ColorMapper::Format format, unsigned int stride)
+{
+	Error result = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+	if (stride < 3 || count == 0)
+		return result;
+
+	std::vector<unsigned char> pixels(count * ColorMapper::pixelSize(format));
+	std::vector<float> decoded(4 * count);
+	encode(colors, count, pixels.data(), format, stride);
+	decode(pixels.data(), count, decoded.data(), format);
+
+	// the fixed point encoders clamp, their reference is clamped as well so that out of range inputs do not count as
+	// quantization error; the float formats keep out of range values
+	bool floatFormat = format == ColorMapper::rgb || format == ColorMapper::rgba || format == ColorMapper::rgba16f;
+	std::vector<float> planes(12 * count);
+	float *original[3] = { &planes[0], &planes[count], &planes[2 * count] };
+	float *roundTrip[3] = { &planes[3 * count], &planes[4 * count], &planes[5 * count] };
+	float *lab[3] = { &planes[6 * count], &planes[7 * count], &planes[8 * count] };
+	float *labRoundTrip[3] = { &planes[9 * count], &planes[10 * count], &planes[11 * count] };
+
+	bool hasAlpha = stride > 3 && ColorMapper::channels(format) == 4;
+	unsigned int channels = hasAlpha ? 4 : 3;
+	double squares = 0.0;
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		for (unsigned int c = 0; c < channels; ++c)
+		{
+			float reference = floatFormat ? colors[i * stride + c] : clamp(colors[i * stride + c]);
+			float d = std::fabs(decoded[4 * i + c] - reference);
+
+			result.maxChannel = d > result.maxChannel ? d : result.maxChannel;
+			squares += static_cast<double>(d) * d;
+
+			if (c < 3)
+			{
+				original[c][i] = reference;
+				roundTrip[c][i] = decoded[4 * i + c];
+			}
+		}
+	}
+
+	result.rmsChannel = static_cast<float>(std::sqrt(squares / static_cast<double>(count * channels)));
+
+	ColorSpace::rgbToLab(original, lab, count);
+	ColorSpace::rgbToLab(roundTrip, labRoundTrip, count);
+
+	double sum = 0.0;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		float d0 = lab[0][i] - labRoundTrip[0][i];
+		float d1 = lab[1][i] - labRoundTrip[1][i];
+		float d2 = lab[2][i] - labRoundTrip[2][i];
+		float deltaE = std::sqrt(d0 * d0 + d1 * d1 + d2 * d2);
+
+		result.maxDeltaE = deltaE > result.maxDeltaE ? deltaE : result.maxDeltaE;
+		sum += deltaE;
+	}
+
+	result.meanDeltaE = static_cast<float>(sum / static_cast<double>(count));
+	return result;
+}
@@ -0,0 +1,65 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef PIXELFORMAT
+#define PIXELFORMAT
+
+#include "ColorMapper.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+**  Conversion of normalized colors to the pixel formats of ColorMapper and back, for exporting palettes, tables and
+**  mapped outputs to memory constrained clients, with the quantization error of every format.
+**  Half floats are IEEE 754 binary16, rounded to nearest even; the batch conversions use F16C where the cpu has it
+**  and give the same bits as the scalar conversion.
+**
+**	Formats: rgba16f (4 half floats), rgb565 (red in the high bits of a std::uint16_t), rgba4444 (red in the high
+**	         nibble of a std::uint16_t) next to rgb, rgba, rgb8, rgba8 and bgra8
+**	Error: largest and rms channel error in normalized units, largest and mean CIE76 delta E after a round trip
+**
+**	Usage:
+**  PixelFormat::encode(lut->data(), lut->size(), texels, ColorMapper::rgb565); // or lut->rgb565() directly
+**	PixelFormat::encode(view.rgb, view.n, pixels, ColorMapper::rgba16f, 3); // palettes have 3 floats per color
+**	PixelFormat::Error error = PixelFormat::error(lut->data(), lut->size(), ColorMapper::rgba4444);
+**
+**/
+
+
+class PixelFormat
+{
+
+public:
+	struct Error
+	{
+		float maxChannel;
+		float rmsChannel;
+		float maxDeltaE;
+		float meanDeltaE;
+	};
+
+
+public:
+	static std::uint16_t toHalf(float value);
+	static float fromHalf(std::uint16_t value);
+
+	static void toHalf(const float *in, std::uint16_t *out, std::size_t count);
+	static void fromHalf(const std::uint16_t *in, float *out, std::size_t count);
+
+	// components in [0, 1], values outside are clamped
+	static std::uint16_t packRgb565(float r, float g, float b);
+	static std::uint16_t packRgba4444(float r, float g, float b, float a);
+
+	// count colors of stride floats, 3 for palettes and 4 for ColorLut::data(), alpha is 1 for stride 3;
+	// writes ColorMapper::pixelSize(format) bytes per color
+	static void encode(const float *colors, std::size_t count, void *out, ColorMapper::Format format, unsigned int stride = 4);
+
+	// pixels back to normalized rgba, 4 floats per pixel
+	static void decode(const void *pixels, std::size_t count, float *rgba, ColorMapper::Format format);
+
+	// round trip error of count colors, alpha counts for formats that store it
+	static Error error(const float *colors, std::size_t count, ColorMapper::Format format, unsigned int stride = 4);
+};
+
+
+#endif
@@ -0,0 +1,214 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <utility>
+
+
+namespace
+{
+	const unsigned int minCapacity = 8;
+
+	// capacity of level h out of numLevels, shrinking by 2/3 per level below the top
+	std::size_t levelCapacity(unsigned int k, std::size_t h, std::size_t numLevels)
+	{
+		double capacity = std::ceil(k * std::pow(2.0 / 3.0, static_cast<double>(numLevels - 1 - h)));
+		return std::max(static_cast<std::size_t>(capacity), static_cast<std::size_t>(minCapacity));
+	}
+}
+
+
+QuantileSketch::QuantileSketch(unsigned int k, std::uint32_t seed)
+: m_k(k),
+  m_seed(seed ? seed : 1)
+{
+	if (m_k < minCapacity)
+	{
+		std::cout << "QuantileSketch::QuantileSketch(): k must be at least 8.";
+		m_k = minCapacity;
+	}
+
+	clear();
+}
+
+void QuantileSketch::clear()
+{
+	m_count = 0;
+	m_min = std::numeric_limits<float>::infinity();
+	m_max = -m_min;
+
+	m_levels.assign(1, std::vector<float>());
+	m_levels[0].reserve(m_k);
+	m_size = 0;
+	updateCapacity();
+}
+
+void QuantileSketch::add(float value)
+{
+	if (value != value)
+		return;
+
+	m_min = value < m_min ? value : m_min;
+	m_max = value > m_max ? value : m_max;
+	++m_count;
+
+	m_levels[0].push_back(value);
+	if (++m_size >= m_capacity)
+		compress();
+}
+
+void QuantileSketch::add(const float *values, std::size_t count)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		float value = values[i];
+		if (value != value)
+			continue;
+
+		m_min = value < m_min ? value : m_min;
+		m_max = value > m_max ? value : m_max;
+		++m_count;
+
+		m_levels[0].push_back(value);
+		if (++m_size >= m_capacity)
+			compress();
+	}
+}
+
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+	if (&other == this || other.empty())
+		return;
+
+	if (other.m_levels.size() > m_levels.size())
+		m_levels.resize(other.m_levels.size());
+
+	for (std::size_t h = 0; h < other.m_levels.size(); ++h)
+		m_levels[h].insert(m_levels[h].end(), other.m_levels[h].begin(), other.m_levels[h].end());
+
+	m_size += other.m_size;
+	m_count += other.m_count;
+	m_min = other.m_min < m_min ? other.m_min : m_min;
+	m_max = other.m_max > m_max ? other.m_max : m_max;
+
+	updateCapacity();
+	while (m_size >= m_capacity)
+		compress();
+}
+
+float QuantileSketch::quantile(double rank) const
+{
+	float value;
+	quantiles(&rank, 1, &value);
+	return value;
+}
+
+void QuantileSketch::quantiles(const double *ranks, std::size_t count, float *values) const
+{
+	if (empty())
+	{
+		std::cout << "QuantileSketch::quantiles(): Sketch is empty.";
+		std::fill(values, values + count, std::numeric_limits<float>::quiet_NaN());
+		return;
+	}
+
+	// all retained items with their weights in ascending order
+	std::vector< std::pair<float, std::uint64_t> > items;
+	items.reserve(m_size);
+
+	for (std::size_t h = 0; h < m_levels.size(); ++h)
+	{
+		for (float value : m_levels[h])
+			items.push_back(std::make_pair(value, static_cast<std::uint64_t>(1) << h));
+	}
+
+	std::sort(items.begin(), items.end());
+
+	for (std::size_t i = 1; i < items.size(); ++i)
+		items[i].second += items[i - 1].second;
+
+	for (std::size_t r = 0; r < count; ++r)
+	{
+		double rank = ranks[r];
+		if (!(rank > 0.0))
+		{
+			values[r] = m_min;
+			continue;
+		}
+		if (rank >= 1.0)
+		{
+			values[r] = m_max;
+			continue;
+		}
+
+		std::uint64_t target = static_cast<std::uint64_t>(std::ceil(rank * static_cast<double>(m_count)));
+
+		std::size_t lo = 0;
+		std::size_t hi = items.size() - 1;
+		while (lo < hi)
+		{
+			std::size_t mid = lo + (hi - lo) / 2;
+			if (items[mid].second < target)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		values[r] = items[lo].first;
+	}
+}
+
+// Compacts the lowest level at capacity: sorted, then every second item from a random offset moves up with
+// twice the weight. An odd item stays behind so the total weight equals count() exactly.
+void QuantileSketch::compress()
+{
+	for (std::size_t h = 0; h < m_levels.size(); ++h)
+	{
+		if (m_levels[h].size() < m_capacities[h])
+			continue;
+
+		bool grow = h + 1 == m_levels.size();
+		if (grow)
+			m_levels.push_back(std::vector<float>());
+
+		std::vector<float> &level = m_levels[h];
+		std::vector<float> &next = m_levels[h + 1];
+		std::sort(level.begin(), level.end());
+
+		// xorshift32, one bit per compaction
+		m_seed ^= m_seed << 13;
+		m_seed ^= m_seed >> 17;
+		m_seed ^= m_seed << 5;
+
+		std::size_t keep = level.size() % 2;
+		std::size_t moved = (level.size() - keep) / 2;
+
+		for (std::size_t i = keep + (m_seed & 1); i < level.size(); i += 2)
+			next.push_back(level[i]);
+
+		level.resize(keep);
+		m_size -= moved;
+
+		if (grow)
+			updateCapacity();
+		return;
+	}
+}
+
+// the capacities only change with the number of levels
+void QuantileSketch::updateCapacity()
+{
+	m_capacities.resize(m_levels.size());
+	m_capacity = 0;
+
+	for (std::size_t h = 0; h < m_levels.size(); ++h)
+	{
+		m_capacities[h] = levelCapacity(m_k, h, m_levels.size());
+		m_capacity += m_capacities[h];
+	}
+}
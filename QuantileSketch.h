@@ -0,0 +1,76 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef QUANTILESKETCH
+#define QUANTILESKETCH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+**  Mergeable streaming quantile sketch (KLL, Karnin, Lang and Liberty 2016) for class breaks on unbounded data.
+**  Values are kept in a hierarchy of compactors, an item on level h stands for 2^h values. A full level is sorted
+**  and every second item moves up, so memory stays at about 3 * k items no matter how many values arrive.
+**  Sketches built on separate threads or batches merge into one with the same guarantees.
+**
+**	Accuracy: rank error of a quantile below 1.5% for k = 200 with high probability, minimum and maximum are exact
+**	Threads: a sketch is not synchronized, give each thread its own and merge them
+**
+**	Usage:
+**  QuantileSketch sketch;
+**	sketch.add(values, count); // per batch, on any number of sketches
+**	sketch.merge(other);
+**	ClassBreaks breaks;
+**	breaks.compute(sketch, 7);
+**
+**/
+
+
+class QuantileSketch
+{
+
+public:
+	// k >= 8, the seed makes the compactions reproducible
+	explicit QuantileSketch(unsigned int k = 200, std::uint32_t seed = 1);
+
+	// NaN is ignored
+	void add(float value);
+	void add(const float *values, std::size_t count);
+
+	void merge(const QuantileSketch &other);
+	void clear();
+
+	bool empty() const { return m_count == 0; }
+	std::uint64_t count() const { return m_count; }
+	unsigned int k() const { return m_k; }
+	std::size_t retained() const { return m_size; }
+
+	float minValue() const { return m_min; }
+	float maxValue() const { return m_max; }
+
+	// value of rank in [0, 1], the smallest value with at least rank * count() values up to and including it
+	float quantile(double rank) const;
+	void quantiles(const double *ranks, std::size_t count, float *values) const;
+
+
+private:
+	void compress();
+	void updateCapacity();
+
+	unsigned int m_k;
+	std::uint32_t m_seed;
+
+	std::uint64_t m_count;
+	float m_min;
+	float m_max;
+
+	// m_levels[h] holds the items of weight 2^h
+	std::vector< std::vector<float> > m_levels;
+	std::vector<std::size_t> m_capacities;
+	std::size_t m_size;
+	std::size_t m_capacity;
+};
+
+
+#endif
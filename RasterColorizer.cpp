@@ -0,0 +1,175 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "RasterColorizer.h"
+#include <algorithm>
+#include <vector>
+
+
+RasterColorizer::RasterColorizer(unsigned int numThreads)
+: m_pool(new ThreadPool(numThreads)),
+  m_tileWidth(256),
+  m_tileHeight(64)
+{
+}
+
+void RasterColorizer::setThreadCount(unsigned int numThreads)
+{
+	m_pool.reset(new ThreadPool(numThreads));
+}
+
+void RasterColorizer::setTileSize(std::size_t width, std::size_t height)
+{
+	m_tileWidth = width > 0 ? width : 1;
+	m_tileHeight = height > 0 ? height : 1;
+}
+
+void RasterColorizer::colorize(const ColorMapper &mapper, const float *values, std::size_t width, std::size_t height,
+	void *out, ColorMapper::Format format, std::size_t stride, std::size_t outStride)
+{
+	std::size_t pixelSize = ColorMapper::pixelSize(format);
+	unsigned char *outBytes = static_cast<unsigned char *>(out);
+
+	if (stride == 0)
+		stride = width;
+	if (outStride == 0)
+		outStride = width * pixelSize;
+
+	runTiles(width, height, [&](std::size_t x, std::size_t y, std::size_t w)
+	{
+		mapper.map(values + y * stride + x, w, outBytes + y * outStride + x * pixelSize, format);
+	});
+}
+
+void RasterColorizer::equalize(HistogramEqualizer &equalizer, const float *values, std::size_t width, std::size_t height,
+	void *out, ColorMapper::Format format, std::size_t stride, std::size_t outStride)
+{
+	if (stride == 0)
+		stride = width;
+
+	// bands of rows, a few per thread, each counted into its own histogram
+	std::size_t numBands = std::min<std::size_t>(4 * m_pool->size(), height);
+	std::size_t bandHeight = numBands > 0 ? (height + numBands - 1) / numBands : 0;
+	std::vector< std::vector<std::uint64_t> > counts(numBands, std::vector<std::uint64_t>(equalizer.bins(), 0));
+
+	m_pool->run(numBands, [&](std::size_t band)
+	{
+		// one scratch per band, folded once unless the band exceeds the 32 bit counters
+		std::vector<std::uint32_t> scratch(equalizer.scratchSize(), 0);
+		std::size_t pending = 0;
+
+		std::size_t y1 = std::min(height, (band + 1) * bandHeight);
+		for (std::size_t y = band * bandHeight; y < y1; ++y)
+		{
+			for (std::size_t x = 0; x < width;)
+			{
+				if (pending == HistogramEqualizer::maxScratchCount)
+				{
+					equalizer.fold(scratch.data(), counts[band].data());
+					pending = 0;
+				}
+
+				std::size_t n = std::min(width - x, HistogramEqualizer::maxScratchCount - pending);
+				equalizer.count(values + y * stride + x, n, scratch.data());
+				pending += n;
+				x += n;
+			}
+		}
+
+		equalizer.fold(scratch.data(), counts[band].data());
+	});
+
+	equalizer.clear();
+	for (std::size_t band = 0; band < numBands; ++band)
+		equalizer.add(counts[band].data());
+
+	colorize(equalizer.mapper(), values, width, height, out, format, stride, outStride);
+}
+
+void RasterColorizer::classify(const PaletteIndexer &indexer, const float *values, std::size_t width, std::size_t height,
+	void *indices, std::size_t stride, std::size_t outStride)
+{
+	std::size_t indexSize = PaletteIndexer::indexSize(indexer.depth());
+	unsigned char *outBytes = static_cast<unsigned char *>(indices);
+
+	if (stride == 0)
+		stride = width;
+	if (outStride == 0)
+		outStride = width * indexSize;
+
+	runTiles(width, height, [&](std::size_t x, std::size_t y, std::size_t w)
+	{
+		indexer.classify(values + y * stride + x, w, outBytes + y * outStride + x * indexSize);
+	});
+}
+
+void RasterColorizer::apply(const void *indices, PaletteIndexer::Depth depth, const void *palette, std::size_t width, std::size_t height,
+	void *out, ColorMapper::Format format, std::size_t stride, std::size_t outStride)
+{
+	std::size_t indexSize = PaletteIndexer::indexSize(depth);
+	std::size_t pixelSize = ColorMapper::pixelSize(format);
+	const unsigned char *inBytes = static_cast<const unsigned char *>(indices);
+	unsigned char *outBytes = static_cast<unsigned char *>(out);
+
+	if (stride == 0)
+		stride = width * indexSize;
+	if (outStride == 0)
+		outStride = width * pixelSize;
+
+	runTiles(width, height, [&](std::size_t x, std::size_t y, std::size_t w)
+	{
+		PaletteIndexer::apply(inBytes + y * stride + x * indexSize, depth, w, palette, outBytes + y * outStride + x * pixelSize, format);
+	});
+}
+
+void RasterColorizer::quantize(const PaletteQuantizer &quantizer, const unsigned char *rgb, std::size_t width, std::size_t height,
+	void *out, PaletteQuantizer::Output output, std::size_t stride, std::size_t outStride)
+{
+	std::size_t pixelSize = PaletteQuantizer::pixelSize(output);
+	unsigned char *outBytes = static_cast<unsigned char *>(out);
+
+	if (stride == 0)
+		stride = 3 * width;
+	if (outStride == 0)
+		outStride = width * pixelSize;
+
+	runTiles(width, height, [&](std::size_t x, std::size_t y, std::size_t w)
+	{
+		quantizer.quantize(rgb + y * stride + 3 * x, w, outBytes + y * outStride + x * pixelSize, output);
+	});
+}
+
+void RasterColorizer::decode(const ColorDecoder &decoder, const unsigned char *rgb, std::size_t width, std::size_t height,
+	float *values, float *distances, std::size_t stride, std::size_t outStride)
+{
+	if (stride == 0)
+		stride = 3 * width;
+	if (outStride == 0)
+		outStride = width;
+
+	runTiles(width, height, [&](std::size_t x, std::size_t y, std::size_t w)
+	{
+		decoder.decode(rgb + y * stride + 3 * x, w, values + y * outStride + x, distances ? distances + y * outStride + x : nullptr);
+	});
+}
+
+void RasterColorizer::runTiles(std::size_t width, std::size_t height, const std::function<void(std::size_t, std::size_t, std::size_t)> &row)
+{
+	std::size_t tilesX = (width + m_tileWidth - 1) / m_tileWidth;
+	std::size_t tilesY = (height + m_tileHeight - 1) / m_tileHeight;
+
+	std::size_t tileWidth = m_tileWidth;
+	std::size_t tileHeight = m_tileHeight;
+
+	m_pool->run(tilesX * tilesY, [&](std::size_t tile)
+	{
+		std::size_t x0 = (tile % tilesX) * tileWidth;
+		std::size_t y0 = (tile / tilesX) * tileHeight;
+		std::size_t w = x0 + tileWidth < width ? tileWidth : width - x0;
+		std::size_t y1 = y0 + tileHeight < height ? y0 + tileHeight : height;
+
+		for (std::size_t y = y0; y < y1; ++y)
+			row(x0, y, w);
+	});
+}
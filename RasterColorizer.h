@@ -0,0 +1,84 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef RASTERCOLORIZER
+#define RASTERCOLORIZER
+
+#include "ColorDecoder.h"
+#include "ColorMapper.h"
+#include "HistogramEqualizer.h"
+#include "PaletteIndexer.h"
+#include "PaletteQuantizer.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+/**
+**  Colorizes large rasters by splitting them into tiles which are mapped in parallel on a work-stealing thread pool.
+**  Every pixel goes through the same ColorMapper kernel, so the result is identical for any thread count and tile size.
+**
+**	Usage:
+**  RasterColorizer colorizer(64);
+**	colorizer.setTileSize(512, 64);
+**	colorizer.colorize(mapper, values, width, height, rgb, ColorMapper::rgb);
+**	colorizer.quantize(*PaletteQuantizer::get(ColorBrewer::qualitative, ColorBrewer::Set1, 9), image, width, height, indices);
+**	colorizer.decode(decoder, image, width, height, values);
+**	colorizer.equalize(equalizer, values, width, height, rgb, ColorMapper::rgb);
+**	colorizer.classify(indexer, values, width, height, indices);
+**	colorizer.apply(indices, indexer.depth(), palette.data(), width, height, rgb, ColorMapper::rgb);
+**
+**/
+
+
+class RasterColorizer
+{
+
+public:
+	// numThreads = 0 uses all hardware threads
+	explicit RasterColorizer(unsigned int numThreads = 0);
+
+	void setThreadCount(unsigned int numThreads);
+	unsigned int getThreadCount() const { return m_pool->size(); }
+
+	void setTileSize(std::size_t width, std::size_t height);
+
+	// stride is in floats and outStride in bytes, 0 means tightly packed rows
+	void colorize(const ColorMapper &mapper, const float *values, std::size_t width, std::size_t height,
+		void *out, ColorMapper::Format format = ColorMapper::rgb, std::size_t stride = 0, std::size_t outStride = 0);
+
+	// histogram equalized colorize: clears the equalizer, counts the raster into privatized histograms, then maps it
+	// through the warped table; stride is in floats and outStride in bytes, 0 means tightly packed rows
+	void equalize(HistogramEqualizer &equalizer, const float *values, std::size_t width, std::size_t height,
+		void *out, ColorMapper::Format format = ColorMapper::rgb, std::size_t stride = 0, std::size_t outStride = 0);
+
+	// index image of PaletteIndexer levels, stride is in floats and outStride in bytes, 0 means tightly packed rows
+	void classify(const PaletteIndexer &indexer, const float *values, std::size_t width, std::size_t height,
+		void *indices, std::size_t stride = 0, std::size_t outStride = 0);
+
+	// colors an index image through a palette, see PaletteIndexer::apply(); stride and outStride are in bytes,
+	// 0 means tightly packed rows
+	void apply(const void *indices, PaletteIndexer::Depth depth, const void *palette, std::size_t width, std::size_t height,
+		void *out, ColorMapper::Format format = ColorMapper::rgb, std::size_t stride = 0, std::size_t outStride = 0);
+
+	// quantize an 8 bit rgb image, stride and outStride are in bytes, 0 means tightly packed rows
+	void quantize(const PaletteQuantizer &quantizer, const unsigned char *rgb, std::size_t width, std::size_t height,
+		void *out, PaletteQuantizer::Output output = PaletteQuantizer::indices, std::size_t stride = 0, std::size_t outStride = 0);
+
+	// decode an 8 bit rgb image to values, stride is in bytes and outStride in floats, 0 means tightly packed rows
+	void decode(const ColorDecoder &decoder, const unsigned char *rgb, std::size_t width, std::size_t height,
+		float *values, float *distances = nullptr, std::size_t stride = 0, std::size_t outStride = 0);
+
+
+private:
+	// calls row(x, y, w) for every row segment of every tile, tiles run in parallel
+	void runTiles(std::size_t width, std::size_t height, const std::function<void(std::size_t, std::size_t, std::size_t)> &row);
+
+	std::unique_ptr<ThreadPool> m_pool;
+
+	std::size_t m_tileWidth;
+	std::size_t m_tileHeight;
+};
+
+
+#endif
@@ -0,0 +1,100 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "StreamColorizer.h"
+#include "MappedFile.h"
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+
+namespace
+{
+	// values per task within a chunk
+	const std::size_t blockSize = 1 << 16;
+}
+
+
+StreamColorizer::StreamColorizer(unsigned int numThreads)
+: m_pool(new ThreadPool(numThreads)),
+  m_chunkSize(std::size_t(1) << 24)
+{
+}
+
+void StreamColorizer::setChunkSize(std::size_t numValues)
+{
+	m_chunkSize = numValues > 0 ? numValues : 1;
+}
+
+bool StreamColorizer::colorize(const std::string &inputPath, const std::string &outputPath, const ColorMapper &mapper,
+	std::size_t width, Output output, ColorMapper::Format format)
+{
+	MappedFile input;
+	if (!input.open(inputPath))
+	{
+		std::cout << "StreamColorizer::colorize(): Cannot open input file.";
+		return false;
+	}
+
+	std::size_t count = input.size() / sizeof(float);
+	if (output == ppm && (width == 0 || count % width != 0))
+	{
+		std::cout << "StreamColorizer::colorize(): Input size is not a multiple of the width.";
+		return false;
+	}
+
+	std::FILE *file = std::fopen(outputPath.c_str(), "wb");
+	if (!file)
+	{
+		std::cout << "StreamColorizer::colorize(): Cannot open output file.";
+		return false;
+	}
+
+	if (output == ppm)
+	{
+		format = ColorMapper::rgb8;
+		std::fprintf(file, "P6\n%zu %zu\n255\n", width, count / width);
+	}
+
+	const float *values = static_cast<const float *>(input.data());
+	std::size_t pixelSize = ColorMapper::pixelSize(format);
+	std::size_t chunkSize = m_chunkSize;
+	std::vector<unsigned char> buffer(chunkSize * pixelSize);
+
+	input.advise(0, input.size(), MappedFile::sequential);
+	input.advise(0, chunkSize * sizeof(float), MappedFile::willNeed);
+
+	bool ok = true;
+	for (std::size_t begin = 0; begin < count && ok; begin += chunkSize)
+	{
+		std::size_t n = count - begin < chunkSize ? count - begin : chunkSize;
+
+		// read ahead the next chunk while this one is mapped and written
+		input.advise((begin + n) * sizeof(float), chunkSize * sizeof(float), MappedFile::willNeed);
+
+		const float *chunk = values + begin;
+		unsigned char *out = buffer.data();
+		std::size_t numBlocks = (n + blockSize - 1) / blockSize;
+
+		m_pool->run(numBlocks, [&](std::size_t block)
+		{
+			std::size_t offset = block * blockSize;
+			std::size_t length = n - offset < blockSize ? n - offset : blockSize;
+
+			mapper.map(chunk + offset, length, out + offset * pixelSize, format);
+		});
+
+		ok = std::fwrite(out, pixelSize, n, file) == n;
+
+		input.advise(begin * sizeof(float), n * sizeof(float), MappedFile::dontNeed);
+	}
+
+	if (std::fclose(file) != 0)
+		ok = false;
+
+	if (!ok)
+		std::cout << "StreamColorizer::colorize(): Cannot write output file.";
+
+	return ok;
+}
@@ -0,0 +1,56 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef STREAMCOLORIZER
+#define STREAMCOLORIZER
+
+#include "ColorMapper.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/**
+**  Colorizes raw float32 files which do not fit into memory.
+**  The input is memory mapped and processed in chunks: the next chunk is prefetched while the current one is
+**  mapped in parallel, written sequentially and released again, so resident memory stays around two chunks.
+**
+**	Outputs: ppm (binary P6, 8 bit rgb), raw (pixels in any ColorMapper::Format)
+**
+**	Usage:
+**  StreamColorizer colorizer;
+**	colorizer.colorize("field.f32", "field.ppm", mapper, width);
+**
+**/
+
+
+class StreamColorizer
+{
+
+public:
+	enum Output
+	{
+		ppm, raw
+	};
+
+
+public:
+	// numThreads = 0 uses all hardware threads
+	explicit StreamColorizer(unsigned int numThreads = 0);
+
+	// number of input values per chunk
+	void setChunkSize(std::size_t numValues);
+
+	// width is only used for the ppm header, the height follows from the file size;
+	// format applies to raw output, ppm is always rgb8
+	bool colorize(const std::string &inputPath, const std::string &outputPath, const ColorMapper &mapper,
+		std::size_t width, Output output = ppm, ColorMapper::Format format = ColorMapper::rgb8);
+
+
+private:
+	std::unique_ptr<ThreadPool> m_pool;
+	std::size_t m_chunkSize;
+};
+
+
+#endif
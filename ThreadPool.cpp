@@ -0,0 +1,147 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+
+#include "ThreadPool.h"
+
+
+ThreadPool::ThreadPool(unsigned int numThreads)
+: m_task(nullptr),
+  m_remaining(0),
+  m_generation(0),
+  m_stop(false)
+{
+	if (numThreads == 0)
+		numThreads = std::thread::hardware_concurrency();
+	if (numThreads == 0)
+		numThreads = 1;
+
+	// queue 0 belongs to the calling thread
+	for (unsigned int i = 0; i < numThreads; ++i)
+		m_queues.push_back(std::unique_ptr<Queue>(new Queue()));
+
+	for (unsigned int i = 1; i < numThreads; ++i)
+		m_threads.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+
+	for (std::size_t i = 0; i < m_threads.size(); ++i)
+		m_threads[i].join();
+}
+
+void ThreadPool::run(std::size_t count, const std::function<void(std::size_t)> &task)
+{
+	if (count == 0)
+		return;
+
+	std::lock_guard<std::mutex> runLock(m_runMutex);
+
+	if (m_threads.empty())
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			task(i);
+		return;
+	}
+
+	m_task = &task;
+	m_remaining = count;
+
+	// contiguous ranges per queue keep neighboring tiles on the same thread
+	std::size_t numQueues = m_queues.size();
+	for (std::size_t q = 0; q < numQueues; ++q)
+	{
+		std::size_t begin = count * q / numQueues;
+		std::size_t end = count * (q + 1) / numQueues;
+
+		std::lock_guard<std::mutex> lock(m_queues[q]->mutex);
+		for (std::size_t i = begin; i < end; ++i)
+			m_queues[q]->tasks.push_back(i);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_generation;
+	}
+	m_wake.notify_all();
+
+	work(0);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_remaining == 0; });
+}
+
+void ThreadPool::workerLoop(unsigned int id)
+{
+	unsigned long long generation = 0;
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&]() { return m_stop || m_generation != generation; });
+
+			if (m_stop)
+				return;
+
+			generation = m_generation;
+		}
+
+		work(id);
+	}
+}
+
+void ThreadPool::work(unsigned int id)
+{
+	std::size_t task;
+
+	while (pop(id, task) || steal(id, task))
+	{
+		(*m_task)(task);
+
+		if (--m_remaining == 0)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_done.notify_all();
+		}
+	}
+}
+
+bool ThreadPool::pop(unsigned int id, std::size_t &task)
+{
+	Queue &queue = *m_queues[id];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+
+	if (queue.tasks.empty())
+		return false;
+
+	task = queue.tasks.front();
+	queue.tasks.pop_front();
+	return true;
+}
+
+bool ThreadPool::steal(unsigned int id, std::size_t &task)
+{
+	std::size_t numQueues = m_queues.size();
+
+	for (std::size_t i = 1; i < numQueues; ++i)
+	{
+		Queue &victim = *m_queues[(id + i) % numQueues];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+
+		if (victim.tasks.empty())
+			continue;
+
+		task = victim.tasks.back();
+		victim.tasks.pop_back();
+		return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,70 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+#ifndef THREADPOOL
+#define THREADPOOL
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+**  Work-stealing thread pool for data parallel loops.
+**  Every worker owns a queue seeded with a contiguous range of tasks, takes tasks from its front
+**  and steals from the back of the other queues once it runs dry. The calling thread works as well.
+**
+**	Usage:
+**  ThreadPool pool(8);
+**	pool.run(numTiles, [&](std::size_t tile) { ... });
+**
+**/
+
+
+class ThreadPool
+{
+
+public:
+	// numThreads = 0 uses std::thread::hardware_concurrency(), the calling thread counts as one
+	explicit ThreadPool(unsigned int numThreads = 0);
+	~ThreadPool();
+
+	unsigned int size() const { return static_cast<unsigned int>(m_queues.size()); }
+
+	// runs task(i) for all i in [0, count) and returns once all are done, tasks must not throw
+	void run(std::size_t count, const std::function<void(std::size_t)> &task);
+
+
+private:
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<std::size_t> tasks;
+	};
+
+	void workerLoop(unsigned int id);
+	void work(unsigned int id);
+	bool pop(unsigned int id, std::size_t &task);
+	bool steal(unsigned int id, std::size_t &task);
+
+	std::vector<std::thread> m_threads;
+	std::vector< std::unique_ptr<Queue> > m_queues;
+
+	std::mutex m_runMutex;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+
+	const std::function<void(std::size_t)> *m_task;
+	std::atomic<std::size_t> m_remaining;
+	unsigned long long m_generation;
+	bool m_stop;
+};
+
+
+#endif
@@ -0,0 +1,730 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+/**
+**  Micro and macro benchmarks for the palette registry, lookup tables and batch mapping.
+**  Results are written as a JSON array, one object per benchmark with the median time per operation
+**  over several repetitions. Inputs come from a fixed seed so runs are comparable across releases.
+**
+**	Usage:
+**  colorbrewer_benchmark [--out results.json] [--filter name] [--repetitions 5] [--min-time 50]
+**
+**/
+
+#include "ClassBreaks.h"
+#include "ColorBrewer.h"
+#include "ColorDecoder.h"
+#include "ColorLut.h"
+#include "ColorMapper.h"
+#include "ColorSpace.h"
+#include "ColorVision.h"
+#include "HistogramEqualizer.h"
+#include "PaletteIndexer.h"
+#include "PaletteLoader.h"
+#include "PaletteQuantizer.h"
+#include "PaletteRegistry.h"
+#include "PixelFormat.h"
+#include "QuantileSketch.h"
+#include "RasterColorizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+	struct Options
+	{
+		std::string out;
+		std::string filter;
+		int repetitions;
+		double minTimeMs;
+	};
+
+	struct Result
+	{
+		std::string name;
+		std::string group;
+		std::size_t size;
+		unsigned long long iterations;
+		double nsPerOp;
+		double minNsPerOp;
+		double bytesPerOp;
+	};
+
+	// keeps results alive without the compiler proving them unused
+	volatile unsigned long long sink = 0;
+
+	class NullBuffer : public std::streambuf
+	{
+	protected:
+		int overflow(int c) { return c; }
+	};
+
+	class Runner
+	{
+	public:
+		explicit Runner(const Options &options)
+		: m_options(options)
+		{
+		}
+
+		// op runs one operation; size and bytesPerOp describe the work done by it
+		void run(const std::string &group, const std::string &name, std::size_t size, double bytesPerOp, const std::function<void()> &op)
+		{
+			std::string fullName = group + "/" + name;
+			if (!m_options.filter.empty() && fullName.find(m_options.filter) == std::string::npos)
+				return;
+
+			// calibrate the iteration count to roughly minTime per repetition
+			unsigned long long iterations = 1;
+			for (;;)
+			{
+				double ms = measure(op, iterations) / 1e6;
+				if (ms >= m_options.minTimeMs || iterations >= (1ull << 40))
+					break;
+
+				double factor = ms > 0.0 ? 1.4 * m_options.minTimeMs / ms : 100.0;
+				factor = std::min(std::max(factor, 2.0), 100.0);
+				iterations = static_cast<unsigned long long>(iterations * factor);
+			}
+
+			std::vector<double> times;
+			for (int r = 0; r < m_options.repetitions; ++r)
+				times.push_back(measure(op, iterations) / static_cast<double>(iterations));
+
+			std::sort(times.begin(), times.end());
+
+			Result result;
+			result.name = name;
+			result.group = group;
+			result.size = size;
+			result.iterations = iterations;
+			result.nsPerOp = times[times.size() / 2];
+			result.minNsPerOp = times.front();
+			result.bytesPerOp = bytesPerOp;
+			m_results.push_back(result);
+
+			std::fprintf(stderr, "%-40s %10zu %14.1f ns/op\n", fullName.c_str(), size, result.nsPerOp);
+		}
+
+		std::string json() const
+		{
+			std::ostringstream os;
+			os << "{\n  \"context\": { \"threads\": " << std::thread::hardware_concurrency()
+			   << ", \"isa\": " << ColorMapper::detectIsa() << " },\n  \"benchmarks\": [\n";
+
+			for (std::size_t i = 0; i < m_results.size(); ++i)
+			{
+				const Result &r = m_results[i];
+				double gbPerSecond = r.bytesPerOp > 0.0 ? r.bytesPerOp / r.nsPerOp : 0.0;
+
+				os << "    { \"group\": \"" << r.group << "\", \"name\": \"" << r.name << "\", \"size\": " << r.size
+				   << ", \"iterations\": " << r.iterations << ", \"ns_per_op\": " << r.nsPerOp
+				   << ", \"min_ns_per_op\": " << r.minNsPerOp << ", \"gb_per_s\": " << gbPerSecond << " }"
+				   << (i + 1 < m_results.size() ? ",\n" : "\n");
+			}
+
+			os << "  ]\n}\n";
+			return os.str();
+		}
+
+	private:
+		static double measure(const std::function<void()> &op, unsigned long long iterations)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			for (unsigned long long i = 0; i < iterations; ++i)
+				op();
+			std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+			return std::chrono::duration<double, std::nano>(end - start).count();
+		}
+
+		Options m_options;
+		std::vector<Result> m_results;
+	};
+
+	std::vector<float> makeValues(std::size_t count)
+	{
+		std::mt19937 rng(12345);
+		std::normal_distribution<float> dist(0.5f, 0.2f);
+
+		std::vector<float> values(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = dist(rng);
+
+		return values;
+	}
+
+	void benchmarkRegistry(Runner &runner)
+	{
+		runner.run("registry", "construct", 1, 0.0, []()
+		{
+			ColorBrewer brewer;
+			sink += reinterpret_cast<unsigned long long>(&brewer) & 1;
+		});
+
+		ColorBrewer brewer;
+
+		runner.run("registry", "getDiverging_hit", 9, 0.0, [&]()
+		{
+			sink += brewer.getDiverging(9, ColorBrewer::BrBG).size();
+		});
+
+		runner.run("registry", "getDiverging_miss", 13, 0.0, [&]()
+		{
+			sink += brewer.getDiverging(13, ColorBrewer::BrBG).size();
+		});
+
+		runner.run("registry", "getDivergingView_hit", 9, 0.0, [&]()
+		{
+			sink += brewer.getDivergingView(9, ColorBrewer::BrBG).size();
+		});
+
+		runner.run("registry", "getDivergingView_miss", 13, 0.0, [&]()
+		{
+			sink += brewer.getDivergingView(13, ColorBrewer::BrBG).size();
+		});
+
+		runner.run("filter", "getSequentials_none", 5, 0.0, [&]()
+		{
+			sink += brewer.getSequentials(5).size();
+		});
+
+		runner.run("filter", "getSequentials_blind", 5, 0.0, [&]()
+		{
+			sink += brewer.getSequentials(5, { ColorBrewer::blind }).size();
+		});
+
+		runner.run("filter", "getSequentials_blind_print", 5, 0.0, [&]()
+		{
+			sink += brewer.getSequentials(5, { ColorBrewer::blind, ColorBrewer::print }).size();
+		});
+
+		runner.run("filter", "getSchemeMask_blind_print", 5, 0.0, [&]()
+		{
+			sink += ColorBrewer::getSchemeMask(ColorBrewer::sequential, 5, { ColorBrewer::blind, ColorBrewer::print });
+		});
+
+		std::vector<float> colors;
+		std::vector<PaletteRegistry::Entry> entries;
+
+		runner.run("filter", "query_none", 5, 0.0, [&]()
+		{
+			sink += PaletteRegistry::builtin().query(ColorBrewer::sequential, 5, nullptr, 0, true, colors, entries);
+		});
+	}
+
+	// colorbrewer JSON definition of all built-in schemes, repeated under distinct names
+	std::string builtinJson(int copies)
+	{
+		const PaletteRegistry &registry = PaletteRegistry::builtin();
+		const char *types[PaletteRegistry::numFamilies] = { "div", "qual", "seq" };
+
+		std::ostringstream json;
+		json << "{";
+
+		for (int copy = 0; copy < copies; ++copy)
+		{
+			for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+			{
+				ColorBrewer::Family family = static_cast<ColorBrewer::Family>(f);
+				for (int name = 0; name < registry.getNumSchemes(family); ++name)
+				{
+					json << (copy + f + name > 0 ? ",\n" : "\n") << "\"" << registry.getName(family, name) << copy << "\": { \"type\": \"" << types[f] << "\"";
+
+					for (int n = 3; n <= registry.getMaxClasses(family, name); ++n)
+					{
+						ColorBrewer::ColorView8 view = registry.getView8(family, name, n);
+						json << ", \"" << n << "\": [";
+						for (unsigned int i = 0; i < view.n; ++i)
+							json << (i ? ", " : "") << "\"rgb(" << int(view[3 * i]) << "," << int(view[3 * i + 1]) << "," << int(view[3 * i + 2]) << ")\"";
+						json << "]";
+					}
+
+					json << " }";
+				}
+			}
+		}
+
+		json << "\n}\n";
+		return json.str();
+	}
+
+	void benchmarkLoader(Runner &runner)
+	{
+		const int copies[] = { 1, 100 };
+
+		for (int count : copies)
+		{
+			std::string json = builtinJson(count);
+
+			runner.run("loader", "parseJson", 35 * count, static_cast<double>(json.size()), [&]()
+			{
+				PaletteLoader loader;
+				loader.parseJson(json.data(), json.size());
+				sink += loader.size();
+			});
+		}
+	}
+
+	void benchmarkLut(Runner &runner)
+	{
+		const unsigned int sizes[] = { 256, 1024, 4096 };
+
+		for (unsigned int size : sizes)
+		{
+			ColorBrewer brewer;
+			ColorBrewer::ColorView view = brewer.getSequentialView(9, ColorBrewer::YlOrRd);
+
+			runner.run("lut", "build_rgb", size, 0.0, [&]()
+			{
+				ColorLut lut(view.rgb, view.n, size, ColorLut::rgb);
+				sink += lut.size();
+			});
+
+			runner.run("lut", "build_lab", size, 0.0, [&]()
+			{
+				ColorLut lut(view.rgb, view.n, size, ColorLut::lab);
+				sink += lut.size();
+			});
+
+			runner.run("lut", "build_oklab", size, 0.0, [&]()
+			{
+				ColorLut lut(view.rgb, view.n, size, ColorLut::oklab);
+				sink += lut.size();
+			});
+		}
+
+		runner.run("lut", "get_cached", 1024, 0.0, []()
+		{
+			sink += ColorLut::get(ColorBrewer::YlOrRd, 1024, ColorLut::lab)->size();
+		});
+	}
+
+	void benchmarkColorSpace(Runner &runner)
+	{
+		const std::size_t size = 1 << 16;
+
+		std::vector<float> values = makeValues(3 * size);
+		for (float &v : values)
+			v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+
+		const float *rgb[3] = { values.data(), values.data() + size, values.data() + 2 * size };
+		std::vector<float> out(3 * size);
+		float *channels[3] = { out.data(), out.data() + size, out.data() + 2 * size };
+
+		runner.run("colorspace", "rgb_to_lab_single", size, 24.0 * size, [&]()
+		{
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				float color[3] = { rgb[0][i], rgb[1][i], rgb[2][i] };
+				float lab[3];
+				ColorSpace::rgbToLab(color, lab);
+				channels[0][i] = lab[0];
+			}
+			sink += static_cast<unsigned long long>(out[0]);
+		});
+
+		runner.run("colorspace", "rgb_to_lab_batch", size, 24.0 * size, [&]()
+		{
+			ColorSpace::rgbToLab(rgb, channels, size);
+			sink += static_cast<unsigned long long>(out[0]);
+		});
+
+		runner.run("colorspace", "rgb_to_oklab_batch", size, 24.0 * size, [&]()
+		{
+			ColorSpace::rgbToOklab(rgb, channels, size);
+			sink += static_cast<unsigned long long>(out[0]);
+		});
+
+		ColorSpace::rgbToOklab(rgb, channels, size);
+		const float *oklab[3] = { channels[0], channels[1], channels[2] };
+		std::vector<float> back(3 * size);
+		float *backChannels[3] = { back.data(), back.data() + size, back.data() + 2 * size };
+
+		runner.run("colorspace", "oklab_to_rgb_batch", size, 24.0 * size, [&]()
+		{
+			ColorSpace::oklabToRgb(oklab, backChannels, size);
+			sink += static_cast<unsigned long long>(back[0]);
+		});
+
+		std::vector<std::uint16_t> halves(3 * size);
+
+		runner.run("colorspace", "to_half_batch", 3 * size, 18.0 * size, [&]()
+		{
+			PixelFormat::toHalf(values.data(), halves.data(), 3 * size);
+			sink += halves[0];
+		});
+
+		runner.run("colorspace", "from_half_batch", 3 * size, 18.0 * size, [&]()
+		{
+			PixelFormat::fromHalf(halves.data(), back.data(), 3 * size);
+			sink += static_cast<unsigned long long>(back[0]);
+		});
+	}
+
+	void benchmarkColorVision(Runner &runner)
+	{
+		const std::size_t size = 1 << 20;
+		const unsigned int n = 9;
+		const std::size_t numPalettes = 1 << 12;
+
+		std::vector<unsigned char> image(3 * size);
+		std::mt19937 generator(11);
+		for (unsigned char &c : image)
+			c = static_cast<unsigned char>(generator());
+
+		std::vector<unsigned char> out(3 * size);
+
+		runner.run("cvd", "simulate_image", size, 6.0 * size, [&]()
+		{
+			ColorVision::simulate(image.data(), out.data(), size, ColorVision::deuteranopia);
+			sink += out[0];
+		});
+
+		std::vector<float> palettes(3 * n * numPalettes);
+		std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+		for (float &c : palettes)
+			c = dist(generator);
+
+		std::vector<ColorVision::Score> scores(numPalettes);
+
+		runner.run("cvd", "score_lab", numPalettes, 0.0, [&]()
+		{
+			ColorVision::score(palettes.data(), n, numPalettes, scores.data());
+			sink += static_cast<unsigned long long>(scores[0].worst());
+		});
+
+		runner.run("cvd", "score_oklab", numPalettes, 0.0, [&]()
+		{
+			ColorVision::score(palettes.data(), n, numPalettes, scores.data(), ColorVision::oklab);
+			sink += static_cast<unsigned long long>(100.0f * scores[0].worst());
+		});
+	}
+
+	void benchmarkClassBreaks(Runner &runner)
+	{
+		const std::size_t size = 1 << 22;
+		const char *methodNames[] = { "equal_interval", "quantile", "jenks" };
+
+		std::vector<float> values = makeValues(size);
+		for (float &v : values)
+			v = std::exp(4.0f * v);
+
+		std::vector<unsigned char> classes(size);
+		ClassBreaks breaks;
+
+		for (int method = ClassBreaks::equalInterval; method <= ClassBreaks::jenks; ++method)
+		{
+			runner.run("breaks", methodNames[method], size, 4.0 * size, [&]()
+			{
+				breaks.compute(values.data(), size, 7, static_cast<ClassBreaks::Method>(method));
+				sink += breaks.size();
+			});
+		}
+
+		runner.run("breaks", "classify", size, 5.0 * size, [&]()
+		{
+			breaks.classify(values.data(), size, classes.data());
+			sink += classes[0];
+		});
+
+		runner.run("breaks", "sketch_add", size, 4.0 * size, [&]()
+		{
+			QuantileSketch sketch;
+			sketch.add(values.data(), size);
+			sink += sketch.retained();
+		});
+
+		QuantileSketch parts[8];
+		for (std::size_t p = 0; p < 8; ++p)
+			parts[p].add(values.data() + p * (size / 8), size / 8);
+
+		runner.run("breaks", "sketch_merge_breaks", 8, 0.0, [&]()
+		{
+			QuantileSketch sketch;
+			for (const QuantileSketch &part : parts)
+				sketch.merge(part);
+
+			breaks.compute(sketch, 7);
+			sink += breaks.size();
+		});
+	}
+
+	void benchmarkMapping(Runner &runner)
+	{
+		const std::size_t sizes[] = { 1 << 10, 1 << 16, 1 << 20, 1 << 23 };
+		const ColorMapper::Format formats[] = { ColorMapper::rgb, ColorMapper::rgba8, ColorMapper::rgba16f, ColorMapper::rgb565 };
+		const char *formatNames[] = { "rgb", "rgba8", "rgba16f", "rgb565" };
+		const char *isaNames[] = { "scalar", "sse41", "avx2", "neon" };
+
+		ColorMapper mapper(ColorLut::get(ColorBrewer::YlOrRd, 4096, ColorLut::lab), 0.0f, 1.0f);
+		ColorMapper::Isa best = ColorMapper::detectIsa();
+
+		for (std::size_t size : sizes)
+		{
+			std::vector<float> values = makeValues(size);
+			std::vector<unsigned char> out(size * 16);
+
+			for (int f = 0; f < 4; ++f)
+			{
+				for (int isa = ColorMapper::scalar; isa <= ColorMapper::neon; ++isa)
+				{
+					if (isa != ColorMapper::scalar && isa != best && !(best == ColorMapper::avx2 && isa == ColorMapper::sse41))
+						continue;
+
+					mapper.setIsa(static_cast<ColorMapper::Isa>(isa));
+					double bytes = static_cast<double>(size) * (sizeof(float) + ColorMapper::pixelSize(formats[f]));
+
+					runner.run("map", std::string(formatNames[f]) + "_" + isaNames[isa], size, bytes, [&]()
+					{
+						mapper.map(values.data(), values.size(), out.data(), formats[f]);
+						sink += out[0];
+					});
+				}
+			}
+		}
+
+		mapper.setIsa(best);
+
+		const std::size_t width = 4096;
+		const std::size_t height = 4096;
+		std::vector<float> raster = makeValues(width * height);
+		std::vector<std::uint32_t> pixels(width * height);
+		double bytes = static_cast<double>(width * height) * (sizeof(float) + 4);
+
+		unsigned int threads[] = { 1, std::max(1u, std::thread::hardware_concurrency()) };
+		for (unsigned int t = 0; t < (threads[1] > 1 ? 2u : 1u); ++t)
+		{
+			RasterColorizer colorizer(threads[t]);
+
+			std::ostringstream name;
+			name << "raster_rgba8_threads" << threads[t];
+
+			runner.run("map", name.str(), width * height, bytes, [&]()
+			{
+				colorizer.colorize(mapper, raster.data(), width, height, pixels.data(), ColorMapper::rgba8);
+				sink += pixels[0];
+			});
+		}
+
+		// scheme switch on a raster classified once: palette rebuild plus one gather pass
+		const PaletteIndexer::Depth depths[] = { PaletteIndexer::index8, PaletteIndexer::index16 };
+		const char *depthNames[] = { "index8", "index16" };
+		std::shared_ptr<const ColorLut> luts[] = { ColorLut::get(ColorBrewer::YlOrRd, 4096, ColorLut::lab), ColorLut::get(ColorBrewer::Blues, 4096, ColorLut::lab) };
+
+		RasterColorizer indexColorizer(threads[1]);
+		std::vector<std::uint16_t> indices(width * height);
+
+		for (int d = 0; d < 2; ++d)
+		{
+			PaletteIndexer indexer(-0.5f, 1.5f, depths[d]);
+			double indexBytes = static_cast<double>(width * height) * PaletteIndexer::indexSize(depths[d]);
+
+			runner.run("map", std::string("classify_") + depthNames[d], width * height, static_cast<double>(width * height) * sizeof(float) + indexBytes, [&]()
+			{
+				indexColorizer.classify(indexer, raster.data(), width, height, indices.data());
+				sink += indices[0];
+			});
+
+			int scheme = 0;
+			runner.run("map", std::string("switch_rgba8_") + depthNames[d], width * height, indexBytes + static_cast<double>(width * height) * 4, [&]()
+			{
+				scheme ^= 1;
+				std::vector<unsigned char> palette = indexer.palette(ColorMapper(luts[scheme], 0.0f, 1.0f), ColorMapper::rgba8);
+				indexColorizer.apply(indices.data(), depths[d], palette.data(), width, height, pixels.data(), ColorMapper::rgba8);
+				sink += pixels[0];
+			});
+		}
+
+		// heavy-tailed raster, counted and mapped in two passes
+		for (float &v : raster)
+			v = std::exp(8.0f * v);
+
+		HistogramEqualizer equalizer(ColorLut::get(ColorBrewer::YlOrRd, 1024), 0.0f, 1000.0f);
+		for (unsigned int t = 0; t < (threads[1] > 1 ? 2u : 1u); ++t)
+		{
+			RasterColorizer colorizer(threads[t]);
+
+			std::ostringstream name;
+			name << "equalize_rgba8_threads" << threads[t];
+
+			runner.run("map", name.str(), width * height, 2.0 * bytes, [&]()
+			{
+				colorizer.equalize(equalizer, raster.data(), width, height, pixels.data(), ColorMapper::rgba8);
+				sink += pixels[0];
+			});
+		}
+	}
+
+	void benchmarkDecoder(Runner &runner)
+	{
+		const std::size_t size = 1 << 20;
+		const char *isaNames[] = { "scalar", "sse41", "avx2", "neon" };
+
+		std::shared_ptr<const ColorLut> lut = ColorLut::get(ColorBrewer::YlOrRd, 256);
+		ColorMapper mapper(lut, 0.0f, 1.0f);
+		std::vector<float> values = makeValues(size);
+		std::vector<unsigned char> image(3 * size);
+		mapper.map(values.data(), size, image.data(), ColorMapper::rgb8);
+
+		std::vector<float> distances(size);
+
+		runner.run("decode", "build_bits5", lut->size(), 0.0, [&]()
+		{
+			ColorLut copy(*lut);
+			ColorDecoder decoder(std::make_shared<const ColorLut>(copy), 0.0f, 1.0f, 5);
+			sink += decoder.cube()[0];
+		});
+
+		ColorDecoder decoder(lut);
+		ColorMapper::Isa best = decoder.getIsa();
+
+		for (int isa = ColorMapper::scalar; isa <= ColorMapper::neon; ++isa)
+		{
+			if (isa != ColorMapper::scalar && isa != best)
+				continue;
+
+			decoder.setIsa(static_cast<ColorMapper::Isa>(isa));
+
+			runner.run("decode", std::string("values_") + isaNames[isa], size, 7.0 * size, [&]()
+			{
+				decoder.decode(image.data(), size, values.data());
+				sink += static_cast<unsigned long long>(values[0]);
+			});
+
+			runner.run("decode", std::string("distances_") + isaNames[isa], size, 11.0 * size, [&]()
+			{
+				decoder.decode(image.data(), size, values.data(), distances.data());
+				sink += static_cast<unsigned long long>(distances[0]);
+			});
+		}
+	}
+
+	void benchmarkQuantizer(Runner &runner)
+	{
+		const std::size_t size = 1 << 20;
+		const char *isaNames[] = { "scalar", "sse41", "avx2", "neon" };
+
+		std::vector<unsigned char> image(3 * size);
+		std::mt19937 generator(7);
+		for (unsigned char &c : image)
+			c = static_cast<unsigned char>(generator());
+
+		std::vector<unsigned char> out(4 * size);
+
+		runner.run("quantize", "build_bits5", 9, 0.0, []()
+		{
+			ColorBrewer::ColorView view = PaletteRegistry::builtin().getView(ColorBrewer::qualitative, ColorBrewer::Set1, 9);
+			PaletteQuantizer quantizer(view.rgb, view.n, 5);
+			sink += quantizer.cube()[0];
+		});
+
+		PaletteQuantizer quantizer(*PaletteQuantizer::get(ColorBrewer::qualitative, ColorBrewer::Set1, 9));
+		ColorMapper::Isa best = quantizer.getIsa();
+
+		for (int isa = ColorMapper::scalar; isa <= ColorMapper::neon; ++isa)
+		{
+			if (isa != ColorMapper::scalar && isa != best)
+				continue;
+
+			quantizer.setIsa(static_cast<ColorMapper::Isa>(isa));
+
+			runner.run("quantize", std::string("indices_") + isaNames[isa], size, 4.0 * size, [&]()
+			{
+				quantizer.quantize(image.data(), size, out.data());
+				sink += out[0];
+			});
+
+			runner.run("quantize", std::string("rgba8_") + isaNames[isa], size, 7.0 * size, [&]()
+			{
+				quantizer.quantize(image.data(), size, out.data(), PaletteQuantizer::rgba8);
+				sink += out[0];
+			});
+		}
+	}
+
+	bool parseOptions(int argc, char **argv, Options &options)
+	{
+		options.repetitions = 5;
+		options.minTimeMs = 50.0;
+
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if (arg == "--out" && hasValue)
+				options.out = argv[++i];
+			else if (arg == "--filter" && hasValue)
+				options.filter = argv[++i];
+			else if (arg == "--repetitions" && hasValue)
+				options.repetitions = std::max(1, std::atoi(argv[++i]));
+			else if (arg == "--min-time" && hasValue)
+				options.minTimeMs = std::max(1.0, std::atof(argv[++i]));
+			else
+				return false;
+		}
+
+		return true;
+	}
+}
+
+
+int main(int argc, char **argv)
+{
+	Options options;
+	if (!parseOptions(argc, argv, options))
+	{
+		std::fprintf(stderr, "usage: %s [--out results.json] [--filter name] [--repetitions n] [--min-time ms]\n", argv[0]);
+		return 1;
+	}
+
+	// the legacy getters report misses on std::cout, keep them out of the results
+	NullBuffer nullBuffer;
+	std::streambuf *coutBuffer = std::cout.rdbuf(&nullBuffer);
+
+	Runner runner(options);
+	benchmarkRegistry(runner);
+	benchmarkLoader(runner);
+	benchmarkColorSpace(runner);
+	benchmarkColorVision(runner);
+	benchmarkClassBreaks(runner);
+	benchmarkLut(runner);
+	benchmarkMapping(runner);
+	benchmarkDecoder(runner);
+	benchmarkQuantizer(runner);
+
+	std::cout.rdbuf(coutBuffer);
+
+	std::string json = runner.json();
+	if (options.out.empty())
+	{
+		std::fputs(json.c_str(), stdout);
+		return 0;
+	}
+
+	std::FILE *file = std::fopen(options.out.c_str(), "w");
+	if (!file)
+	{
+		std::fprintf(stderr, "cannot write %s\n", options.out.c_str());
+		return 1;
+	}
+
+	std::fputs(json.c_str(), file);
+	std::fclose(file);
+
+	return 0;
+}
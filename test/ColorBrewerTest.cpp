@@ -0,0 +1,1124 @@
+//Author: Julian Kratt
+//Date: 17.10.2026
+
+/**
+**  Reference checks for the batch kernels, parsers and optimizations: vector kernels against the scalar ones,
+**  optimized results against direct or brute force ones, round trips and malformed input.
+**  Each group is registered as its own ctest test; without arguments all groups run.
+**
+**	Usage:
+**  colorbrewer_test [group ...]
+**
+**/
+
+#include "ClassBreaks.h"
+#include "ColorBrewer.h"
+#include "ColorDecoder.h"
+#include "ColorLut.h"
+#include "ColorMapper.h"
+#include "ColorSpace.h"
+#include "ColorVision.h"
+#include "HistogramEqualizer.h"
+#include "PaletteBundle.h"
+#include "PaletteIndexer.h"
+#include "PaletteLoader.h"
+#include "PaletteQuantizer.h"
+#include "PaletteRegistry.h"
+#include "PixelFormat.h"
+#include "QuantileSketch.h"
+#include "RasterColorizer.h"
+#include "StreamColorizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	int failures = 0;
+
+	// the library reports rejected input on std::cout, keep the expected messages out of the test log
+	class NullBuffer : public std::streambuf
+	{
+	protected:
+		int overflow(int c) { return c; }
+	};
+
+	void check(bool condition, const char *group, const std::string &what)
+	{
+		if (condition)
+			return;
+
+		std::fprintf(stderr, "%s: %s failed\n", group, what.c_str());
+		++failures;
+	}
+
+	std::vector<float> makeValues(std::size_t count, std::uint32_t seed)
+	{
+		std::mt19937 rng(seed);
+		std::normal_distribution<float> dist(0.5f, 0.3f);
+
+		std::vector<float> values(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = dist(rng);
+
+		// specials the kernels have to agree on
+		if (count > 3)
+		{
+			values[0] = std::numeric_limits<float>::quiet_NaN();
+			values[1] = -std::numeric_limits<float>::infinity();
+			values[2] = std::numeric_limits<float>::infinity();
+		}
+
+		return values;
+	}
+
+	std::vector<unsigned char> makePixels(std::size_t count, std::uint32_t seed)
+	{
+		std::mt19937 rng(seed);
+
+		std::vector<unsigned char> pixels(3 * count);
+		for (std::size_t i = 0; i < pixels.size(); ++i)
+			pixels[i] = static_cast<unsigned char>(rng());
+
+		return pixels;
+	}
+
+	std::vector<ColorMapper::Isa> supportedIsas()
+	{
+		std::vector<ColorMapper::Isa> isas(1, ColorMapper::scalar);
+		ColorMapper::Isa best = ColorMapper::detectIsa();
+
+		if (best == ColorMapper::avx2)
+			isas.push_back(ColorMapper::sse41);
+		if (best != ColorMapper::scalar)
+			isas.push_back(best);
+
+		return isas;
+	}
+
+	// serialized bundle in 16 byte aligned storage, as load() requires
+	struct AlignedBundle
+	{
+		explicit AlignedBundle(const std::vector<unsigned char> &bytes)
+		: storage((bytes.size() + 15) / 16),
+		  size(bytes.size())
+		{
+			std::memcpy(data(), bytes.data(), bytes.size());
+		}
+
+		unsigned char *data() { return reinterpret_cast<unsigned char *>(storage.data()); }
+		PaletteBundle::Header &header() { return *reinterpret_cast<PaletteBundle::Header *>(data()); }
+
+		std::vector<long double> storage;
+		std::size_t size;
+	};
+
+	// JSON definition of numSchemes sequential schemes with 3 to 5 classes each
+	std::string makeJson(int numSchemes)
+	{
+		std::ostringstream json;
+		json << "{";
+
+		for (int s = 0; s < numSchemes; ++s)
+		{
+			json << (s ? ",\n" : "\n") << "\"Scheme" << s << "\": { \"type\": \"seq\", \"blind\": [" << (s % 2) << "]";
+			for (int n = 3; n <= 5; ++n)
+			{
+				json << ", \"" << n << "\": [";
+				for (int i = 0; i < n; ++i)
+					json << (i ? ", " : "") << "\"rgb(" << (s * 5) % 256 << "," << (i * 50) % 256 << "," << (s + i) % 256 << ")\"";
+				json << "]";
+			}
+			json << " }";
+		}
+
+		json << "\n}";
+		return json.str();
+	}
+
+	bool sameViews(const PaletteRegistry &a, const PaletteRegistry &b)
+	{
+		for (int f = 0; f < PaletteRegistry::numFamilies; ++f)
+		{
+			ColorBrewer::Family family = static_cast<ColorBrewer::Family>(f);
+			if (a.getNumSchemes(family) != b.getNumSchemes(family))
+				return false;
+
+			for (int name = 0; name < a.getNumSchemes(family); ++name)
+			{
+				for (int n = 1; n <= a.getMaxClasses(family, name); ++n)
+				{
+					ColorBrewer::ColorView8 va = a.getView8(family, name, n);
+					ColorBrewer::ColorView8 vb = b.getView8(family, name, n);
+
+					if (va.n != vb.n || (va.n && std::memcmp(va.rgb, vb.rgb, va.size()) != 0))
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void testMapper()
+	{
+		const char *group = "mapper";
+		std::vector<float> values = makeValues(1003, 1);
+		const ColorLut::Interpolation interpolations[] = { ColorLut::rgb, ColorLut::lab, ColorLut::classes };
+
+		for (ColorLut::Interpolation interpolation : interpolations)
+		{
+			ColorMapper mapper(ColorLut::get(ColorBrewer::YlOrRd, 1024, interpolation), -0.2f, 1.3f);
+
+			for (int f = ColorMapper::rgb; f <= ColorMapper::rgba4444; ++f)
+			{
+				ColorMapper::Format format = static_cast<ColorMapper::Format>(f);
+				std::size_t bytes = values.size() * ColorMapper::pixelSize(format);
+
+				mapper.setIsa(ColorMapper::scalar);
+				std::vector<unsigned char> reference(bytes);
+				mapper.map(values.data(), values.size(), reference.data(), format);
+
+				for (ColorMapper::Isa isa : supportedIsas())
+				{
+					// odd offsets and lengths exercise the scalar tails
+					for (std::size_t offset = 0; offset < 3; ++offset)
+					{
+						mapper.setIsa(isa);
+						std::vector<unsigned char> out(bytes + 16, 0xcd);
+						mapper.map(values.data() + offset, values.size() - offset, out.data(), format);
+
+						std::ostringstream what;
+						what << "format " << f << " isa " << isa << " offset " << offset;
+						check(std::memcmp(out.data(), reference.data() + offset * ColorMapper::pixelSize(format), bytes - offset * ColorMapper::pixelSize(format)) == 0, group, what.str());
+						check(out[bytes - offset * ColorMapper::pixelSize(format)] == 0xcd, group, what.str() + " writes past the end");
+					}
+				}
+			}
+		}
+
+		ColorMapper fallback(std::shared_ptr<const ColorLut>(), 0.0f, 1.0f);
+		float color[3];
+		float one = 1.0f;
+		fallback.map(&one, 1, color);
+		check(color[0] == 1.0f && color[1] == 1.0f && color[2] == 1.0f, group, "missing table");
+	}
+
+	void testRaster()
+	{
+		const char *group = "raster";
+		const std::size_t width = 301;
+		const std::size_t height = 97;
+		const std::size_t stride = 320;
+
+		std::vector<float> values = makeValues(stride * height, 2);
+		ColorMapper mapper(ColorLut::get(ColorBrewer::RdBu, 512, ColorLut::lab), 0.0f, 1.0f);
+
+		std::vector<std::uint32_t> reference(width * height);
+		for (std::size_t y = 0; y < height; ++y)
+			mapper.map(values.data() + y * stride, width, reference.data() + y * width, ColorMapper::rgba8);
+
+		RasterColorizer colorizer(3);
+		colorizer.setTileSize(64, 7);
+
+		std::vector<std::uint32_t> pixels(width * height);
+		colorizer.colorize(mapper, values.data(), width, height, pixels.data(), ColorMapper::rgba8, stride);
+		check(pixels == reference, group, "colorize");
+	}
+
+	std::vector<unsigned char> readFile(const char *path)
+	{
+		std::vector<unsigned char> bytes;
+		std::FILE *file = std::fopen(path, "rb");
+		if (!file)
+			return bytes;
+
+		unsigned char buffer[4096];
+		std::size_t n;
+		while ((n = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+			bytes.insert(bytes.end(), buffer, buffer + n);
+
+		std::fclose(file);
+		return bytes;
+	}
+
+	void testStream()
+	{
+		const char *group = "stream";
+		const std::size_t width = 211;
+		const std::size_t height = 53;
+		const char *inputPath = "colorbrewer_test_stream.f32";
+		const char *outputPath = "colorbrewer_test_stream.out";
+
+		std::vector<float> values = makeValues(width * height, 8);
+		std::FILE *file = std::fopen(inputPath, "wb");
+		check(file && std::fwrite(values.data(), sizeof(float), values.size(), file) == values.size(), group, "write input");
+		if (file)
+			std::fclose(file);
+
+		ColorMapper mapper(ColorLut::get(ColorBrewer::Spectral, 256, ColorLut::oklab), 0.0f, 1.0f);
+		StreamColorizer colorizer(3);
+		colorizer.setChunkSize(1000);
+
+		// chunks, prefetching and the parallel mapping give the pixels of one direct map() call
+		std::vector<unsigned char> rgb(3 * values.size());
+		mapper.map(values.data(), values.size(), rgb.data(), ColorMapper::rgb8);
+
+		std::ostringstream header;
+		header << "P6\n" << width << " " << height << "\n255\n";
+		std::string text = header.str();
+		std::vector<unsigned char> ppm(text.begin(), text.end());
+		ppm.insert(ppm.end(), rgb.begin(), rgb.end());
+
+		check(colorizer.colorize(inputPath, outputPath, mapper, width) && readFile(outputPath) == ppm, group, "ppm");
+
+		std::vector<unsigned char> rgba16f(8 * values.size());
+		mapper.map(values.data(), values.size(), rgba16f.data(), ColorMapper::rgba16f);
+		check(colorizer.colorize(inputPath, outputPath, mapper, width, StreamColorizer::raw, ColorMapper::rgba16f) && readFile(outputPath) == rgba16f, group, "raw rgba16f");
+
+		// rejected input
+		check(!colorizer.colorize("colorbrewer_test_missing.f32", outputPath, mapper, width), group, "missing input");
+		check(!colorizer.colorize(inputPath, outputPath, mapper, width + 1), group, "width does not divide the input");
+		check(!colorizer.colorize(inputPath, outputPath, mapper, 0), group, "zero width");
+
+		std::remove(inputPath);
+		std::remove(outputPath);
+	}
+
+	void testLookup()
+	{
+		const char *group = "lookup";
+		const PaletteRegistry &builtin = PaletteRegistry::builtin();
+		ColorBrewer::ColorView view;
+		ColorBrewer::ColorView8 view8;
+
+		// the view of a found scheme is the one of getView(), every other status leaves it empty
+		ColorBrewer::ColorView reference = builtin.getView(ColorBrewer::sequential, ColorBrewer::Blues, 5);
+		check(builtin.lookup(ColorBrewer::sequential, ColorBrewer::Blues, 5, {}, true, view) == PaletteRegistry::found &&
+			view.n == 5 && view.rgb == reference.rgb, group, "found");
+		check(builtin.lookup8(ColorBrewer::sequential, ColorBrewer::Blues, 5, {}, view8) == PaletteRegistry::found &&
+			view8.n == 5 && view8.rgb == builtin.getView8(ColorBrewer::sequential, ColorBrewer::Blues, 5).rgb, group, "found 8 bit");
+
+		struct Case
+		{
+			ColorBrewer::Family family;
+			int name;
+			int n;
+			ColorBrewer::Properties property;
+			PaletteRegistry::Status status;
+			const char *what;
+		};
+
+		const Case cases[] =
+		{
+			{ static_cast<ColorBrewer::Family>(PaletteRegistry::numFamilies), 0, 5, ColorBrewer::print, PaletteRegistry::unknownFamily, "family past the end" },
+			{ ColorBrewer::sequential, -1, 5, ColorBrewer::print, PaletteRegistry::unknownName, "negative name" },
+			{ ColorBrewer::sequential, builtin.getNumSchemes(ColorBrewer::sequential), 5, ColorBrewer::print, PaletteRegistry::unknownName, "name past the end" },
+			{ ColorBrewer::sequential, ColorBrewer::Blues, 1, ColorBrewer::print, PaletteRegistry::unavailableClasses, "too few classes" },
+			{ ColorBrewer::sequential, ColorBrewer::Blues, 99, ColorBrewer::print, PaletteRegistry::unavailableClasses, "too many classes" },
+			// the family is checked before the name, the name before the classes
+			{ static_cast<ColorBrewer::Family>(PaletteRegistry::numFamilies), -1, 99, ColorBrewer::print, PaletteRegistry::unknownFamily, "family first" },
+			{ ColorBrewer::sequential, -1, 99, ColorBrewer::print, PaletteRegistry::unknownName, "name before classes" },
+		};
+
+		for (const Case &c : cases)
+		{
+			ColorBrewer::Properties properties[1] = { c.property };
+			view = reference;
+			view8 = builtin.getView8(ColorBrewer::sequential, ColorBrewer::Blues, 5);
+
+			PaletteRegistry::Status status = builtin.lookup(c.family, c.name, c.n, properties, 1, true, view);
+			PaletteRegistry::Status status8 = builtin.lookup8(c.family, c.name, c.n, properties, 1, view8);
+			check(status == c.status && status8 == c.status && view.empty() && view8.empty(), group, c.what);
+		}
+
+		// loaded schemes alternate between color blind safe and not
+		PaletteLoader loader;
+		std::string json = makeJson(2);
+		check(loader.parseJson(json.data(), json.size()), group, "parse");
+
+		const PaletteRegistry &registry = loader.registry();
+		int unsafe = registry.findName(ColorBrewer::sequential, "Scheme0");
+		int safe = registry.findName(ColorBrewer::sequential, "Scheme1");
+		check(registry.lookup(ColorBrewer::sequential, unsafe, 4, { ColorBrewer::blind }, true, view) == PaletteRegistry::missingProperty && view.empty(), group, "missing property");
+		check(registry.lookup(ColorBrewer::sequential, safe, 4, { ColorBrewer::blind }, true, view) == PaletteRegistry::found && view.n == 4, group, "satisfied property");
+		check(registry.lookup(ColorBrewer::sequential, unsafe, 4, {}, true, view) == PaletteRegistry::found, group, "no properties");
+
+		// every status has its own message
+		std::vector<std::string> messages;
+		for (int status = PaletteRegistry::found; status <= PaletteRegistry::missingProperty; ++status)
+			messages.push_back(PaletteRegistry::getMessage(static_cast<PaletteRegistry::Status>(status)));
+
+		std::sort(messages.begin(), messages.end());
+		check(std::unique(messages.begin(), messages.end()) == messages.end(), group, "messages");
+	}
+
+	void testBundle()
+	{
+		const char *group = "bundle";
+
+		// built-in tables and a loaded registry with more than 32 schemes per family
+		PaletteLoader loader;
+		std::string json = makeJson(40);
+		check(loader.parseJson(json.data(), json.size()) && loader.size() == 40, group, "parse 40 schemes");
+
+		const PaletteRegistry *registries[] = { &PaletteRegistry::builtin(), &loader.registry() };
+		for (const PaletteRegistry *registry : registries)
+		{
+			AlignedBundle bundle(PaletteBundle::serialize(*registry));
+
+			PaletteBundle loaded;
+			check(loaded.load(bundle.data(), bundle.size), group, "load");
+			check(sameViews(*registry, loaded.registry()), group, "round trip");
+
+			std::vector<float> colors;
+			std::vector<PaletteRegistry::Entry> entries;
+			ColorBrewer::Properties blind = ColorBrewer::blind;
+			check(loaded.registry().query(ColorBrewer::sequential, 4, &blind, 1, true, colors, entries) ==
+				registry->query(ColorBrewer::sequential, 4, &blind, 1, true, colors, entries), group, "query");
+		}
+
+		check(loader.registry().countSchemes(ColorBrewer::sequential, 3, nullptr, 0) == 40, group, "count beyond one index word");
+
+		AlignedBundle reference(PaletteBundle::serialize(loader.registry()));
+		PaletteBundle bundle;
+
+		{
+			AlignedBundle broken(reference);
+			broken.data()[0] = 'X';
+			check(!bundle.load(broken.data(), broken.size), group, "bad magic");
+		}
+		{
+			check(!bundle.load(reference.data(), sizeof(PaletteBundle::Header) - 1), group, "truncated header");
+			check(!bundle.load(reference.data(), reference.size / 2), group, "truncated file");
+		}
+		{
+			AlignedBundle broken(reference);
+			broken.header().version = PaletteBundle::version + 1;
+			check(!bundle.load(broken.data(), broken.size), group, "bad version");
+		}
+		{
+			AlignedBundle broken(reference);
+			broken.header().indexWords = 0x40000000;
+			check(!bundle.load(broken.data(), broken.size), group, "index words out of range");
+		}
+		{
+			AlignedBundle broken(reference);
+			broken.header().names = 0xfffffff0u;
+			check(!bundle.load(broken.data(), broken.size), group, "section out of bounds");
+		}
+		{
+			AlignedBundle broken(reference);
+			ColorBrewer::ColorScheme *entries = reinterpret_cast<ColorBrewer::ColorScheme *>(broken.data() + broken.header().entries);
+			int numClasses = broken.header().maxClasses - broken.header().minClasses + 1;
+			ColorBrewer::ColorScheme &entry = entries[(ColorBrewer::sequential * broken.header().schemeStride) * numClasses];
+			entry.offset = broken.header().numValues;
+			check(!bundle.load(broken.data(), broken.size), group, "color run out of bounds");
+		}
+		{
+			// an index bit of a scheme beyond numSchemes
+			AlignedBundle broken(reference);
+			std::uint32_t *classIndex = reinterpret_cast<std::uint32_t *>(broken.data() + broken.header().classIndex);
+			int numClasses = broken.header().maxClasses - broken.header().minClasses + 1;
+			classIndex[(ColorBrewer::sequential * numClasses) * broken.header().indexWords + 1] |= 1u << 31;
+			check(!bundle.load(broken.data(), broken.size), group, "class index of a missing scheme");
+		}
+		{
+			// a property bit of a scheme beyond numSchemes in the second index word
+			AlignedBundle broken(reference);
+			std::uint32_t *propertyIndex = reinterpret_cast<std::uint32_t *>(broken.data() + broken.header().propertyIndex);
+			int numClasses = broken.header().maxClasses - broken.header().minClasses + 1;
+			propertyIndex[(ColorBrewer::sequential * PaletteRegistry::numProperties * numClasses) * broken.header().indexWords + 1] |= 1u << 9;
+			check(!bundle.load(broken.data(), broken.size), group, "property index of a missing scheme");
+		}
+		{
+			AlignedBundle broken(reference);
+			char *names = reinterpret_cast<char *>(broken.data() + broken.header().names);
+			std::memset(names, 'a', PaletteRegistry::nameLength);
+			check(!bundle.load(broken.data(), broken.size), group, "unterminated name");
+		}
+	}
+
+	void testParser()
+	{
+		const char *group = "parser";
+
+		struct Case
+		{
+			const char *text;
+			bool valid;
+		};
+
+		const Case csv[] =
+		{
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,3,seq,1,2,3\n,,,4,5,6\n,,,7,8,9\n", true },
+			{ "ColorName,NumOfColors,Type,R,G,B\r\nBlues,1,seq,1,2,3\r\n\r\n", true },
+			{ "R,G,B,NumOfColors,Type,ColorName\n1,2\n", false },
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,3,seq,1,2\n", false },
+			{ "ColorName,NumOfColors,Type,R,G\nBlues,1,seq,1,2\n", false },
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,x,seq,1,2,3\n", false },
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,0,seq,1,2,3\n", false },
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,1,nope,1,2,3\n", false },
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,1,seq,1,2,256\n", false },
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,2,seq,1,2,3\n", false },
+			{ "ColorName,NumOfColors,Type,R,G,B\nBlues,1,seq,1,2,3\n,,,4,5,6\n", false },
+			{ "", false },
+		};
+
+		for (std::size_t i = 0; i < sizeof(csv) / sizeof(csv[0]); ++i)
+		{
+			PaletteLoader loader;
+			bool parsed = loader.parseCsv(csv[i].text, std::strlen(csv[i].text));
+
+			std::ostringstream what;
+			what << "csv case " << i;
+			check(parsed == csv[i].valid && (parsed || loader.size() == 0), group, what.str());
+		}
+
+		const Case json[] =
+		{
+			{ "{ \"Blues\": { \"type\": \"seq\", \"2\": [\"#000000\", \"rgb(1,2,3)\"] } }", true },
+			{ "{ \"Blues\": { \"type\": \"seq\", \"2\": [\"#000000\", \"rgb(1,2,3)\"], \"blind\": [1] } }", true },
+			{ "{ \"Blues\": { \"type\": \"seq\", \"2\": [\"#000000\", \"rgb(1,2,3)\"] }", false },
+			{ "{ \"Blues\": { \"type\": \"seq\", \"2\": [\"#000000\"] } }", false },
+			{ "{ \"Blues\": { \"type\": \"seq\", \"2\": [\"#00000\", \"#000000\"] } }", false },
+			{ "{ \"Blues\": { \"type\": \"seq\", \"2\": [\"rgb(1,2,300)\", \"#000000\"] } }", false },
+			{ "{ \"Blues\": { \"type\": \"what\", \"2\": [\"#000000\", \"#000000\"] } }", false },
+			{ "{ \"Blues\": { \"2\": [\"#000000\", \"#000000\"] } }", false },
+			{ "{ \"Blues\": { \"type\": \"seq\", \"2\": [\"#000000\", \"#000000\"] } } x", false },
+			{ "[", false },
+		};
+
+		for (std::size_t i = 0; i < sizeof(json) / sizeof(json[0]); ++i)
+		{
+			PaletteLoader loader;
+			bool parsed = loader.parseJson(json[i].text, std::strlen(json[i].text));
+
+			std::ostringstream what;
+			what << "json case " << i;
+			check(parsed == json[i].valid && (parsed || loader.size() == 0), group, what.str());
+		}
+
+		// a failed load keeps the schemes loaded before
+		PaletteLoader loader;
+		const char *valid = csv[0].text;
+		const char *invalid = csv[2].text;
+		check(loader.parseCsv(valid, std::strlen(valid)) && !loader.parseCsv(invalid, std::strlen(invalid)) && loader.size() == 1, group, "rollback");
+	}
+
+	void testQuantizer()
+	{
+		const char *group = "quantizer";
+		std::vector<unsigned char> pixels = makePixels(1001, 4);
+		std::shared_ptr<const PaletteQuantizer> shared = PaletteQuantizer::get(ColorBrewer::qualitative, ColorBrewer::Set1, 9);
+		PaletteQuantizer quantizer = *shared;
+
+		check(PaletteQuantizer::get(ColorBrewer::qualitative, ColorBrewer::Set1, 9, 2) == PaletteQuantizer::get(ColorBrewer::qualitative, ColorBrewer::Set1, 9, 4), group, "clamped bits share a quantizer");
+
+		quantizer.setIsa(ColorMapper::scalar);
+		std::vector<unsigned char> reference(4 * 1001);
+		quantizer.quantize(pixels.data(), 1001, reference.data(), PaletteQuantizer::rgba8);
+
+		for (ColorMapper::Isa isa : supportedIsas())
+		{
+			quantizer.setIsa(isa);
+			std::vector<unsigned char> out(4 * 1001);
+			quantizer.quantize(pixels.data(), 1001, out.data(), PaletteQuantizer::rgba8);
+
+			std::ostringstream what;
+			what << "isa " << isa;
+			check(out == reference, group, what.str());
+		}
+	}
+
+	void testDecoder()
+	{
+		const char *group = "decoder";
+		std::vector<unsigned char> pixels = makePixels(1001, 3);
+
+		std::shared_ptr<const ColorLut> lut = ColorLut::get(ColorBrewer::YlGnBu, 256, ColorLut::lab);
+		ColorDecoder decoder(lut, 0.0f, 100.0f, 6);
+		decoder.setIsa(ColorMapper::scalar);
+
+		std::vector<float> values(1001);
+		std::vector<float> distances(1001);
+		decoder.decode(pixels.data(), 1001, values.data(), distances.data());
+
+		for (ColorMapper::Isa isa : supportedIsas())
+		{
+			decoder.setIsa(isa);
+
+			std::vector<float> out(1001);
+			std::vector<float> outDistances(1001);
+			decoder.decode(pixels.data(), 1001, out.data(), outDistances.data());
+
+			std::ostringstream what;
+			what << "isa " << isa;
+			check(out == values && outDistances == distances, group, what.str());
+		}
+
+		// colors of the table decode back close to their value
+		ColorMapper mapper(lut, 0.0f, 100.0f);
+		std::vector<float> ramp(101);
+		for (std::size_t i = 0; i < ramp.size(); ++i)
+			ramp[i] = static_cast<float>(i);
+
+		std::vector<unsigned char> rgb(3 * ramp.size());
+		mapper.map(ramp.data(), ramp.size(), rgb.data(), ColorMapper::rgb8);
+		decoder.decode(rgb.data(), ramp.size(), values.data());
+
+		float maxError = 0.0f;
+		for (std::size_t i = 0; i < ramp.size(); ++i)
+			maxError = std::max(maxError, std::fabs(values[i] - ramp[i]));
+
+		std::ostringstream what;
+		what << "round trip (" << maxError << ")";
+		check(maxError < 5.0f, group, what.str());
+
+		// a missing table decodes against black to white
+		ColorDecoder fallback(ColorLut::get(ColorBrewer::sequential, 999, 256, ColorLut::rgb, 0), 0.0f, 1.0f);
+		const unsigned char white[3] = { 255, 255, 255 };
+		float value = 0.0f;
+		fallback.decode(white, 1, &value);
+		check(value > 0.99f, group, "missing table");
+	}
+
+	typedef void (*BatchConversion)(const float *const in[3], float *const out[3], std::size_t count);
+	typedef void (*ColorConversion)(const float *in, float *out);
+
+	// largest component difference of a batch conversion to the conversion of every color on its own
+	float conversionError(BatchConversion batch, ColorConversion scalar, const float *const in[3], std::size_t count)
+	{
+		std::vector<float> planes(3 * count);
+		float *out[3] = { &planes[0], &planes[count], &planes[2 * count] };
+		batch(in, out, count);
+
+		float maxError = 0.0f;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			float color[3] = { in[0][i], in[1][i], in[2][i] };
+			float reference[3];
+			scalar(color, reference);
+
+			for (int c = 0; c < 3; ++c)
+				maxError = std::max(maxError, std::fabs(out[c][i] - reference[c]));
+		}
+
+		return maxError;
+	}
+
+	void testColorSpace()
+	{
+		const char *group = "colorspace";
+		const std::size_t count = 1001;
+
+		std::mt19937 rng(9);
+		std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+		std::vector<float> planes(3 * count);
+		for (float &v : planes)
+			v = dist(rng);
+
+		// black, white and the primaries
+		float *rgb[3] = { &planes[0], &planes[count], &planes[2 * count] };
+		const float corners[5][3] = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+		for (int i = 0; i < 5; ++i)
+		{
+			for (int c = 0; c < 3; ++c)
+				rgb[c][i] = corners[i][c];
+		}
+
+		// the vector kernels against the scalar conversions, for short tails and a long batch
+		struct Conversion
+		{
+			const char *name;
+			BatchConversion batch;
+			ColorConversion scalar;
+			BatchConversion inverse;
+			ColorConversion scalarInverse;
+			float tolerance;
+		};
+
+		const Conversion conversions[] =
+		{
+			{ "lab", ColorSpace::rgbToLab, ColorSpace::rgbToLab, ColorSpace::labToRgb, ColorSpace::labToRgb, 1e-3f },
+			{ "oklab", ColorSpace::rgbToOklab, ColorSpace::rgbToOklab, ColorSpace::oklabToRgb, ColorSpace::oklabToRgb, 1e-5f },
+		};
+
+		const std::size_t counts[] = { 1, 3, 7, 8, 9, 15, 16, 17, count };
+		for (const Conversion &conversion : conversions)
+		{
+			for (std::size_t n : counts)
+			{
+				float maxError = conversionError(conversion.batch, conversion.scalar, rgb, n);
+
+				std::ostringstream what;
+				what << conversion.name << ", " << n << " colors (" << maxError << ")";
+				check(maxError <= conversion.tolerance, group, what.str());
+			}
+
+			// the way back from the converted colors, in place
+			std::vector<float> copy(planes.begin(), planes.begin() + 3 * count);
+			float *channels[3] = { &copy[0], &copy[count], &copy[2 * count] };
+			conversion.batch(channels, channels, count);
+
+			float inverseError = conversionError(conversion.inverse, conversion.scalarInverse, channels, count);
+			std::ostringstream inverse;
+			inverse << conversion.name << " inverse (" << inverseError << ")";
+			check(inverseError <= 1e-3f, group, inverse.str());
+
+			conversion.inverse(channels, channels, count);
+
+			float maxError = 0.0f;
+			for (std::size_t i = 0; i < 3 * count; ++i)
+				maxError = std::max(maxError, std::fabs(copy[i] - planes[i]));
+
+			std::ostringstream what;
+			what << conversion.name << " round trip (" << maxError << ")";
+			check(maxError <= 1e-3f, group, what.str());
+		}
+
+		// the way back clamps colors outside the gamut
+		float l[2] = { 150.0f, -20.0f };
+		float a[2] = { 0.0f, 0.0f };
+		float b[2] = { 0.0f, 0.0f };
+		float *lab[3] = { l, a, b };
+		ColorSpace::labToRgb(lab, lab, 2);
+		check(l[0] == 1.0f && a[0] == 1.0f && b[0] == 1.0f && l[1] == 0.0f && a[1] == 0.0f && b[1] == 0.0f, group, "clamped");
+	}
+
+	// protanopia of Machado et al. (2009) for one color, in linear RGB with the result clamped to the display
+	void simulateProtanopia(const float *rgb, float *out)
+	{
+		const float matrix[9] = { 0.152286f, 1.052583f, -0.204868f, 0.114503f, 0.786281f, 0.099216f, -0.003882f, -0.048116f, 1.051998f };
+
+		float linear[3];
+		for (int c = 0; c < 3; ++c)
+			linear[c] = ColorSpace::srgbToLinear(rgb[c]);
+
+		for (int r = 0; r < 3; ++r)
+		{
+			float x = matrix[3 * r] * linear[0] + matrix[3 * r + 1] * linear[1] + matrix[3 * r + 2] * linear[2];
+			out[r] = ColorSpace::linearToSrgb(std::min(std::max(x, 0.0f), 1.0f));
+		}
+	}
+
+	void testVision()
+	{
+		const char *group = "vision";
+		const std::size_t count = 1001;
+
+		std::mt19937 rng(10);
+		std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+		std::vector<float> colors(4 * count);
+		for (float &v : colors)
+			v = dist(rng);
+
+		// interleaved with alpha, the batch simulation against the one of every color
+		std::vector<float> out(4 * count);
+		ColorVision::simulate(colors.data(), out.data(), count, ColorVision::protanopia, 1.0f, 4);
+
+		float maxError = 0.0f;
+		bool alpha = true;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			float reference[3];
+			simulateProtanopia(&colors[4 * i], reference);
+
+			for (int c = 0; c < 3; ++c)
+				maxError = std::max(maxError, std::fabs(out[4 * i + c] - reference[c]));
+			alpha = alpha && out[4 * i + 3] == colors[4 * i + 3];
+		}
+
+		std::ostringstream what;
+		what << "protanopia (" << maxError << ")";
+		check(maxError <= 1e-3f && alpha, group, what.str());
+
+		// severity 0 is normal vision
+		ColorVision::simulate(colors.data(), out.data(), count, ColorVision::tritanopia, 0.0f, 4);
+		maxError = 0.0f;
+		for (std::size_t i = 0; i < 4 * count; ++i)
+			maxError = std::max(maxError, std::fabs(out[i] - colors[i]));
+		check(maxError <= 1e-3f, group, "severity 0");
+
+		// bytes agree with the float simulation up to rounding
+		std::vector<unsigned char> pixels = makePixels(count, 11);
+		std::vector<unsigned char> simulated(3 * count);
+		ColorVision::simulate(pixels.data(), simulated.data(), count, ColorVision::deuteranopia);
+
+		std::vector<float> normalized(3 * count);
+		for (std::size_t i = 0; i < normalized.size(); ++i)
+			normalized[i] = pixels[i] / 255.0f;
+		ColorVision::simulate(normalized.data(), normalized.data(), count, ColorVision::deuteranopia);
+
+		int maxByteError = 0;
+		for (std::size_t i = 0; i < normalized.size(); ++i)
+			maxByteError = std::max(maxByteError, std::abs(static_cast<int>(simulated[i]) - static_cast<int>(normalized[i] * 255.0f + 0.5f)));
+		check(maxByteError <= 1, group, "bytes");
+
+		// scores: the smallest pairwise delta E with normal vision and under the protanopia reference
+		ColorBrewer::ColorView view = PaletteRegistry::builtin().getView(ColorBrewer::qualitative, ColorBrewer::Set1, 9);
+		ColorVision::Score score = ColorVision::score(view.rgb, view.n);
+
+		float normal = std::numeric_limits<float>::infinity();
+		float protanopia = std::numeric_limits<float>::infinity();
+		for (unsigned int i = 0; i < view.n; ++i)
+		{
+			for (unsigned int j = i + 1; j < view.n; ++j)
+			{
+				float lab[2][3];
+				float simulatedLab[2][3];
+				for (int k = 0; k < 2; ++k)
+				{
+					float protan[3];
+					ColorSpace::rgbToLab(view.rgb + 3 * (k ? j : i), lab[k]);
+					simulateProtanopia(view.rgb + 3 * (k ? j : i), protan);
+					ColorSpace::rgbToLab(protan, simulatedLab[k]);
+				}
+
+				float d[2] = { 0.0f, 0.0f };
+				for (int c = 0; c < 3; ++c)
+				{
+					d[0] += (lab[0][c] - lab[1][c]) * (lab[0][c] - lab[1][c]);
+					d[1] += (simulatedLab[0][c] - simulatedLab[1][c]) * (simulatedLab[0][c] - simulatedLab[1][c]);
+				}
+
+				normal = std::min(normal, std::sqrt(d[0]));
+				protanopia = std::min(protanopia, std::sqrt(d[1]));
+			}
+		}
+
+		std::ostringstream scores;
+		scores << "score (" << score.normal << " vs " << normal << ", " << score.protanopia << " vs " << protanopia << ")";
+		check(std::fabs(score.normal - normal) <= 0.05f && std::fabs(score.protanopia - protanopia) <= 0.05f, group, scores.str());
+
+		// batches of palettes score like single ones
+		std::vector<float> palettes(view.begin(), view.end());
+		palettes.insert(palettes.end(), view.begin(), view.end());
+		ColorVision::Score batch[2];
+		ColorVision::score(palettes.data(), view.n, 2, batch);
+		check(batch[1].worst() == score.worst() && batch[0].tritanopia == score.tritanopia, group, "batch score");
+		check(std::isinf(ColorVision::score(view.rgb, 1).worst()), group, "single color");
+
+		// rejected input leaves the output untouched
+		std::fill(out.begin(), out.end(), -1.0f);
+		ColorVision::simulate(colors.data(), out.data(), count, ColorVision::protanopia, 1.0f, 2);
+		ColorVision::simulate(colors.data(), out.data(), count, static_cast<ColorVision::Deficiency>(3), 1.0f, 4);
+		check(std::count(out.begin(), out.end(), -1.0f) == static_cast<std::ptrdiff_t>(out.size()), group, "rejected input");
+	}
+
+	// optimal sum of squared deviations of sorted values in k classes, O(k n^2)
+	double bruteForceJenks(const std::vector<double> &sorted, unsigned int k)
+	{
+		std::size_t n = sorted.size();
+		std::vector<double> sums(n + 1, 0.0);
+		std::vector<double> squares(n + 1, 0.0);
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			sums[i + 1] = sums[i] + sorted[i];
+			squares[i + 1] = squares[i] + sorted[i] * sorted[i];
+		}
+
+		const double infinity = std::numeric_limits<double>::infinity();
+		std::vector<double> previous(n + 1, infinity);
+		previous[0] = 0.0;
+
+		for (unsigned int c = 0; c < k; ++c)
+		{
+			std::vector<double> current(n + 1, infinity);
+			for (std::size_t j = 1; j <= n; ++j)
+			{
+				for (std::size_t i = 0; i < j; ++i)
+				{
+					if (previous[i] == infinity)
+						continue;
+
+					double s = sums[j] - sums[i];
+					double cost = squares[j] - squares[i] - s * s / static_cast<double>(j - i);
+					current[j] = std::min(current[j], previous[i] + cost);
+				}
+			}
+			previous.swap(current);
+		}
+
+		return previous[n];
+	}
+
+	void testClassBreaks()
+	{
+		const char *group = "breaks";
+		std::mt19937 rng(6);
+
+		for (int trial = 0; trial < 20; ++trial)
+		{
+			std::size_t count = 20 + rng() % 60;
+			unsigned int k = 2 + rng() % 6;
+
+			std::exponential_distribution<float> dist(0.5f);
+			std::vector<float> values(count);
+			for (float &v : values)
+				v = std::round(dist(rng) * 8.0f) / 8.0f;
+
+			ClassBreaks breaks;
+			check(breaks.compute(values.data(), count, k, ClassBreaks::jenks), group, "compute");
+
+			std::vector<unsigned char> classes(count);
+			breaks.classify(values.data(), count, classes.data());
+
+			// sum of squared deviations of the classes found
+			std::vector<double> sums(256, 0.0), squares(256, 0.0), sizes(256, 0.0);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				sums[classes[i]] += values[i];
+				squares[classes[i]] += static_cast<double>(values[i]) * values[i];
+				sizes[classes[i]] += 1.0;
+			}
+
+			double ssd = 0.0;
+			for (int c = 0; c < 256; ++c)
+			{
+				if (sizes[c] > 0.0)
+					ssd += squares[c] - sums[c] * sums[c] / sizes[c];
+			}
+
+			std::vector<double> sorted(values.begin(), values.end());
+			std::sort(sorted.begin(), sorted.end());
+			unsigned int distinct = static_cast<unsigned int>(std::unique(sorted.begin(), sorted.end()) - sorted.begin());
+			sorted.assign(values.begin(), values.end());
+			std::sort(sorted.begin(), sorted.end());
+
+			double optimum = bruteForceJenks(sorted, std::min(k, distinct));
+
+			std::ostringstream what;
+			what << "jenks optimum, trial " << trial << " (" << ssd << " vs " << optimum << ")";
+			check(std::fabs(ssd - optimum) <= 1e-6 * (1.0 + optimum), group, what.str());
+		}
+
+		// many classes over many distinct values stay within the split table bound
+		std::vector<float> values = makeValues(200000, 7);
+		ClassBreaks breaks(0);
+		check(breaks.compute(values.data() + 3, values.size() - 3, 256, ClassBreaks::jenks) && breaks.size() == 256, group, "k = 256");
+
+		// the binary search counts the inner breaks below a value, NaN and -inf in class 0, +inf in the last
+		std::vector<unsigned char> classes(values.size());
+		breaks.classify(values.data(), values.size(), classes.data());
+
+		bool same = true;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			unsigned int c = 0;
+			for (std::size_t b = 1; b + 1 < breaks.breaks().size(); ++b)
+				c += values[i] > breaks.breaks()[b] ? 1 : 0;
+
+			same = same && classes[i] == c && breaks.classify(values[i]) == c;
+		}
+		check(same && classes[0] == 0 && classes[1] == 0 && classes[2] == 255, group, "classify");
+	}
+
+	void testSketch()
+	{
+		const char *group = "sketch";
+		std::vector<float> values = makeValues(200000, 7);
+
+		// quantiles of a sketch stay close to the exact ones
+		QuantileSketch sketch;
+		sketch.add(values.data() + 3, values.size() - 3);
+
+		std::vector<float> sorted(values.begin() + 3, values.end());
+		std::sort(sorted.begin(), sorted.end());
+
+		const double ranks[] = { 0.1, 0.25, 0.5, 0.75, 0.9 };
+		for (double rank : ranks)
+		{
+			float q = sketch.quantile(rank);
+			double actual = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), q) - sorted.begin()) / sorted.size();
+
+			std::ostringstream what;
+			what << "sketch rank " << rank << " (" << actual << ")";
+			check(std::fabs(actual - rank) < 0.02, group, what.str());
+		}
+	}
+
+	void testEqualize()
+	{
+		const char *group = "equalize";
+		const std::size_t width = 301;
+		const std::size_t height = 97;
+		const std::size_t stride = 320;
+
+		std::vector<float> values = makeValues(stride * height, 2);
+		RasterColorizer colorizer(3);
+		std::vector<std::uint32_t> pixels(width * height);
+
+		// the privatized band histograms add up to the serial one
+		HistogramEqualizer equalizer(ColorLut::get(ColorBrewer::YlOrRd, 256), 0.0f, 1.0f, 1000);
+		HistogramEqualizer serial(ColorLut::get(ColorBrewer::YlOrRd, 256), 0.0f, 1.0f, 1000);
+		for (std::size_t y = 0; y < height; ++y)
+			serial.add(values.data() + y * stride, width);
+
+		colorizer.equalize(equalizer, values.data(), width, height, pixels.data(), ColorMapper::rgba8, stride);
+		check(equalizer.total() == serial.total() && std::equal(equalizer.histogram(), equalizer.histogram() + 1000, serial.histogram()), group, "histogram");
+		check(equalizer.total() == width * height - 1, group, "NaN dropped");
+
+		// a missing table equalizes black to white
+		HistogramEqualizer fallback(ColorLut::get(ColorBrewer::sequential, 999, 256, ColorLut::rgb, 0), 0.0f, 1.0f, 16);
+		fallback.add(values.data(), width);
+		std::shared_ptr<const ColorLut> lut = fallback.lut();
+		check(lut && lut->data()[0] == 0.0f && lut->data()[4 * lut->size() - 2] == 1.0f, group, "missing table");
+	}
+
+	void testPixelFormat()
+	{
+		const char *group = "pixelformat";
+
+		// every half float back and forth, batch against scalar
+		std::vector<std::uint16_t> halves(65536);
+		for (std::size_t i = 0; i < halves.size(); ++i)
+			halves[i] = static_cast<std::uint16_t>(i);
+
+		std::vector<float> floats(65536);
+		PixelFormat::fromHalf(halves.data(), floats.data(), floats.size());
+
+		std::size_t mismatches = 0;
+		for (std::size_t i = 0; i < halves.size(); ++i)
+		{
+			float scalar = PixelFormat::fromHalf(halves[i]);
+			mismatches += std::memcmp(&scalar, &floats[i], sizeof(float)) != 0;
+		}
+		check(mismatches == 0, group, "fromHalf batch");
+
+		std::vector<float> values = makeValues(100003, 5);
+		for (std::size_t i = 0; i < values.size(); i += 7)
+			values[i] *= 1e5f * static_cast<float>(i % 13) - 6e4f;
+
+		std::vector<std::uint16_t> encoded(values.size());
+		PixelFormat::toHalf(values.data(), encoded.data(), values.size());
+
+		mismatches = 0;
+		for (std::size_t i = 0; i < values.size(); ++i)
+			mismatches += encoded[i] != PixelFormat::toHalf(values[i]);
+		check(mismatches == 0, group, "toHalf batch");
+
+		check(PixelFormat::toHalf(1.0f) == 0x3c00 && PixelFormat::toHalf(65520.0f) == 0x7c00 && PixelFormat::toHalf(-0.0f) == 0x8000, group, "toHalf values");
+		check(PixelFormat::packRgb565(1.0f, 0.0f, 1.0f) == 0xf81f && PixelFormat::packRgba4444(1.0f, 0.0f, 0.0f, 1.0f) == 0xf00f, group, "packed layouts");
+
+		// the compact tables of the lut are the encodings of its entries
+		std::shared_ptr<const ColorLut> lut = ColorLut::get(ColorBrewer::YlOrRd, 1024, ColorLut::lab);
+		std::vector<std::uint16_t> rgb565(lut->size());
+		PixelFormat::encode(lut->data(), lut->size(), rgb565.data(), ColorMapper::rgb565);
+		check(std::memcmp(rgb565.data(), lut->rgb565(), 2 * lut->size()) == 0, group, "rgb565 table");
+
+		// round trips lose no more than the format resolution
+		check(PixelFormat::error(lut->data(), lut->size(), ColorMapper::rgba).maxChannel == 0.0f, group, "rgba exact");
+		check(PixelFormat::error(lut->data(), lut->size(), ColorMapper::rgba8).maxChannel <= 0.5f / 255.0f + 1e-6f, group, "rgba8 error");
+		check(PixelFormat::error(lut->data(), lut->size(), ColorMapper::rgba16f).maxChannel <= 1.0f / 2048.0f, group, "rgba16f error");
+		check(PixelFormat::error(lut->data(), lut->size(), ColorMapper::rgb565).maxChannel <= 0.5f / 31.0f + 1e-6f, group, "rgb565 error");
+
+		// half floats keep out of range values, the fixed point formats clamp them
+		const float bright[4] = { 1.5f, 0.5f, 0.5f, 1.0f };
+		check(PixelFormat::error(bright, 1, ColorMapper::rgba16f).maxChannel == 0.0f, group, "rgba16f out of range");
+		check(PixelFormat::error(bright, 1, ColorMapper::rgba8).maxChannel <= 0.5f / 255.0f + 1e-6f, group, "rgba8 out of range");
+	}
+
+	void testIndexed()
+	{
+		const char *group = "indexed";
+		const std::size_t width = 301;
+		const std::size_t height = 97;
+		const std::size_t stride = 320;
+
+		std::vector<float> values = makeValues(stride * height, 2);
+		ColorMapper mapper(ColorLut::get(ColorBrewer::RdBu, 512, ColorLut::lab), 0.0f, 1.0f);
+		RasterColorizer colorizer(3);
+		colorizer.setTileSize(64, 7);
+
+		// applying the palette equals mapping the level centers
+		for (int d = PaletteIndexer::index8; d <= PaletteIndexer::index16; ++d)
+		{
+			PaletteIndexer indexer(-0.5f, 1.5f, static_cast<PaletteIndexer::Depth>(d));
+			std::vector<std::uint16_t> indices(width * height);
+			colorizer.classify(indexer, values.data(), width, height, indices.data(), stride);
+
+			for (int f = ColorMapper::rgb; f <= ColorMapper::rgba4444; ++f)
+			{
+				ColorMapper::Format format = static_cast<ColorMapper::Format>(f);
+				std::vector<unsigned char> palette = indexer.palette(mapper, format);
+				std::vector<unsigned char> out(width * height * ColorMapper::pixelSize(format));
+				colorizer.apply(indices.data(), indexer.depth(), palette.data(), width, height, out.data(), format);
+
+				std::vector<float> centers(width * height);
+				for (std::size_t y = 0; y < height; ++y)
+				{
+					for (std::size_t x = 0; x < width; ++x)
+						centers[y * width + x] = indexer.level(indexer.index(values[y * stride + x]));
+				}
+
+				std::vector<unsigned char> expected(out.size());
+				mapper.map(centers.data(), centers.size(), expected.data(), format);
+
+				std::ostringstream what;
+				what << "depth " << d << " format " << f;
+				check(out == expected, group, what.str());
+			}
+		}
+	}
+
+	struct Group
+	{
+		const char *name;
+		void (*run)();
+	};
+
+	const Group groups[] =
+	{
+		{ "mapper", testMapper },
+		{ "raster", testRaster },
+		{ "stream", testStream },
+		{ "lookup", testLookup },
+		{ "bundle", testBundle },
+		{ "parser", testParser },
+		{ "quantizer", testQuantizer },
+		{ "decoder", testDecoder },
+		{ "colorspace", testColorSpace },
+		{ "vision", testVision },
+		{ "breaks", testClassBreaks },
+		{ "sketch", testSketch },
+		{ "equalize", testEqualize },
+		{ "pixelformat", testPixelFormat },
+		{ "indexed", testIndexed },
+	};
+}
+
+
+int main(int argc, char **argv)
+{
+	NullBuffer nullBuffer;
+	std::streambuf *coutBuffer = std::cout.rdbuf(&nullBuffer);
+
+	for (const Group &group : groups)
+	{
+		bool selected = argc < 2;
+		for (int i = 1; i < argc; ++i)
+			selected = selected || std::strcmp(argv[i], group.name) == 0;
+
+		if (selected)
+			group.run();
+	}
+
+	std::cout.rdbuf(coutBuffer);
+
+	if (failures > 0)
+		std::fprintf(stderr, "%d checks failed\n", failures);
+
+	return failures > 0 ? 1 : 0;
+}